@@ -17,7 +17,8 @@
 
 // C/C++ standard libraries
 #include <utility> // std::move()
-#include <iterator> // std::back_inserter()
+#include <iterator> // std::back_inserter(), std::make_move_iterator()
+#include <algorithm> // std::copy(), std::fill_n(), std::min()
 #include <cassert>
 
 
@@ -197,4 +198,203 @@ void recob::ChargedSpacePointCollectionCreator::produces
 } // recob::ChargedSpacePointCollectionCreator::produces()
 
 
+//------------------------------------------------------------------------------
+//--- recob::ConcurrentChargedSpacePointCollectionCreator
+//------------------------------------------------------------------------------
+recob::ConcurrentChargedSpacePointCollectionCreator::ConcurrentChargedSpacePointCollectionCreator(
+  art::Event& event, std::size_t capacity,
+  std::string const& instanceName /* = {} */
+  )
+  : fEvent(event)
+  , fInstanceName(instanceName)
+  , fSpacePoints(std::make_unique<std::vector<recob::SpacePoint>>(capacity))
+  , fCharges(std::make_unique<std::vector<recob::PointCharge>>(capacity))
+  {}
+
+
+//------------------------------------------------------------------------------
+recob::ConcurrentChargedSpacePointCollectionCreator::ConcurrentChargedSpacePointCollectionCreator
+  (ConcurrentChargedSpacePointCollectionCreator&& from)
+  : fEvent(from.fEvent)
+  , fInstanceName(std::move(from.fInstanceName))
+  , fSpacePoints(std::move(from.fSpacePoints))
+  , fSpacePointPtrMaker(std::move(from.fSpacePointPtrMaker))
+  , fCharges(std::move(from.fCharges))
+  , fChargePtrMaker(std::move(from.fChargePtrMaker))
+  , fSize(from.fSize.exchange(0U))
+  {}
+
+
+//------------------------------------------------------------------------------
+recob::ConcurrentChargedSpacePointCollectionCreator
+recob::ConcurrentChargedSpacePointCollectionCreator::forPtrs(
+  art::Event& event, std::size_t capacity,
+  std::string const& instanceName /* = {} */
+  )
+{
+  ConcurrentChargedSpacePointCollectionCreator creator
+    (event, capacity, instanceName);
+  creator.fSpacePointPtrMaker = std::make_unique<art::PtrMaker<recob::SpacePoint>>
+    (event, instanceName);
+  creator.fChargePtrMaker = std::make_unique<art::PtrMaker<recob::PointCharge>>
+    (event, instanceName);
+  return creator;
+} // ConcurrentChargedSpacePointCollectionCreator::forPtrs()
+
+
+//------------------------------------------------------------------------------
+std::size_t recob::ConcurrentChargedSpacePointCollectionCreator::reserve
+  (std::size_t n)
+{
+  // if this assertion fails, reserve() is being called after put()
+  assert(fSpacePoints);
+
+  std::size_t const first = fSize.fetch_add(n, std::memory_order_acq_rel);
+  if (first + n > fSpacePoints->size()) {
+    throw cet::exception("ChargedSpacePointCollectionCreator")
+      << "Can't reserve " << n << " more space points after " << first
+      << ": capacity is " << fSpacePoints->size() << "\n";
+  }
+  return first;
+} // recob::ConcurrentChargedSpacePointCollectionCreator::reserve()
+
+
+//------------------------------------------------------------------------------
+void recob::ConcurrentChargedSpacePointCollectionCreator::set
+  (std::size_t i, recob::SpacePoint&& spacePoint, recob::PointCharge&& charge)
+{
+  assert(i < size());
+
+  (*fSpacePoints)[i] = std::move(spacePoint);
+  (*fCharges)[i] = std::move(charge);
+
+} // recob::ConcurrentChargedSpacePointCollectionCreator::set()
+
+
+//------------------------------------------------------------------------------
+std::size_t recob::ConcurrentChargedSpacePointCollectionCreator::add
+  (recob::SpacePoint const& spacePoint, recob::PointCharge const& charge)
+{
+  std::size_t const i = reserve(1U);
+  (*fSpacePoints)[i] = spacePoint;
+  (*fCharges)[i] = charge;
+  return i;
+} // recob::ConcurrentChargedSpacePointCollectionCreator::add(copy)
+
+
+//------------------------------------------------------------------------------
+std::size_t recob::ConcurrentChargedSpacePointCollectionCreator::add
+  (recob::SpacePoint&& spacePoint, recob::PointCharge&& charge)
+{
+  std::size_t const i = reserve(1U);
+  set(i, std::move(spacePoint), std::move(charge));
+  return i;
+} // recob::ConcurrentChargedSpacePointCollectionCreator::add()
+
+
+//------------------------------------------------------------------------------
+std::size_t recob::ConcurrentChargedSpacePointCollectionCreator::addAll(
+  std::vector<recob::SpacePoint>&& spacePoints,
+  std::vector<recob::PointCharge>&& charges
+  )
+{
+  if (spacePoints.size() != charges.size()) {
+    throw cet::exception("ChargedSpacePointCollectionCreator")
+      << "Input collections of inconsistent size:"
+      << " " << spacePoints.size() << " (space points)"
+      << " and " << charges.size() << " (charges)"
+      << "\n";
+  }
+
+  std::size_t const first = reserve(spacePoints.size());
+  std::copy(
+    std::make_move_iterator(spacePoints.begin()),
+    std::make_move_iterator(spacePoints.end()),
+    fSpacePoints->begin() + first
+    );
+  std::copy(
+    std::make_move_iterator(charges.begin()),
+    std::make_move_iterator(charges.end()),
+    fCharges->begin() + first
+    );
+  spacePoints.clear();
+  charges.clear();
+  return first;
+
+} // recob::ConcurrentChargedSpacePointCollectionCreator::addAll()
+
+
+//------------------------------------------------------------------------------
+std::size_t recob::ConcurrentChargedSpacePointCollectionCreator::addAll(
+  std::vector<recob::SpacePoint> const& spacePoints,
+  std::vector<recob::PointCharge> const& charges
+  )
+{
+  if (spacePoints.size() != charges.size()) {
+    throw cet::exception("ChargedSpacePointCollectionCreator")
+      << "Input collections of inconsistent size:"
+      << " " << spacePoints.size() << " (space points)"
+      << " and " << charges.size() << " (charges)"
+      << "\n";
+  }
+
+  std::size_t const first = reserve(spacePoints.size());
+  std::copy
+    (spacePoints.begin(), spacePoints.end(), fSpacePoints->begin() + first);
+  std::copy(charges.begin(), charges.end(), fCharges->begin() + first);
+  return first;
+
+} // recob::ConcurrentChargedSpacePointCollectionCreator::addAll()
+
+
+//------------------------------------------------------------------------------
+void recob::ConcurrentChargedSpacePointCollectionCreator::put() {
+
+  // if the capacity was exceeded, fSize went beyond it
+  std::size_t const n = std::min(fSize.exchange(0U), fSpacePoints->size());
+  fSpacePoints->resize(n);
+  fCharges->resize(n);
+
+  fEvent.put(std::move(fSpacePoints), fInstanceName);
+  fEvent.put(std::move(fCharges), fInstanceName);
+
+  assert(spent());
+  assert(empty());
+} // recob::ConcurrentChargedSpacePointCollectionCreator::put()
+
+
+//------------------------------------------------------------------------------
+void recob::ConcurrentChargedSpacePointCollectionCreator::clear() {
+
+  std::size_t const reserved = fSize.exchange(0U);
+  if (fSpacePoints) {
+    std::size_t const n = std::min(reserved, fSpacePoints->size());
+    std::fill_n(fSpacePoints->begin(), n, recob::SpacePoint{});
+    std::fill_n(fCharges->begin(), n, recob::PointCharge{});
+  }
+
+  assert(empty());
+
+} // recob::ConcurrentChargedSpacePointCollectionCreator::clear()
+
+
+//------------------------------------------------------------------------------
+art::Ptr<recob::SpacePoint>
+recob::ConcurrentChargedSpacePointCollectionCreator::spacePointPtr
+  (std::size_t i) const
+{
+  return fSpacePointPtrMaker
+    ? (*fSpacePointPtrMaker)(i): art::Ptr<recob::SpacePoint>{};
+} // recob::ConcurrentChargedSpacePointCollectionCreator::spacePointPtr()
+
+
+//------------------------------------------------------------------------------
+art::Ptr<recob::PointCharge>
+recob::ConcurrentChargedSpacePointCollectionCreator::chargePtr
+  (std::size_t i) const
+{
+  return fChargePtrMaker? (*fChargePtrMaker)(i): art::Ptr<recob::PointCharge>{};
+} // recob::ConcurrentChargedSpacePointCollectionCreator::chargePtr()
+
+
 //------------------------------------------------------------------------------
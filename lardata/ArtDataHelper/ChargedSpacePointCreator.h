@@ -23,6 +23,7 @@
 
 // C/C++ standard libraries
 #include <vector>
+#include <atomic>
 #include <memory> // std::unique_ptr<>
 #include <type_traits> // std::enable_if_t, ...
 #include <cstdlib> // std::size_t
@@ -435,6 +436,255 @@ namespace recob {
 
   }; // class ChargedSpacePointCollectionCreator
 
+
+  /**
+   * @brief Creates a collection of space points with associated charge,
+   *        accepting insertions from concurrent threads.
+   * @see `recob::ChargedSpacePointCollectionCreator`
+   *
+   * This creator produces the same data products as
+   * `recob::ChargedSpacePointCollectionCreator`, with the same requirements.
+   * The difference is that the storage is allocated in full at construction,
+   * for a maximum number of space points (`capacity()`), and insertions
+   * reserve ranges of indices in that storage with a single atomic operation.
+   * Different threads can then fill their own ranges at the same time, and
+   * create the _art_ pointers to the elements they have filled, e.g. to
+   * associate them to hits.
+   *
+   * The order of the space points in the data products is the order in which
+   * the index ranges are reserved, which in a multithreaded context is in
+   * general not reproducible. Algorithms requiring a deterministic order
+   * should reserve the ranges serially (e.g. one per hit group, in a first
+   * pass) and then fill them in parallel with `set()`.
+   *
+   * Example of usage:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * void MyProducer::produce(art::Event& event) {
+   *
+   *   auto spacePoints
+   *     = recob::ConcurrentChargedSpacePointCollectionCreator::forPtrs
+   *     (event, maxSpacePoints(hitSets));
+   *
+   *   // ... parallel loop over hit sets (one per task):
+   *   auto const [ points, charges ] = fSpacePointChargeAlgo->run(hitSet);
+   *   std::size_t const first = spacePoints.addAll(points, charges);
+   *   for (std::size_t i = first; i < first + points.size(); ++i) {
+   *     auto const& spacePointPtr = spacePoints.spacePointPtr(i);
+   *     // ... collect associations with `spacePointPtr` (per task!)
+   *   }
+   *   // ... end of the parallel loop
+   *
+   *   spacePoints.put();
+   *
+   * } // MyProducer::produce()
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Note that `art::Assns` is not thread-safe, and associations need to be
+   * collected per task and merged afterwards.
+   *
+   * Thread safety
+   * --------------
+   *
+   * * `reserve()`, `add()`, `addAll()`, `set()` (on different indices),
+   *   `size()` and the element and pointer access on already filled elements
+   *   can be called concurrently;
+   * * `put()` and `clear()` must be called when no other thread is using the
+   *   object.
+   *
+   * Elements whose index has been reserved but never filled are left
+   * default-constructed in the final data products.
+   */
+  class ConcurrentChargedSpacePointCollectionCreator {
+
+  public:
+
+    //--- BEGIN Constructors ---------------------------------------------------
+    /// @{
+    /// @name Constructors
+
+    /**
+     * @brief Constructor binding this object to a specific _art_ event.
+     * @param event the _art_ event to bind to
+     * @param capacity maximum number of space points that will be added
+     * @param instanceName _(default: empty)_ instance name for all data
+     *                     products
+     *
+     * Storage for `capacity` space points and charges is allocated here.
+     * _art_ pointer creation is not enabled (see `forPtrs()`).
+     */
+    ConcurrentChargedSpacePointCollectionCreator(
+      art::Event& event, std::size_t capacity,
+      std::string const& instanceName = {}
+      );
+
+    /**
+     * @brief Static function binding a new object to a specific _art_ event.
+     * @param event the _art_ event to bind to
+     * @param capacity maximum number of space points that will be added
+     * @param instanceName _(default: empty)_ instance name for all data
+     *                     products
+     *
+     * This static function follows the named-constructor idiom,
+     * enabling the creation of _art_ pointers.
+     */
+    static ConcurrentChargedSpacePointCollectionCreator forPtrs(
+      art::Event& event, std::size_t capacity,
+      std::string const& instanceName = {}
+      );
+
+    ConcurrentChargedSpacePointCollectionCreator
+      (ConcurrentChargedSpacePointCollectionCreator&& from);
+
+    /// @}
+    //--- END Constructors -----------------------------------------------------
+
+
+    //--- BEGIN Insertion and finish operations --------------------------------
+    /// @{
+    /// @name Insertion and finish operations
+
+    /**
+     * @brief Reserves `n` consecutive elements in the collection.
+     * @param n number of elements to reserve
+     * @return the index of the first of the reserved elements
+     * @throw cet::exception (category `ChargedSpacePointCollectionCreator`)
+     *                       if the capacity is exceeded
+     *
+     * The reserved elements are default-constructed, and can be filled with
+     * `set()`. After an exception, the object should not be used any more.
+     */
+    std::size_t reserve(std::size_t n);
+
+    /**
+     * @brief Fills the element `i`, which must have been already reserved.
+     * @param i index of the element to be set
+     * @param spacePoint the space point to be moved into the collection
+     * @param charge the charge to be moved into the collection
+     */
+    void set
+      (std::size_t i, recob::SpacePoint&& spacePoint, recob::PointCharge&& charge);
+
+    //@{
+    /**
+     * @brief Inserts the specified space point and associated charge.
+     * @return the index of the new element
+     * @throw cet::exception (category `ChargedSpacePointCollectionCreator`)
+     *                       if the capacity is exceeded
+     */
+    std::size_t add
+      (recob::SpacePoint const& spacePoint, recob::PointCharge const& charge);
+    std::size_t add(recob::SpacePoint&& spacePoint, recob::PointCharge&& charge);
+    //@}
+
+    //@{
+    /**
+     * @brief Inserts all the space points and charges from the vectors into a
+     *        single contiguous range of the collection.
+     * @return the index of the first of the inserted elements
+     * @throw cet::exception (category `ChargedSpacePointCollectionCreator`)
+     *                       if the input collections are inconsistent or
+     *                       the capacity is exceeded
+     */
+    std::size_t addAll(
+      std::vector<recob::SpacePoint>&& spacePoints,
+      std::vector<recob::PointCharge>&& charges
+      );
+    std::size_t addAll(
+      std::vector<recob::SpacePoint> const& spacePoints,
+      std::vector<recob::PointCharge> const& charges
+      );
+    //@}
+
+    /**
+     * @brief Puts all data products into the event, leaving the creator
+     *        `empty()`.
+     *
+     * The collections are trimmed to the reserved size and moved into the
+     * event. This is the last valid action of the object.
+     */
+    void put();
+
+    /// @}
+    //--- END Insertion and finish operations --------------------------------
+
+
+    //--- BEGIN Queries and operations -----------------------------------------
+    /// @{
+    /// @name Queries and operations
+
+    /// Returns whether there are currently no space points in the collection.
+    bool empty() const { return size() == 0U; }
+
+    /// Returns the number of space points reserved so far.
+    std::size_t size() const
+      { return spent()? 0U: fSize.load(std::memory_order_acquire); }
+
+    /// Returns the maximum number of space points the collection can hold.
+    std::size_t capacity() const { return spent()? 0U: fSpacePoints->size(); }
+
+    /// Removes all data from the collection, making it `empty()`.
+    void clear();
+
+    /// Returns whether `put()` has already been called.
+    bool spent() const { return !fSpacePoints; }
+
+    /// Returns whether _art_ pointer making is enabled.
+    bool canMakePointers() const { return bool(fSpacePointPtrMaker); }
+
+    ///@}
+    //--- END Queries and operations -------------------------------------------
+
+
+    //--- BEGIN Complimentary unchecked element access -------------------------
+    ///@{
+    ///@name Complimentary unchecked element access
+
+    /// Returns the specified space point; undefined behaviour if not there.
+    recob::SpacePoint const& spacePoint(std::size_t i) const
+      { return fSpacePoints->operator[](i); }
+
+    /// Returns an _art_ pointer to the specified space point (no check done!).
+    art::Ptr<recob::SpacePoint> spacePointPtr(std::size_t i) const;
+
+    /// Returns the specified charge; undefined behaviour if not there.
+    recob::PointCharge const& charge(std::size_t i) const
+      { return fCharges->operator[](i); }
+
+    /// Returns an _art_ pointer to the specified charge (no check done!).
+    art::Ptr<recob::PointCharge> chargePtr(std::size_t i) const;
+
+    /// @}
+    //--- END Complimentary unchecked element access ---------------------------
+
+
+    /// Declares the data products being produced (same as
+    /// `ChargedSpacePointCollectionCreator::produces()`).
+    static void produces
+      (art::ProducesCollector& producesCollector, std::string const& instanceName = {})
+      {
+        ChargedSpacePointCollectionCreator::produces
+          (producesCollector, instanceName);
+      }
+
+
+  private:
+    art::Event& fEvent; ///< The event this object is bound to.
+
+    std::string fInstanceName; ///< Instance name of all the data products.
+
+    /// Space point data (pre-sized to the capacity).
+    std::unique_ptr<std::vector<recob::SpacePoint>> fSpacePoints;
+    /// Space point pointer maker.
+    std::unique_ptr<art::PtrMaker<recob::SpacePoint>> fSpacePointPtrMaker;
+    /// Charge data (pre-sized to the capacity).
+    std::unique_ptr<std::vector<recob::PointCharge>> fCharges;
+    /// Charge pointer maker.
+    std::unique_ptr<art::PtrMaker<recob::PointCharge>> fChargePtrMaker;
+
+    /// Number of elements reserved so far.
+    std::atomic<std::size_t> fSize { 0U };
+
+  }; // class ConcurrentChargedSpacePointCollectionCreator
+
 } // namespace recob
 
 
@@ -20,6 +20,11 @@
 #include "canvas/Persistency/Common/FindOne.h"
 #include "canvas/Utilities/InputTag.h"
 
+// LArSoft includes
+#include "lardata/ArtDataHelper/Dumpers/DumpOutput.h"
+#include "lardata/ArtDataHelper/Dumpers/HitDumpers.h"
+#include "lardataobj/RecoBase/Hit.h"
+
 // ... plus see below ...
 
 namespace hit {
@@ -41,6 +46,11 @@ namespace hit {
    *   that the associated wire are on the same channel as the hit
    * - *CheckRawDigitAssociation* (string, default: false): if set, verifies
    *   that the associated raw digits are on the same channel as the hit
+   * - *DumpMode* (string, default: "text"): "text" prints on screen;
+   *   "binary" writes the hit values into *DumpFile* (to be read with
+   *   `lardump_read`) and "hash" only computes them; in both cases, only a
+   *   digest of the hits of each event is printed
+   * - *DumpFile* (string, default: empty): output file of the "binary" mode
    *
    */
   class DumpHits: public art::EDAnalyzer {
@@ -73,6 +83,18 @@ namespace hit {
         false
         }; // CheckWireAssociation
 
+      fhicl::Atom<std::string> DumpMode{
+        Name("DumpMode"),
+        Comment("output: \"text\", \"binary\" (into DumpFile) or \"hash\""),
+        "text"
+        };
+
+      fhicl::Atom<std::string> DumpFile{
+        Name("DumpFile"),
+        Comment("name of the output file in \"binary\" mode"),
+        ""
+        };
+
     }; // Config
 
     using Parameters = art::EDAnalyzer::Table<Config>;
@@ -90,6 +112,11 @@ namespace hit {
     std::string fOutputCategory;    ///< category for LogInfo output
     bool bCheckRawDigits;           ///< check associations with raw digits
     bool bCheckWires;               ///< check associations with wires
+    recob::dumper::DumpOutput fDumpOutput; ///< binary or digest output
+
+    /// Writes all the values of the hit into the stream, without decoration
+    template <typename Stream>
+    void PrintHitValues(Stream& out, recob::Hit const& hit) const;
 
   }; // class DumpHits
 
@@ -110,7 +137,6 @@ namespace hit {
 
 // LArSoft includes
 #include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
-#include "lardataobj/RecoBase/Hit.h"
 #include "lardataobj/RecoBase/Wire.h"
 #include "lardataobj/RawData/RawDigit.h"
 
@@ -124,6 +150,8 @@ namespace hit {
     , fOutputCategory    (config().OutputCategory())
     , bCheckRawDigits    (config().CheckRawDigitAssociation())
     , bCheckWires        (config().CheckWireAssociation())
+    , fDumpOutput
+        (recob::dumper::ParseDumpMode(config().DumpMode()), config().DumpFile())
     {}
 
 
@@ -133,9 +161,8 @@ namespace hit {
     // fetch the data to be dumped on screen
     auto Hits = evt.getValidHandle<std::vector<recob::Hit>>(fHitsModuleLabel);
 
-    mf::LogInfo(fOutputCategory)
-      << "The event contains " << Hits->size() << " '"
-      << fHitsModuleLabel.encode() << "' hits";
+    recob::dumper::DumpHitsHeader
+      (mf::LogInfo(fOutputCategory), Hits->size(), fHitsModuleLabel);
 
     std::unique_ptr<art::FindOne<raw::RawDigit>> HitToRawDigit;
     if (bCheckRawDigits) {
@@ -158,12 +185,27 @@ namespace hit {
       }
     } // if check wires
 
+    if (!fDumpOutput.isText()) {
+      std::uint64_t const digest = fDumpOutput.dump(
+        evt.run(), evt.subRun(), evt.event(), fHitsModuleLabel.encode(),
+        [this, &Hits](auto& out)
+          {
+            out << Hits->size();
+            for (const recob::Hit& hit: *Hits) PrintHitValues(out, hit);
+          }
+        );
+      mf::LogVerbatim(fOutputCategory) << "Event " << evt.id() << " '"
+        << fHitsModuleLabel.encode() << "' hits digest: "
+        << recob::dumper::DigestString(digest);
+    } // if not text
+
     unsigned int iHit = 0;
     for (const recob::Hit& hit: *Hits) {
 
       // print a header for the cluster
-      mf::LogVerbatim(fOutputCategory)
-        << "Hit #" << iHit << ": " << hit;
+      if (fDumpOutput.isText()) {
+        recob::dumper::DumpHit(mf::LogVerbatim(fOutputCategory), hit, iHit);
+      }
 
       if (HitToRawDigit) {
         raw::ChannelID_t assChannelID = HitToRawDigit->at(iHit).ref().Channel();
@@ -190,6 +232,22 @@ namespace hit {
 
   } // DumpHits::analyze()
 
+
+  //-------------------------------------------------
+  template <typename Stream>
+  void DumpHits::PrintHitValues(Stream& out, recob::Hit const& hit) const {
+    geo::WireID const& wireID = hit.WireID();
+    out << hit.Channel()
+      << wireID.Cryostat << wireID.TPC << wireID.Plane << wireID.Wire
+      << hit.View() << hit.SignalType()
+      << hit.StartTick() << hit.EndTick()
+      << hit.PeakTime() << hit.SigmaPeakTime() << hit.RMS()
+      << hit.PeakAmplitude() << hit.SigmaPeakAmplitude()
+      << hit.SummedADC() << hit.Integral() << hit.SigmaIntegral()
+      << hit.Multiplicity() << hit.LocalIndex()
+      << hit.GoodnessOfFit() << hit.DegreesOfFreedom();
+  } // DumpHits::PrintHitValues()
+
   DEFINE_ART_MODULE(DumpHits)
 
 } // namespace hit
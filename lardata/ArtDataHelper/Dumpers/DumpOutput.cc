@@ -0,0 +1,201 @@
+/**
+ * @file   DumpOutput.cc
+ * @brief  Binary and digest output for the dumper modules - implementation
+ * @date   October 19, 2026
+ * @see    DumpOutput.h
+ */
+
+// LArSoft libraries
+#include "lardata/ArtDataHelper/Dumpers/DumpOutput.h"
+
+// support libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <cstdio> // std::snprintf()
+#include <cstring> // std::memcpy(), std::memcmp()
+
+
+namespace {
+
+  /// Writes the binary representation of the value.
+  template <typename T>
+  void writeValue(std::ostream& out, T value)
+    { out.write(reinterpret_cast<char const*>(&value), sizeof(value)); }
+
+  /// Reads the binary representation of the value.
+  template <typename T>
+  bool readValue(std::istream& in, T& value)
+    { return bool(in.read(reinterpret_cast<char*>(&value), sizeof(value))); }
+
+} // local namespace
+
+
+//------------------------------------------------------------------------------
+recob::dumper::DumpMode recob::dumper::ParseDumpMode(std::string const& name) {
+  if (name == "text") return DumpMode::Text;
+  if (name == "binary") return DumpMode::Binary;
+  if (name == "hash") return DumpMode::Hash;
+  throw cet::exception("DumpOutput")
+    << "Unknown dump mode '" << name
+    << "' (supported: \"text\", \"binary\" and \"hash\")\n";
+} // recob::dumper::ParseDumpMode()
+
+
+//------------------------------------------------------------------------------
+recob::dumper::DumpFileWriter::DumpFileWriter(std::string const& path)
+  : fPath(path)
+  , fOut(path, std::ios::binary)
+{
+  if (!fOut) {
+    throw cet::exception("DumpOutput")
+      << "Can't create dump file '" << fPath << "'\n";
+  }
+  fOut.write(Magic, sizeof(Magic));
+} // recob::dumper::DumpFileWriter::DumpFileWriter()
+
+
+void recob::dumper::DumpFileWriter::writeBlock(
+  unsigned int run, unsigned int subRun, unsigned int event,
+  std::string const& label, std::string const& records
+) {
+  writeValue<std::uint32_t>(fOut, run);
+  writeValue<std::uint32_t>(fOut, subRun);
+  writeValue<std::uint32_t>(fOut, event);
+  writeValue<std::uint32_t>(fOut, label.size());
+  fOut.write(label.data(), label.size());
+  writeValue<std::uint64_t>(fOut, records.size());
+  fOut.write(records.data(), records.size());
+  if (!fOut) {
+    throw cet::exception("DumpOutput")
+      << "Error while writing into dump file '" << fPath << "'\n";
+  }
+} // recob::dumper::DumpFileWriter::writeBlock()
+
+
+//------------------------------------------------------------------------------
+recob::dumper::DumpFileReader::DumpFileReader(std::string const& path)
+  : fPath(path)
+  , fIn(path, std::ios::binary)
+{
+  char magic[sizeof(DumpFileWriter::Magic)];
+  if (!fIn.read(magic, sizeof(magic))
+    || (std::memcmp(magic, DumpFileWriter::Magic, sizeof(magic)) != 0)
+  ) {
+    throw cet::exception("DumpOutput")
+      << "'" << fPath << "' is not a dump file\n";
+  }
+} // recob::dumper::DumpFileReader::DumpFileReader()
+
+
+bool recob::dumper::DumpFileReader::next(DumpBlock& block) {
+  std::uint32_t run, subRun, event, labelLength;
+  if (!readValue(fIn, run)) return false; // end of file
+  std::uint64_t recordsLength = 0;
+  bool good = readValue(fIn, subRun) && readValue(fIn, event)
+    && readValue(fIn, labelLength);
+  if (good) {
+    block.label.resize(labelLength);
+    good = fIn.read(block.label.data(), labelLength) && readValue(fIn, recordsLength);
+  }
+  if (good) {
+    block.records.resize(recordsLength);
+    good = bool(fIn.read(block.records.data(), recordsLength));
+  }
+  if (!good) {
+    throw cet::exception("DumpOutput")
+      << "Truncated block in dump file '" << fPath << "'\n";
+  }
+  block.run = run;
+  block.subRun = subRun;
+  block.event = event;
+  return true;
+} // recob::dumper::DumpFileReader::next()
+
+
+//------------------------------------------------------------------------------
+std::size_t recob::dumper::DecodeRecords(
+  std::string const& records,
+  std::function<void(char tag, std::string const& value)> const& out
+) {
+  char const* p = records.data();
+  char const* const end = p + records.size();
+
+  auto fetch = [&p, end](void* dest, std::size_t n) {
+    if (std::size_t(end - p) < n) {
+      throw cet::exception("DumpOutput") << "Truncated record\n";
+    }
+    std::memcpy(dest, p, n);
+    p += n;
+  };
+  auto fetchVarint = [&p, end]() {
+    std::uint64_t v = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7) {
+      if (p == end) break;
+      unsigned char const byte = *(p++);
+      v |= std::uint64_t(byte & 0x7F) << shift;
+      if (!(byte & 0x80)) return v;
+    }
+    throw cet::exception("DumpOutput") << "Truncated or invalid integer record\n";
+  };
+
+  std::size_t nRecords = 0;
+  char buffer[64];
+  while (p != end) {
+    char const tag = *(p++);
+    switch (tag) {
+      case record::Bool: {
+        unsigned char b;
+        fetch(&b, sizeof(b));
+        out(tag, b? "true": "false");
+        break;
+      }
+      case record::Signed: {
+        std::uint64_t const z = fetchVarint();
+        std::int64_t const v = static_cast<std::int64_t>(z >> 1) ^ -static_cast<std::int64_t>(z & 1);
+        out(tag, std::to_string(v));
+        break;
+      }
+      case record::Unsigned:
+        out(tag, std::to_string(fetchVarint()));
+        break;
+      case record::Real: {
+        double v;
+        fetch(&v, sizeof(v));
+        std::snprintf(buffer, sizeof(buffer), "%.17g", v);
+        out(tag, buffer);
+        break;
+      }
+      case record::String: {
+        std::uint32_t length;
+        fetch(&length, sizeof(length));
+        std::string s(length, '\0');
+        fetch(s.data(), length);
+        out(tag, s);
+        break;
+      }
+      default:
+        throw cet::exception("DumpOutput")
+          << "Unknown record type " << int(tag) << " after " << nRecords
+          << " records\n";
+    } // switch
+    ++nRecords;
+  } // while
+  return nRecords;
+} // recob::dumper::DecodeRecords()
+
+
+//------------------------------------------------------------------------------
+recob::dumper::DumpOutput::DumpOutput(DumpMode mode, std::string const& fileName)
+  : fMode(mode)
+{
+  if (fMode != DumpMode::Binary) return;
+  if (fileName.empty()) {
+    throw cet::exception("DumpOutput")
+      << "Binary dump mode requires an output file name\n";
+  }
+  fFile = std::make_unique<DumpFileWriter>(fileName);
+} // recob::dumper::DumpOutput::DumpOutput()
+
+
+//------------------------------------------------------------------------------
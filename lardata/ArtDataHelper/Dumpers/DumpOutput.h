@@ -0,0 +1,350 @@
+/**
+ * @file   DumpOutput.h
+ * @brief  Binary and digest output for the dumper modules
+ * @date   October 19, 2026
+ * @see    DumpOutput.cc
+ *
+ * The dumper modules print their data products through a stream with
+ * `operator<<`. The streams defined here can be used in place of a message
+ * facility stream, so that the same printing code produces instead:
+ *
+ * * a compact binary record of the printed values (`BinaryDumpStream`),
+ *   saved into a file which `lardump_read` prints back;
+ * * a 64-bit digest of the same records (`HashDumpStream`), enough to detect
+ *   differences between two runs without formatting any text.
+ *
+ * Only values are recorded: arithmetic types and enumerators in binary form,
+ * and `std::string` objects as they are. String literals, single `char`
+ * characters, blank strings (indentation) and stream manipulators are the
+ * decoration of the text output and are ignored; `signed char` and
+ * `unsigned char` (`std::int8_t`, `std::uint8_t`) are recorded as integers.
+ * Objects of other types are formatted with their `operator<<` and recorded
+ * as strings: this is a slow path, and dumpers should print their data
+ * members instead.
+ */
+
+#ifndef LARDATA_ARTDATAHELPER_DUMPERS_DUMPOUTPUT_H
+#define LARDATA_ARTDATAHELPER_DUMPERS_DUMPOUTPUT_H 1
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t, std::int64_t
+#include <cstdio> // std::snprintf()
+#include <fstream>
+#include <functional> // std::function
+#include <iomanip> // std::setw(), std::setprecision(), ...
+#include <ios> // std::ios_base
+#include <memory> // std::unique_ptr
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility> // std::forward()
+
+
+namespace recob {
+  namespace dumper {
+
+    /// Output of the dumper modules.
+    enum class DumpMode {
+      Text,   ///< Text through the message facility (the default).
+      Binary, ///< Binary records into a file, and a digest per event.
+      Hash    ///< Only a digest per event.
+    };
+
+    /// Returns the mode with the specified name ("text", "binary", "hash").
+    /// @throw cet::exception (category "DumpOutput") if the name is unknown
+    DumpMode ParseDumpMode(std::string const& name);
+
+
+    /// Type tags of the records.
+    namespace record {
+      constexpr char Bool     = 'b';
+      constexpr char Signed   = 'i'; ///< Signed integer, zig-zag varint.
+      constexpr char Unsigned = 'u'; ///< Unsigned integer, varint.
+      constexpr char Real     = 'd'; ///< Real number, as double.
+      constexpr char String   = 's'; ///< 32-bit length, then the characters.
+    } // namespace record
+
+
+    /// Sink appending the records to a buffer.
+    struct BufferSink {
+      std::string data;
+      void append(void const* p, std::size_t n)
+        { data.append(static_cast<char const*>(p), n); }
+    };
+
+    /// Sink computing the 64-bit FNV-1a digest of the records.
+    struct HashSink {
+      static constexpr std::uint64_t Offset = 14695981039346656037ULL;
+      static constexpr std::uint64_t Prime = 1099511628211ULL;
+      std::uint64_t hash = Offset;
+      void append(void const* p, std::size_t n)
+        {
+          auto const* c = static_cast<unsigned char const*>(p);
+          for (std::size_t i = 0; i < n; ++i) { hash ^= c[i]; hash *= Prime; }
+        }
+    };
+
+    /// Returns the digest of a buffer, same as `HashSink` would compute.
+    inline std::uint64_t HashRecords(std::string const& data)
+      { HashSink sink; sink.append(data.data(), data.size()); return sink.hash; }
+
+    /// Returns the digest as 16 hexadecimal digits.
+    inline std::string DigestString(std::uint64_t hash)
+      {
+        char buffer[17];
+        std::snprintf(buffer, sizeof(buffer), "%016llx", (unsigned long long) hash);
+        return buffer;
+      }
+
+
+    /**
+     * @brief Stream encoding the printed values into records.
+     * @tparam Sink where the records are sent (`append(void const*, size)`)
+     *
+     * See the documentation of this file for what is recorded.
+     */
+    template <typename Sink>
+    class RecordStream {
+        public:
+
+      /// Records the value (or ignores it, if it is decoration).
+      template <typename T>
+      RecordStream& operator<< (T const& value);
+
+      /// Ignores manipulators like `std::endl`.
+      RecordStream& operator<< (std::ostream& (*)(std::ostream&)) { return *this; }
+
+      /// Ignores manipulators like `std::fixed`.
+      RecordStream& operator<< (std::ios_base& (*)(std::ios_base&)) { return *this; }
+
+      /// Returns the sink with the records so far.
+      Sink const& sink() const { return fSink; }
+
+      /// Returns the sink with the records so far.
+      Sink& sink() { return fSink; }
+
+        private:
+      Sink fSink;
+      std::ostringstream fFormatter; ///< Reused for objects of other types.
+
+      void put(char tag, void const* p, std::size_t n)
+        { fSink.append(&tag, 1); fSink.append(p, n); }
+
+      /// Writes the tag and the value as variable length integer (LEB128).
+      void putVarint(char tag, std::uint64_t v)
+        {
+          unsigned char buffer[11];
+          std::size_t n = 0;
+          buffer[n++] = tag;
+          while (v >= 0x80) { buffer[n++] = (v & 0x7F) | 0x80; v >>= 7; }
+          buffer[n++] = v;
+          fSink.append(buffer, n);
+        }
+
+      void putString(char const* s, std::size_t n)
+        {
+          if (isBlank(s, n)) return; // indentation
+          std::uint32_t const length = n;
+          put(record::String, &length, sizeof(length));
+          fSink.append(s, n);
+        }
+
+      static bool isBlank(char const* s, std::size_t n)
+        {
+          for (std::size_t i = 0; i < n; ++i)
+            if ((s[i] != ' ') && (s[i] != '\t') && (s[i] != '\n')) return false;
+          return true;
+        }
+
+    }; // class RecordStream<>
+
+    /// True if `T` is the type of a manipulator from `<iomanip>`.
+    template <typename T>
+    constexpr bool isIOManipulator_v
+      =  std::is_same_v<T, decltype(std::setw(0))>
+      || std::is_same_v<T, decltype(std::setprecision(0))>
+      || std::is_same_v<T, decltype(std::setfill(' '))>
+      || std::is_same_v<T, decltype(std::setbase(10))>
+      || std::is_same_v<T, decltype(std::setiosflags(std::ios_base::fixed))>
+      || std::is_same_v<T, decltype(std::resetiosflags(std::ios_base::fixed))>
+      ;
+
+
+    /// Stream collecting binary records of the values.
+    using BinaryDumpStream = RecordStream<BufferSink>;
+
+    /// Stream computing a digest of the values.
+    using HashDumpStream = RecordStream<HashSink>;
+
+
+    /// Writes the dump blocks into a binary file.
+    class DumpFileWriter {
+        public:
+      /// First bytes of a dump file.
+      static constexpr char Magic[8] = { 'L', 'A', 'R', 'D', 'U', 'M', 'P', '1' };
+
+      /// Creates (overwrites) the file and writes its header.
+      explicit DumpFileWriter(std::string const& path);
+
+      /// Writes the records of one data product in one event.
+      void writeBlock(
+        unsigned int run, unsigned int subRun, unsigned int event,
+        std::string const& label, std::string const& records
+        );
+
+        private:
+      std::string fPath;
+      std::ofstream fOut;
+    }; // class DumpFileWriter
+
+
+    /// One data product in one event, as read from a dump file.
+    struct DumpBlock {
+      unsigned int run = 0;
+      unsigned int subRun = 0;
+      unsigned int event = 0;
+      std::string label;   ///< Module and product label.
+      std::string records; ///< The encoded records.
+    }; // DumpBlock
+
+
+    /// Reads the dump blocks from a binary file.
+    class DumpFileReader {
+        public:
+      /// Opens the file and checks its header.
+      explicit DumpFileReader(std::string const& path);
+
+      /// Reads the next block; returns false at the end of the file.
+      bool next(DumpBlock& block);
+
+        private:
+      std::string fPath;
+      std::ifstream fIn;
+    }; // class DumpFileReader
+
+
+    /**
+     * @brief Decodes the records of a block, one by one.
+     * @param records the encoded records
+     * @param out called with the tag and text representation of each record
+     * @return the number of records decoded
+     */
+    std::size_t DecodeRecords(
+      std::string const& records,
+      std::function<void(char tag, std::string const& value)> const& out
+      );
+
+
+    /**
+     * @brief Binary or digest output of a dumper module.
+     *
+     * In binary mode the records of each product are written as a block
+     * into the output file; in both modes, the digest of the records is
+     * returned (the one of the binary mode being the digest of the block).
+     */
+    class DumpOutput {
+        public:
+      /// Sets up the output (the file is used only in binary mode).
+      DumpOutput(DumpMode mode, std::string const& fileName);
+
+      DumpMode mode() const { return fMode; }
+      bool isText() const { return fMode == DumpMode::Text; }
+
+      /**
+       * @brief Records the output of the printing function.
+       * @param op callable printing into the stream it is passed
+       * @return digest of the records
+       *
+       * The callable is called with a `BinaryDumpStream` or a
+       * `HashDumpStream`, depending on the mode; it should be a generic
+       * lambda calling the templated printing functions of the dumper.
+       */
+      template <typename Op>
+      std::uint64_t dump(
+        unsigned int run, unsigned int subRun, unsigned int event,
+        std::string const& label, Op&& op
+        );
+
+        private:
+      DumpMode fMode;
+      std::unique_ptr<DumpFileWriter> fFile; ///< Output file (binary mode).
+    }; // class DumpOutput
+
+  } // namespace dumper
+} // namespace recob
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Sink>
+template <typename T>
+auto recob::dumper::RecordStream<Sink>::operator<< (T const& value)
+  -> RecordStream&
+{
+  using Value_t = std::decay_t<T>;
+  if constexpr (std::is_same_v<Value_t, bool>) {
+    unsigned char const b = value;
+    put(record::Bool, &b, 1);
+  }
+  else if constexpr (
+    std::is_same_v<Value_t, char>
+    || std::is_same_v<Value_t, char const*> || std::is_same_v<Value_t, char*>
+    || isIOManipulator_v<Value_t>
+  ) {
+    // decoration of the text output
+  }
+  else if constexpr (
+    std::is_enum_v<Value_t>
+    || (std::is_integral_v<Value_t> && std::is_signed_v<Value_t>)
+  ) {
+    std::int64_t const v = static_cast<std::int64_t>(value);
+    // zig-zag encoding keeps small negative numbers short
+    putVarint(record::Signed,
+      (static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63));
+  }
+  else if constexpr (std::is_integral_v<Value_t>) {
+    putVarint(record::Unsigned, value);
+  }
+  else if constexpr (std::is_floating_point_v<Value_t>) {
+    double const v = value;
+    put(record::Real, &v, sizeof(v));
+  }
+  else if constexpr (std::is_same_v<Value_t, std::string>) {
+    putString(value.data(), value.size());
+  }
+  else if constexpr (std::is_same_v<Value_t, std::string_view>) {
+    putString(value.data(), value.size());
+  }
+  else {
+    // other objects are formatted
+    fFormatter.str("");
+    fFormatter << value;
+    std::string const s = fFormatter.str();
+    putString(s.data(), s.size());
+  }
+  return *this;
+} // recob::dumper::RecordStream<>::operator<<
+
+
+//------------------------------------------------------------------------------
+template <typename Op>
+std::uint64_t recob::dumper::DumpOutput::dump(
+  unsigned int run, unsigned int subRun, unsigned int event,
+  std::string const& label, Op&& op
+) {
+  if (fMode == DumpMode::Hash) {
+    HashDumpStream out;
+    op(out);
+    return out.sink().hash;
+  }
+  BinaryDumpStream out;
+  op(out);
+  if (fFile) fFile->writeBlock(run, subRun, event, label, out.sink().data);
+  return HashRecords(out.sink().data);
+} // recob::dumper::DumpOutput::dump()
+
+
+#endif // LARDATA_ARTDATAHELPER_DUMPERS_DUMPOUTPUT_H
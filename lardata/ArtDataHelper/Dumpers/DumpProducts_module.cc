@@ -0,0 +1,305 @@
+/**
+ * @file   DumpProducts_module.cc
+ * @brief  Dumps on screen raw digits, wires and hits, formatted in parallel
+ * @date   October 19, 2026
+ * @see    DumpRawDigits_module.cc DumpWires_module.cc DumpHits_module.cc
+ */
+
+// LArSoft includes
+#include "lardata/ArtDataHelper/Dumpers/HitDumpers.h"
+#include "lardata/ArtDataHelper/Dumpers/ParallelDump.h"
+#include "lardata/ArtDataHelper/Dumpers/RawDigitDumpers.h"
+#include "lardata/ArtDataHelper/Dumpers/WireDumpers.h"
+#include "lardataobj/RawData/RawDigit.h"
+#include "lardataobj/RecoBase/Wire.h"
+#include "lardataobj/RecoBase/Hit.h"
+
+// art libraries
+#include "art/Framework/Core/EDAnalyzer.h"
+#include "art/Framework/Core/ModuleMacros.h"
+#include "art/Framework/Principal/Event.h"
+#include "art/Framework/Principal/Handle.h"
+#include "canvas/Utilities/InputTag.h"
+
+// support libraries
+#include "fhiclcpp/types/Atom.h"
+#include "fhiclcpp/types/Sequence.h"
+#include "fhiclcpp/types/Name.h"
+#include "fhiclcpp/types/Comment.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C//C++ standard libraries
+#include <functional> // std::function
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace recob {
+
+  /**
+   * @brief Prints the content of raw digits, wires and hits on screen.
+   *
+   * This analyser prints the same output as `DumpRawDigits`, `DumpWires` and
+   * `DumpHits` (without association checks), for any number of data products.
+   * The elements of all the products of the event are formatted on parallel
+   * threads, in chunks, each into its own buffer; the messages are then sent
+   * to the `LogVerbatim` stream in the same order as the single dumpers, one
+   * product after the other, in the order of the configuration.
+   * If a product is missing, the ones before it are printed before the
+   * module throws the exception about it.
+   *
+   * Configuration parameters
+   * =========================
+   *
+   * - *RawDigits* (list of input tags, default: empty): the `raw::RawDigit`
+   *   collections to be dumped
+   * - *Wires* (list of input tags, default: empty): the `recob::Wire`
+   *   collections to be dumped
+   * - *Hits* (list of input tags, default: empty): the `recob::Hit`
+   *   collections to be dumped
+   * - *DigitsPerLine* (integer, default: `20`): the dump of digits and ticks
+   *   will put this many of them for each line; `0` suppresses digit printout
+   * - *Pedestal* (integer, default: `0`): raw digit values are written
+   *   relative to this number
+   * - *RawDigitCategory*, *WireCategory*, *HitCategory* (strings, default:
+   *   `"DumpDigits"`, `"DumpWires"`, `"DumpHits"`): the categories used for
+   *   the output, the same as the single dumpers
+   * - *NThreads* (integer, default: `1`): number of formatting threads;
+   *   `0` uses all the hardware threads
+   * - *ChunkSize* (integer, default: `32`): elements formatted by a thread
+   *   at a time
+   */
+  class DumpProducts: public art::EDAnalyzer {
+
+    /// Type to represent a pedestal.
+    using Pedestal_t = raw::RawDigit::ADCvector_t::value_type;
+
+      public:
+
+    struct Config {
+      using Name = fhicl::Name;
+      using Comment = fhicl::Comment;
+
+      fhicl::Sequence<art::InputTag> RawDigits{
+        Name("RawDigits"),
+        Comment("tags of the raw::RawDigit collections to be dumped"),
+        std::vector<art::InputTag>{} /* default */
+        };
+
+      fhicl::Sequence<art::InputTag> Wires{
+        Name("Wires"),
+        Comment("tags of the recob::Wire collections to be dumped"),
+        std::vector<art::InputTag>{} /* default */
+        };
+
+      fhicl::Sequence<art::InputTag> Hits{
+        Name("Hits"),
+        Comment("tags of the recob::Hit collections to be dumped"),
+        std::vector<art::InputTag>{} /* default */
+        };
+
+      fhicl::Atom<unsigned int> DigitsPerLine{
+        Name("DigitsPerLine"),
+        Comment("number of digits printed per line (0: don't print digits)"),
+        20 /* default */
+        };
+
+      fhicl::Atom<Pedestal_t> Pedestal{
+        Name("Pedestal"),
+        Comment("raw digit values are written relative to this number"),
+        0 /* default */
+        };
+
+      fhicl::Atom<std::string> RawDigitCategory{
+        Name("RawDigitCategory"),
+        Comment("the messagefacility category used for the raw digits"),
+        "DumpDigits" /* default */
+        };
+
+      fhicl::Atom<std::string> WireCategory{
+        Name("WireCategory"),
+        Comment("the messagefacility category used for the wires"),
+        "DumpWires" /* default */
+        };
+
+      fhicl::Atom<std::string> HitCategory{
+        Name("HitCategory"),
+        Comment("the messagefacility category used for the hits"),
+        "DumpHits" /* default */
+        };
+
+      fhicl::Atom<unsigned int> NThreads{
+        Name("NThreads"),
+        Comment("number of formatting threads (0: all the hardware threads)"),
+        1U /* default */
+        };
+
+      fhicl::Atom<unsigned int> ChunkSize{
+        Name("ChunkSize"),
+        Comment("number of elements formatted by a thread at a time"),
+        32U /* default */
+        };
+
+    }; // Config
+
+    using Parameters = art::EDAnalyzer::Table<Config>;
+
+
+    /// Constructor.
+    explicit DumpProducts(Parameters const& config);
+
+    /// Prints an introduction.
+    virtual void beginJob() override;
+
+    /// Does the printing.
+    virtual void analyze (art::Event const& evt) override;
+
+      private:
+
+    std::vector<art::InputTag> fRawDigitTags; ///< Raw digits to be dumped.
+    std::vector<art::InputTag> fWireTags; ///< Wires to be dumped.
+    std::vector<art::InputTag> fHitTags; ///< Hits to be dumped.
+    unsigned int fDigitsPerLine; ///< Ticks/digits per line in the output.
+    Pedestal_t fPedestal; ///< ADC pedestal, will be subtracted from digits.
+    std::string fRawDigitCategory; ///< Category for raw digit output.
+    std::string fWireCategory; ///< Category for wire output.
+    std::string fHitCategory; ///< Category for hit output.
+    unsigned int fNThreads; ///< Number of formatting threads.
+    unsigned int fChunkSize; ///< Elements formatted at a time.
+
+  }; // class DumpProducts
+
+} // namespace recob
+
+
+//------------------------------------------------------------------------------
+//---  Implementation
+//------------------------------------------------------------------------------
+recob::DumpProducts::DumpProducts(Parameters const& config)
+  : EDAnalyzer         (config)
+  , fRawDigitTags     (config().RawDigits())
+  , fWireTags         (config().Wires())
+  , fHitTags          (config().Hits())
+  , fDigitsPerLine    (config().DigitsPerLine())
+  , fPedestal         (config().Pedestal())
+  , fRawDigitCategory (config().RawDigitCategory())
+  , fWireCategory     (config().WireCategory())
+  , fHitCategory      (config().HitCategory())
+  , fNThreads         (config().NThreads())
+  , fChunkSize        (config().ChunkSize())
+  {}
+
+
+//------------------------------------------------------------------------------
+void recob::DumpProducts::beginJob() {
+
+  // same as DumpRawDigits
+  if (!fRawDigitTags.empty() && (fPedestal != 0)) {
+    mf::LogVerbatim(fRawDigitCategory) << "A pedestal of " << fPedestal
+      << " will be subtracted from all raw digits";
+  } // if pedestal
+
+} // recob::DumpProducts::beginJob()
+
+
+//------------------------------------------------------------------------------
+void recob::DumpProducts::analyze(art::Event const& evt) {
+
+  /// Header message and category of the elements of each product.
+  struct ProductOutput_t {
+    std::function<void()> printHeader;
+    std::string const* category;
+  };
+  std::vector<ProductOutput_t> outputs;
+
+  recob::dumper::ParallelFormatter formatter(fNThreads, fChunkSize);
+
+  // formats all the queued products, then prints them in order
+  auto const printQueued = [&formatter, &outputs]()
+    {
+      formatter.run();
+      for (std::size_t iProduct = 0; iProduct < outputs.size(); ++iProduct) {
+        ProductOutput_t const& output = outputs[iProduct];
+        output.printHeader();
+        formatter.forEach(iProduct, [&output](std::string_view text)
+          { mf::LogVerbatim(*output.category) << text; });
+      } // for products
+      formatter.clear();
+      outputs.clear();
+    };
+
+  //
+  // queue all the products (their messages are as in the single dumpers);
+  // before a missing product throws, the products queued so far are printed
+  //
+  for (art::InputTag const& tag: fRawDigitTags) {
+    auto const handle = evt.getHandle<std::vector<raw::RawDigit>>(tag);
+    if (!handle) printQueued();
+    auto const& RawDigits = *handle; // throws if the product is missing
+    outputs.push_back({
+      [this, &evt, &RawDigits, &tag]()
+        {
+          raw::dumper::DumpRawDigitsHeader(mf::LogVerbatim(fRawDigitCategory),
+            evt.id(), RawDigits.size(), tag);
+        },
+      &fRawDigitCategory
+      });
+    formatter.add(RawDigits.size(),
+      [this, &RawDigits](std::ostream& out, std::size_t i)
+        {
+          raw::dumper::DumpRawDigit
+            (out, RawDigits[i], fDigitsPerLine, fPedestal);
+        }
+      );
+  } // for raw digits
+
+  for (art::InputTag const& tag: fWireTags) {
+    auto const handle = evt.getHandle<std::vector<recob::Wire>>(tag);
+    if (!handle) printQueued();
+    auto const& Wires = *handle; // throws if the product is missing
+    outputs.push_back({
+      [this, &evt, &Wires, &tag]()
+        {
+          recob::dumper::DumpWiresHeader
+            (mf::LogVerbatim(fWireCategory), evt.id(), Wires.size(), tag);
+        },
+      &fWireCategory
+      });
+    formatter.add(Wires.size(),
+      [this, &Wires](std::ostream& out, std::size_t i)
+        { recob::dumper::DumpWire(out, Wires[i], fDigitsPerLine); }
+      );
+  } // for wires
+
+  for (art::InputTag const& tag: fHitTags) {
+    auto const handle = evt.getHandle<std::vector<recob::Hit>>(tag);
+    if (!handle) printQueued();
+    auto const& Hits = *handle; // throws if the product is missing
+    outputs.push_back({
+      [this, &Hits, &tag]()
+        {
+          recob::dumper::DumpHitsHeader
+            (mf::LogInfo(fHitCategory), Hits.size(), tag);
+        },
+      &fHitCategory
+      });
+    formatter.add(Hits.size(),
+      [&Hits](std::ostream& out, std::size_t i)
+        { recob::dumper::DumpHit(out, Hits[i], i); }
+      );
+  } // for hits
+
+  //
+  // format everything, then print in order
+  //
+  printQueued();
+
+} // recob::DumpProducts::analyze()
+
+
+//------------------------------------------------------------------------------
+DEFINE_ART_MODULE(recob::DumpProducts)
+
+//------------------------------------------------------------------------------
@@ -6,9 +6,9 @@
  */
 
 // LArSoft includes
-#include "lardataalg/Utilities/StatCollector.h" // lar::util::MinMaxCollector<>
+#include "lardata/ArtDataHelper/Dumpers/DumpOutput.h"
+#include "lardata/ArtDataHelper/Dumpers/RawDigitDumpers.h"
 #include "lardataobj/RawData/RawDigit.h"
-#include "lardataobj/RawData/raw.h" // raw::Uncompress()
 #include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
 
 // art libraries
@@ -26,8 +26,7 @@
 
 // C//C++ standard libraries
 #include <string>
-#include <algorithm> // std::min(), std::copy_n()
-#include <iomanip> // std::setprecision(), std::setw()
+#include <utility> // std::forward(), std::move()
 
 
 namespace detsim {
@@ -49,6 +48,11 @@ namespace detsim {
    *   will put this many of them for each line
    * - *Pedestal* (integer, default: `0`): digit values are written relative
    *   to this number
+   * - *DumpMode* (string, default: `"text"`): `"text"` prints on screen;
+   *   `"binary"` writes the values into *DumpFile* (to be read with
+   *   `lardump_read`) and `"hash"` only computes them; in both cases, only a
+   *   digest of the raw digits of each event is printed
+   * - *DumpFile* (string, default: empty): output file of the `"binary"` mode
    *
    */
   class DumpRawDigits: public art::EDAnalyzer {
@@ -89,6 +93,18 @@ namespace detsim {
         0 /* default */
         };
 
+      fhicl::Atom<std::string> DumpMode{
+        Name("DumpMode"),
+        Comment("output: \"text\", \"binary\" (into DumpFile) or \"hash\""),
+        "text" /* default */
+        };
+
+      fhicl::Atom<std::string> DumpFile{
+        Name("DumpFile"),
+        Comment("name of the output file in \"binary\" mode"),
+        "" /* default */
+        };
+
     }; // Config
 
     using Parameters = art::EDAnalyzer::Table<Config>;
@@ -109,6 +125,7 @@ namespace detsim {
     std::string fOutputCategory; ///< Category for `LogVerbatim` output.
     unsigned int fDigitsPerLine; ///< Ticks/digits per line in the output.
     Pedestal_t fPedestal; ///< ADC pedestal, will be subtracted from digits.
+    recob::dumper::DumpOutput fDumpOutput; ///< Binary or digest output.
 
     /// Dumps a single `recob:Wire` to the specified output stream.
     template <typename Stream>
@@ -131,6 +148,8 @@ detsim::DumpRawDigits::DumpRawDigits(Parameters const& config)
   , fOutputCategory   (config().OutputCategory())
   , fDigitsPerLine    (config().DigitsPerLine())
   , fPedestal         (config().Pedestal())
+  , fDumpOutput
+      (recob::dumper::ParseDumpMode(config().DumpMode()), config().DumpFile())
   {}
 
 
@@ -151,9 +170,24 @@ void detsim::DumpRawDigits::analyze(art::Event const& evt) {
   auto const& RawDigits
     = *(evt.getValidHandle<std::vector<raw::RawDigit>>(fDetSimModuleLabel));
 
-  mf::LogVerbatim(fOutputCategory) << "Event " << evt.id()
-    << " contains " << RawDigits.size() << " '" << fDetSimModuleLabel.encode()
-    << "' waveforms";
+  if (!fDumpOutput.isText()) {
+    std::uint64_t const digest = fDumpOutput.dump(
+      evt.run(), evt.subRun(), evt.event(), fDetSimModuleLabel.encode(),
+      [this, &RawDigits](auto& out)
+        {
+          out << RawDigits.size();
+          for (raw::RawDigit const& digits: RawDigits) PrintRawDigit(out, digits);
+        }
+      );
+    mf::LogVerbatim log(fOutputCategory);
+    raw::dumper::DumpRawDigitsHeader
+      (log, evt.id(), RawDigits.size(), fDetSimModuleLabel);
+    log << "; digest: " << recob::dumper::DigestString(digest);
+    return;
+  } // if not text
+
+  raw::dumper::DumpRawDigitsHeader(mf::LogVerbatim(fOutputCategory),
+    evt.id(), RawDigits.size(), fDetSimModuleLabel);
   for (raw::RawDigit const& digits: RawDigits) {
 
     PrintRawDigit(mf::LogVerbatim(fOutputCategory), digits);
@@ -170,92 +204,10 @@ void detsim::DumpRawDigits::PrintRawDigit(
   std::string indent /* = "  " */, std::string firstIndent /* = "  " */
 ) const {
 
-  //
-  // uncompress the digits
-  //
-  raw::RawDigit::ADCvector_t ADCs(digits.Samples());
-  raw::Uncompress(digits.ADCs(), ADCs, digits.Compression());
-
-  //
-  // print a header for the raw digits
-  //
-  out << firstIndent
-    << "  #" << digits.Channel() << ": " << ADCs.size() << " time ticks";
-  if (digits.Samples() != ADCs.size())
-    out << " [!!! EXPECTED " << digits.Samples() << "] ";
-  out
-    << " (" << digits.NADC() << " after compression); compression type: ";
-  switch (digits.Compression()) {
-    case raw::kNone:            out << "no compression"; break;
-    case raw::kHuffman:         out << "Huffman encoding" ; break;
-    case raw::kZeroSuppression: out << "zero suppression"; break;
-    case raw::kZeroHuffman:     out << "zero suppression + Huffman encoding";
-                                break;
-    case raw::kDynamicDec:      out << "dynamic decimation"; break;
-    default:
-      out << "unknown (#" << ((int) digits.Compression()) << ")"; break;
-  } // switch
-
-  // print the content of the channel
-  if (fDigitsPerLine > 0) {
-    std::vector<Digit_t> DigitBuffer(fDigitsPerLine), LastBuffer;
-
-    unsigned int repeat_count = 0; // additional lines like the last one
-    unsigned int index = 0;
-    lar::util::MinMaxCollector<Digit_t> Extrema;
-    out << "\n" << indent
-      << "content of the channel (" << fDigitsPerLine << " ticks per line):";
-    auto iTick = ADCs.cbegin(), tend = ADCs.cend(); // const iterators
-    while (iTick != tend) {
-      // the next line will show at most fDigitsPerLine ticks
-      unsigned int line_size
-        = std::min(fDigitsPerLine, (unsigned int) ADCs.size() - index);
-      if (line_size == 0) break; // no more ticks
-
-      // fill the new buffer (iTick will move forward)
-      DigitBuffer.resize(line_size);
-      auto iBuf = DigitBuffer.begin(), bend = DigitBuffer.end();
-      while ((iBuf != bend) && (iTick != tend))
-        Extrema.add(*(iBuf++) = (*(iTick++) - fPedestal));
-      index += line_size;
-
-      // if the new buffer is the same as the old one, just mark it
-      if (DigitBuffer == LastBuffer) {
-        repeat_count += 1;
-        continue;
-      }
-
-      // if there are previous repeats, write that on screen
-      // before the new, different line
-      if (repeat_count > 0) {
-        out << "\n" << indent
-          << "  [ ... repeated " << repeat_count << " more times, "
-          << (repeat_count * LastBuffer.size()) << " ticks ]";
-        repeat_count = 0;
-      }
-
-      // dump the new line of ticks
-      out << "\n" << indent << " ";
-      for (auto digit: DigitBuffer)
-        out << " " << std::setw(4) << digit;
-
-      // quick way to assign DigitBuffer to LastBuffer
-      // (we don't care we lose the former)
-      std::swap(LastBuffer, DigitBuffer);
-
-    } // while
-    if (repeat_count > 0) {
-      out << "\n" << indent
-        << "  [ ... repeated " << repeat_count << " more times to the end ]";
-    }
-    if (Extrema.min() < Extrema.max()) {
-      out << "\n" << indent
-        << "  range of " << index
-        << " samples: [" << Extrema.min() << ";" << Extrema.max() << "]";
-    }
-  } // if dumping the ticks
-
-} // detsim::DumpRawDigits::analyze()
+  raw::dumper::DumpRawDigit(std::forward<Stream>(out), digits,
+    fDigitsPerLine, fPedestal, std::move(indent), std::move(firstIndent));
+
+} // detsim::DumpRawDigits::PrintRawDigit()
 
 
 //------------------------------------------------------------------------------
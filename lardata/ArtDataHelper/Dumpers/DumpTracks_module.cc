@@ -6,6 +6,7 @@
  */
 
 // LArSoft includes
+#include "lardata/ArtDataHelper/Dumpers/DumpOutput.h"
 #include "lardataobj/RecoBase/Track.h"
 #include "lardataobj/RecoBase/Hit.h"
 #include "lardataobj/RecoBase/SpacePoint.h"
@@ -223,6 +224,11 @@ namespace recob {
    *   associated with the tracks
    * - *ParticleAssociations* (boolean, default: `true`): prints the number
    *   of particle-flow particles associated with the tracks
+   * - *DumpMode* (string, default: `"text"`): `"text"` prints on screen;
+   *   `"binary"` writes the values into *DumpFile* (to be read with
+   *   `lardump_read`) and `"hash"` only computes them; in both cases, only a
+   *   digest of the tracks of each event is printed
+   * - *DumpFile* (string, default: empty): output file of the `"binary"` mode
    *
    */
   class DumpTracks : public art::EDAnalyzer {
@@ -272,6 +278,16 @@ namespace recob {
         Comment("prints the number of PF particles associated to the track"),
         true
         };
+      fhicl::Atom<std::string> DumpMode{
+        Name("DumpMode"),
+        Comment("output: \"text\", \"binary\" (into DumpFile) or \"hash\""),
+        "text"
+        };
+      fhicl::Atom<std::string> DumpFile{
+        Name("DumpFile"),
+        Comment("name of the output file in \"binary\" mode"),
+        ""
+        };
 
     }; // Config
 
@@ -295,9 +311,12 @@ namespace recob {
     bool fPrintHits; ///< prints the index of associated hits
     bool fPrintSpacePoints; ///< prints the index of associated space points
     bool fPrintParticles; ///< prints the index of associated PFParticles
+    recob::dumper::DumpOutput fDumpOutput; ///< binary or digest output
 
-    /// Dumps information about the specified track
-    void DumpTrack(unsigned int iTrack, recob::Track const& track) const;
+    /// Dumps information about the specified track into the stream
+    template <typename Stream>
+    void DumpTrack
+      (Stream&& log, unsigned int iTrack, recob::Track const& track) const;
 
   }; // class DumpTracks
 
@@ -320,6 +339,8 @@ namespace recob {
     , fPrintHits        (config().PrintHits())
     , fPrintSpacePoints (config().PrintSpacePoints())
     , fPrintParticles   (config().ParticleAssociations())
+    , fDumpOutput
+        (recob::dumper::ParseDumpMode(config().DumpMode()), config().DumpFile())
     {}
 
   //-------------------------------------------------
@@ -366,54 +387,77 @@ namespace recob {
         << fTrackModuleLabel.encode() << "' tracks.\n";
     }
 
+    auto const printAssociations = [&](auto& log, unsigned int iTrack)
+      {
+        if (pHits || pSpacePoints || pPFParticles) {
+          log << "\n  associated with:";
+          if (pHits)
+            log << " " << pHits->at(iTrack).size() << " hits;";
+          if (pSpacePoints)
+            log << " " << pSpacePoints->at(iTrack).size() << " space points;";
+          if (pPFParticles)
+            log << " " << pPFParticles->at(iTrack).size() << " PF particles;";
+        } // if we have any association
+
+        if (pHits && fPrintHits) {
+          const auto& Hits = pHits->at(iTrack);
+          log << "\n  hit indices (" << Hits.size() << "):\n";
+          PrintAssociatedIndexTable(log, Hits, 10 /* 10 hits per line */, "    ");
+        } // if print individual hits
+
+        if (pSpacePoints && fPrintSpacePoints) {
+          const auto& SpacePoints = pSpacePoints->at(iTrack);
+          log << "\n  space point IDs (" << SpacePoints.size() << "):\n";
+          PrintAssociatedIDTable
+            (log, SpacePoints, 10 /* 10 hits per line */, "    ");
+        } // if print individual space points
+
+        if (pPFParticles && fPrintParticles) {
+          const auto& PFParticles = pPFParticles->at(iTrack);
+          log << "\n  particle indices (" << PFParticles.size() << "):\n";
+          // currently a particle has no ID
+          PrintAssociatedIndexTable
+            (log, PFParticles, 10 /* 10 hits per line */, "    ");
+        } // if print individual particles
+      }; // printAssociations()
+
+    if (!fDumpOutput.isText()) {
+      std::uint64_t const digest = fDumpOutput.dump(
+        evt.run(), evt.subRun(), evt.event(), fTrackModuleLabel.encode(),
+        [&](auto& out)
+          {
+            out << Tracks->size();
+            for (unsigned int iTrack = 0; iTrack < Tracks->size(); ++iTrack) {
+              DumpTrack(out, iTrack, Tracks->at(iTrack));
+              printAssociations(out, iTrack);
+            }
+          }
+        );
+      mf::LogVerbatim(fOutputCategory) << "Event " << evt.id() << " '"
+        << fTrackModuleLabel.encode() << "' tracks digest: "
+        << recob::dumper::DigestString(digest);
+      return;
+    } // if not text
+
     for (unsigned int iTrack = 0; iTrack < Tracks->size(); ++iTrack) {
       const recob::Track& track = Tracks->at(iTrack);
 
       // print track information
-      DumpTrack(iTrack, track);
+      DumpTrack(mf::LogVerbatim(fOutputCategory), iTrack, track);
 
       mf::LogVerbatim log(fOutputCategory);
-      if (pHits || pSpacePoints || pPFParticles) {
-        log << "\n  associated with:";
-        if (pHits)
-          log << " " << pHits->at(iTrack).size() << " hits;";
-        if (pSpacePoints)
-          log << " " << pSpacePoints->at(iTrack).size() << " space points;";
-        if (pPFParticles)
-          log << " " << pPFParticles->at(iTrack).size() << " PF particles;";
-      } // if we have any association
-
-      if (pHits && fPrintHits) {
-        const auto& Hits = pHits->at(iTrack);
-        log << "\n  hit indices (" << Hits.size() << "):\n";
-        PrintAssociatedIndexTable(log, Hits, 10 /* 10 hits per line */, "    ");
-      } // if print individual hits
-
-      if (pSpacePoints && fPrintSpacePoints) {
-        const auto& SpacePoints = pSpacePoints->at(iTrack);
-        log << "\n  space point IDs (" << SpacePoints.size() << "):\n";
-        PrintAssociatedIDTable
-          (log, SpacePoints, 10 /* 10 hits per line */, "    ");
-      } // if print individual space points
-
-      if (pPFParticles && fPrintParticles) {
-        const auto& PFParticles = pPFParticles->at(iTrack);
-        log << "\n  particle indices (" << PFParticles.size() << "):\n";
-        // currently a particle has no ID
-        PrintAssociatedIndexTable
-          (log, PFParticles, 10 /* 10 hits per line */, "    ");
-      } // if print individual particles
+      printAssociations(log, iTrack);
     } // for tracks
   } // DumpTracks::analyze()
 
 
   //---------------------------------------------------------------------------
+  template <typename Stream>
   void DumpTracks::DumpTrack
-    (unsigned int iTrack, recob::Track const& track) const
+    (Stream&& log, unsigned int iTrack, recob::Track const& track) const
   {
     // print a header for the track
     const unsigned int nPoints = track.NumberTrajectoryPoints();
-    mf::LogVerbatim log(fOutputCategory);
     log
       << "Track #" << iTrack << " ID: " << track.ID()
         << std::fixed << std::setprecision(3)
@@ -6,9 +6,9 @@
  */
 
 // LArSoft includes
-#include "lardataalg/Utilities/StatCollector.h" // lar::util::MinMaxCollector<>
+#include "lardata/ArtDataHelper/Dumpers/DumpOutput.h"
+#include "lardata/ArtDataHelper/Dumpers/WireDumpers.h"
 #include "lardataobj/RecoBase/Wire.h"
-#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
 // art libraries
 #include "art/Framework/Core/EDAnalyzer.h"
@@ -25,29 +25,7 @@
 
 // C//C++ standard libraries
 #include <string>
-#include <ios> // std::fixed
-#include <iomanip> // std::setprecision(), std::setw()
-
-
-namespace {
-
-  // Copied from geo::PlaneGeo, local so far
-  std::string ViewName(geo::View_t view) {
-    switch (view) {
-      case geo::kU:       return "U";
-      case geo::kV:       return "V";
-      case geo::kZ:       return "Z";
-    //  case geo::kY:       return "Y";
-    //  case geo::kX:       return "X";
-      case geo::k3D:      return "3D";
-      case geo::kUnknown: return "?";
-      default:
-        return "<UNSUPPORTED (" + std::to_string((int) view) + ")>";
-    } // switch
-  } // ViewName()
-
-} // local namespace
-
+#include <utility> // std::forward(), std::move()
 
 
 namespace caldata {
@@ -67,6 +45,11 @@ namespace caldata {
    *   for the output (useful for filtering)
    * - *DigitsPerLine* (integer, default: `20`): the dump of digits and ticks
    *   will put this many of them for each line; `0` suppresses digit printout
+   * - *DumpMode* (string, default: `"text"`): `"text"` prints on screen;
+   *   `"binary"` writes the values into *DumpFile* (to be read with
+   *   `lardump_read`) and `"hash"` only computes them; in both cases, only a
+   *   digest of the wires of each event is printed
+   * - *DumpFile* (string, default: empty): output file of the `"binary"` mode
    */
   class DumpWires : public art::EDAnalyzer {
       public:
@@ -93,6 +76,18 @@ namespace caldata {
         20 /* default */
         };
 
+      fhicl::Atom<std::string> DumpMode{
+        Name("DumpMode"),
+        Comment("output: \"text\", \"binary\" (into DumpFile) or \"hash\""),
+        "text" /* default */
+        };
+
+      fhicl::Atom<std::string> DumpFile{
+        Name("DumpFile"),
+        Comment("name of the output file in \"binary\" mode"),
+        "" /* default */
+        };
+
     }; // Config
 
     using Parameters = art::EDAnalyzer::Table<Config>;
@@ -109,6 +104,7 @@ namespace caldata {
     art::InputTag fCalWireModuleLabel; ///< Input tag for wires.
     std::string fOutputCategory; ///< Category for `LogVerbatim` output.
     unsigned int fDigitsPerLine; ///< Ticks/digits per line in the output.
+    recob::dumper::DumpOutput fDumpOutput; ///< Binary or digest output.
 
     /// Dumps a single `recob:Wire` to the specified output stream.
     template <typename Stream>
@@ -130,6 +126,8 @@ caldata::DumpWires::DumpWires(Parameters const& config)
   , fCalWireModuleLabel(config().CalWireModuleLabel())
   , fOutputCategory    (config().OutputCategory())
   , fDigitsPerLine     (config().DigitsPerLine())
+  , fDumpOutput
+      (recob::dumper::ParseDumpMode(config().DumpMode()), config().DumpFile())
   {}
 
 
@@ -139,9 +137,24 @@ void caldata::DumpWires::analyze(art::Event const& evt) {
   auto const& Wires
     = *(evt.getValidHandle<std::vector<recob::Wire>>(fCalWireModuleLabel));
 
-  mf::LogVerbatim(fOutputCategory) << "Event " << evt.id()
-    << " contains " << Wires.size() << " '" << fCalWireModuleLabel.encode()
-    << "' wires";
+  if (!fDumpOutput.isText()) {
+    std::uint64_t const digest = fDumpOutput.dump(
+      evt.run(), evt.subRun(), evt.event(), fCalWireModuleLabel.encode(),
+      [this, &Wires](auto& out)
+        {
+          out << Wires.size();
+          for (recob::Wire const& wire: Wires) PrintWire(out, wire);
+        }
+      );
+    mf::LogVerbatim log(fOutputCategory);
+    recob::dumper::DumpWiresHeader
+      (log, evt.id(), Wires.size(), fCalWireModuleLabel);
+    log << "; digest: " << recob::dumper::DigestString(digest);
+    return;
+  } // if not text
+
+  recob::dumper::DumpWiresHeader(mf::LogVerbatim(fOutputCategory),
+    evt.id(), Wires.size(), fCalWireModuleLabel);
 
   for (recob::Wire const& wire: Wires) {
 
@@ -159,93 +172,8 @@ void caldata::DumpWires::PrintWire(
   std::string indent /* = "  " */, std::string firstIndent /* = "  " */
 ) const {
 
-  using RegionsOfInterest_t = recob::Wire::RegionsOfInterest_t;
-
-  RegionsOfInterest_t const & RoIs = wire.SignalROI();
-
-  //
-  // print a header for the wire
-  //
-  out << firstIndent << "channel #" << wire.Channel() << " on view "
-    << ViewName(wire.View()) << "; " << wire.NSignal() << " time ticks";
-  if (wire.NSignal() != RoIs.size())
-    out << " [!!! EXPECTED " << RoIs.size() << "]";
-  if (RoIs.n_ranges() == 0) {
-    out << " with nothing in them";
-    return;
-  }
-  out << " with " << RoIs.n_ranges() << " regions of interest:";
-
-  //
-  // print the list of regions of interest
-  //
-  for (RegionsOfInterest_t::datarange_t const& RoI: RoIs.get_ranges()) {
-    out << "\n" << indent
-      << "  from " << RoI.offset << " for " << RoI.size() << " ticks";
-  } // for
-
-  //
-  // print the content of the wire
-  //
-  if (fDigitsPerLine > 0) {
-
-    std::vector<RegionsOfInterest_t::value_type> DigitBuffer(fDigitsPerLine),
-      LastBuffer;
-
-    unsigned int repeat_count = 0; // additional lines like the last one
-    unsigned int index = 0;
-    lar::util::MinMaxCollector<RegionsOfInterest_t::value_type> Extrema;
-    out << "\n" << indent
-      << "  content of the wire (" << fDigitsPerLine << " ticks per line):";
-    auto iTick = RoIs.cbegin(), tend = RoIs.cend();
-    while (iTick != tend) {
-      // the next line will show at most fDigitsPerLine ticks
-      unsigned int line_size
-        = std::min(fDigitsPerLine, (unsigned int) RoIs.size() - index);
-      if (line_size == 0) break; // no more ticks
-
-      // fill the new buffer (iTick will move forward)
-      DigitBuffer.resize(line_size);
-      auto iBuf = DigitBuffer.begin(), bend = DigitBuffer.end();
-      while ((iBuf != bend) && (iTick != tend))
-        Extrema.add(*(iBuf++) = *(iTick++));
-      index += line_size;
-
-      // if the new buffer is the same as the old one, just mark it
-      if (DigitBuffer == LastBuffer) {
-        repeat_count += 1;
-        continue;
-      }
-
-      // if there are previous repeats, write that on screen
-      // before the new, different line
-      if (repeat_count > 0) {
-        out << "\n" << indent
-          << "  [ ... repeated " << repeat_count << " more times, "
-          << (repeat_count * LastBuffer.size()) << " ticks ]";
-        repeat_count = 0;
-      }
-
-      // dump the new line of ticks
-      out << "\n" << indent
-        << " " << std::fixed << std::setprecision(3);
-      for (auto digit: DigitBuffer) out << std::setw(8) << digit;
-
-      // quick way to assign DigitBuffer to LastBuffer
-      // (we don't care we lose the former)
-      std::swap(LastBuffer, DigitBuffer);
-
-    } // while
-    if (repeat_count > 0) {
-      out << "\n" << indent
-        << "  [ ... repeated " << repeat_count << " more times to the end ]";
-    }
-    if (Extrema.min() < Extrema.max()) {
-      out << "\n" << indent
-        << "    range of " << index
-        << " samples: [" << Extrema.min() << ";" << Extrema.max() << "]";
-    }
-  } // if dumping the ticks
+  recob::dumper::DumpWire(std::forward<Stream>(out), wire, fDigitsPerLine,
+    std::move(indent), std::move(firstIndent));
 
 } // caldata::DumpWires::PrintWire()
 
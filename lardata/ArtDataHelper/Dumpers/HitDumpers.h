@@ -0,0 +1,59 @@
+/**
+ * @file   HitDumpers.h
+ * @brief  Functions dumping hits
+ * @date   October 19, 2026
+ * @see    DumpHits_module.cc
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARDATA_ARTDATAHELPER_DUMPERS_HITDUMPERS_H
+#define LARDATA_ARTDATAHELPER_DUMPERS_HITDUMPERS_H 1
+
+// LArSoft libraries
+#include "lardataobj/RecoBase/Hit.h"
+
+// framework libraries
+#include "canvas/Utilities/InputTag.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+
+
+namespace recob {
+  namespace dumper {
+
+    /**
+     * @brief Dumps the line introducing the hits of an event
+     * @tparam Stream the type of the output stream
+     * @param out the output stream
+     * @param nHits number of hits in the collection
+     * @param tag input tag of the hit collection
+     */
+    template <typename Stream>
+    void DumpHitsHeader
+      (Stream&& out, std::size_t nHits, art::InputTag const& tag)
+    {
+      out << "The event contains " << nHits << " '" << tag.encode()
+        << "' hits";
+    }
+
+
+    /**
+     * @brief Dumps the content of the hit into a stream
+     * @tparam Stream the type of the output stream
+     * @param out the output stream
+     * @param hit the hit to be dumped
+     * @param iHit index of the hit in its collection
+     */
+    template <typename Stream>
+    void DumpHit(Stream&& out, recob::Hit const& hit, std::size_t iHit)
+      { out << "Hit #" << iHit << ": " << hit; }
+
+  } // namespace dumper
+} // namespace recob
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARDATA_ARTDATAHELPER_DUMPERS_HITDUMPERS_H
@@ -0,0 +1,103 @@
+/**
+ * @file   ParallelDump.cc
+ * @brief  Formatting of data product dumps on parallel threads - implementation
+ * @date   October 19, 2026
+ * @see    ParallelDump.h
+ */
+
+// LArSoft libraries
+#include "lardata/ArtDataHelper/Dumpers/ParallelDump.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max()
+#include <atomic>
+#include <exception> // std::exception_ptr
+#include <sstream>
+#include <thread>
+#include <utility> // std::move()
+
+
+//------------------------------------------------------------------------------
+recob::dumper::ParallelFormatter::ParallelFormatter
+  (unsigned int nThreads /* = 1U */, std::size_t chunkSize /* = 32U */)
+  : fNThreads(nThreads)
+  , fChunkSize(std::max<std::size_t>(chunkSize, 1U))
+{
+  if (fNThreads == 0)
+    fNThreads = std::max(std::thread::hardware_concurrency(), 1U);
+} // recob::dumper::ParallelFormatter::ParallelFormatter()
+
+
+//------------------------------------------------------------------------------
+std::size_t recob::dumper::ParallelFormatter::add
+  (std::size_t n, Print_t print)
+{
+  std::size_t const iProduct = fProducts.size();
+  std::size_t const nChunks = (n + fChunkSize - 1) / fChunkSize;
+  fProducts.push_back({ std::move(print), n, fChunks.size(), nChunks });
+  for (std::size_t first = 0; first < n; first += fChunkSize)
+    fChunks.push_back({ iProduct, first, std::min(n, first + fChunkSize), {}, {} });
+  return iProduct;
+} // recob::dumper::ParallelFormatter::add()
+
+
+//------------------------------------------------------------------------------
+void recob::dumper::ParallelFormatter::run() {
+
+  std::size_t const nWorkers
+    = std::min<std::size_t>(fNThreads, fChunks.size());
+  if (nWorkers <= 1U) {
+    for (Chunk& chunk: fChunks) format(chunk);
+    return;
+  }
+
+  // chunks are assigned on demand, since their cost varies a lot
+  std::atomic<std::size_t> nextChunk { 0U };
+  std::vector<std::exception_ptr> errors(nWorkers);
+  auto const work = [this, &nextChunk](std::exception_ptr& error)
+    {
+      try {
+        std::size_t iChunk;
+        while ((iChunk = nextChunk++) < fChunks.size()) format(fChunks[iChunk]);
+      }
+      catch (...) {
+        error = std::current_exception();
+        nextChunk = fChunks.size(); // stop the other workers
+      }
+    };
+
+  std::vector<std::thread> workers;
+  workers.reserve(nWorkers);
+  for (std::size_t iWorker = 0; iWorker < nWorkers; ++iWorker)
+    workers.emplace_back(work, std::ref(errors[iWorker]));
+  for (auto& worker: workers) worker.join();
+
+  for (std::exception_ptr const& error: errors)
+    if (error) std::rethrow_exception(error);
+
+} // recob::dumper::ParallelFormatter::run()
+
+
+//------------------------------------------------------------------------------
+void recob::dumper::ParallelFormatter::format(Chunk& chunk) const {
+
+  Print_t const& print = fProducts[chunk.product].print;
+
+  std::ostringstream const pristine; // format state of a new stream
+  std::ostringstream out;
+  chunk.text.clear();
+  chunk.ends.clear();
+  chunk.ends.reserve(chunk.last - chunk.first);
+  for (std::size_t i = chunk.first; i < chunk.last; ++i) {
+    out.str("");
+    out.clear();
+    out.copyfmt(pristine);
+    print(out, i);
+    chunk.text += out.str();
+    chunk.ends.push_back(chunk.text.size());
+  } // for
+
+} // recob::dumper::ParallelFormatter::format()
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,138 @@
+/**
+ * @file   ParallelDump.h
+ * @brief  Formatting of data product dumps on parallel threads
+ * @date   October 19, 2026
+ * @see    ParallelDump.cc DumpProducts_module.cc
+ *
+ * The dumper modules print each element of a collection (a wire, a hit...)
+ * into its own message, with a fresh stream. `ParallelFormatter` does the same
+ * formatting into memory buffers: the elements of all the products are split
+ * in chunks, each chunk is formatted by a thread into its own buffer, and the
+ * text of the elements is then delivered in the original order, whatever the
+ * order the chunks were processed in.
+ */
+
+#ifndef LARDATA_ARTDATAHELPER_DUMPERS_PARALLELDUMP_H
+#define LARDATA_ARTDATAHELPER_DUMPERS_PARALLELDUMP_H 1
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <functional> // std::function
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace recob {
+  namespace dumper {
+
+    /**
+     * @brief Formats the elements of several products on parallel threads.
+     *
+     * Usage example:
+     *
+     *     recob::dumper::ParallelFormatter formatter(4U);
+     *     std::size_t const iWires = formatter.add(wires.size(),
+     *       [&wires](std::ostream& out, std::size_t i)
+     *         { recob::dumper::DumpWire(out, wires[i], 20U); }
+     *       );
+     *     formatter.run();
+     *     formatter.forEach(iWires,
+     *       [](std::string_view text){ mf::LogVerbatim("DumpWires") << text; });
+     *
+     * Each element is formatted into a stream with the default format state,
+     * as if it were printed into a new message: manipulators like
+     * `std::setprecision()` do not leak from one element to the next.
+     * The printing functions are called concurrently, and they must not
+     * modify shared data.
+     */
+    class ParallelFormatter {
+        public:
+
+      /// Function printing the element with the specified index.
+      using Print_t = std::function<void(std::ostream&, std::size_t)>;
+
+      /**
+       * @brief Constructor.
+       * @param nThreads number of threads (`0`: as many as the hardware has)
+       * @param chunkSize number of elements formatted by a thread at a time
+       */
+      explicit ParallelFormatter
+        (unsigned int nThreads = 1U, std::size_t chunkSize = 32U);
+
+      /// Queues a product with `n` elements; returns the index of the product.
+      std::size_t add(std::size_t n, Print_t print);
+
+      /// Formats the elements of all the queued products.
+      /// @throw the first exception thrown by a printing function
+      void run();
+
+      /// Returns the number of queued products.
+      std::size_t nProducts() const { return fProducts.size(); }
+
+      /// Returns the number of elements in the product.
+      std::size_t size(std::size_t iProduct) const
+        { return fProducts.at(iProduct).size; }
+
+      /// Calls `emit(std::string_view)` with the text of each element of the
+      /// product, in order (after `run()`).
+      template <typename Emit>
+      void forEach(std::size_t iProduct, Emit&& emit) const;
+
+      /// Removes all the products and their text.
+      void clear() { fProducts.clear(); fChunks.clear(); }
+
+        private:
+
+      /// A range of elements of one product, and their text.
+      struct Chunk {
+        std::size_t product; ///< Index of the product.
+        std::size_t first;   ///< Index of the first element.
+        std::size_t last;    ///< Index after the last element.
+        std::string text;    ///< Text of all the elements in the chunk.
+        std::vector<std::size_t> ends; ///< End of the text of each element.
+      }; // Chunk
+
+      struct Product {
+        Print_t print;
+        std::size_t size;
+        std::size_t firstChunk;
+        std::size_t nChunks;
+      }; // Product
+
+      unsigned int fNThreads;
+      std::size_t fChunkSize;
+      std::vector<Product> fProducts;
+      std::vector<Chunk> fChunks; ///< Chunks of all products, in order.
+
+      /// Formats all the elements in the chunk.
+      void format(Chunk& chunk) const;
+
+    }; // class ParallelFormatter
+
+  } // namespace dumper
+} // namespace recob
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Emit>
+void recob::dumper::ParallelFormatter::forEach
+  (std::size_t iProduct, Emit&& emit) const
+{
+  Product const& product = fProducts.at(iProduct);
+  for (std::size_t iChunk = 0; iChunk < product.nChunks; ++iChunk) {
+    Chunk const& chunk = fChunks[product.firstChunk + iChunk];
+    std::string_view const text = chunk.text;
+    std::size_t begin = 0;
+    for (std::size_t end: chunk.ends) {
+      emit(text.substr(begin, end - begin));
+      begin = end;
+    }
+  } // for chunks
+} // recob::dumper::ParallelFormatter::forEach()
+
+
+#endif // LARDATA_ARTDATAHELPER_DUMPERS_PARALLELDUMP_H
@@ -0,0 +1,180 @@
+/**
+ * @file   RawDigitDumpers.h
+ * @brief  Functions dumping raw digits
+ * @date   October 19, 2026
+ * @see    DumpRawDigits_module.cc
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARDATA_ARTDATAHELPER_DUMPERS_RAWDIGITDUMPERS_H
+#define LARDATA_ARTDATAHELPER_DUMPERS_RAWDIGITDUMPERS_H 1
+
+// LArSoft libraries
+#include "lardataalg/Utilities/StatCollector.h" // lar::util::MinMaxCollector<>
+#include "lardataobj/RawData/RawDigit.h"
+#include "lardataobj/RawData/raw.h" // raw::Uncompress()
+
+// framework libraries
+#include "canvas/Persistency/Provenance/EventID.h"
+#include "canvas/Utilities/InputTag.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min()
+#include <cstddef> // std::size_t
+#include <iomanip> // std::setw()
+#include <string>
+#include <utility> // std::swap()
+#include <vector>
+
+
+namespace raw {
+  namespace dumper {
+
+    /**
+     * @brief Dumps the line introducing the raw digits of an event
+     * @tparam Stream the type of the output stream
+     * @param out the output stream
+     * @param eventID the event the raw digits belong to
+     * @param nDigits number of raw digits in the collection
+     * @param tag input tag of the raw digit collection
+     */
+    template <typename Stream>
+    void DumpRawDigitsHeader(
+      Stream&& out, art::EventID const& eventID, std::size_t nDigits,
+      art::InputTag const& tag
+      )
+    {
+      out << "Event " << eventID << " contains " << nDigits << " '"
+        << tag.encode() << "' waveforms";
+    }
+
+
+    /**
+     * @brief Dumps the content of the raw digits into a stream
+     * @tparam Stream the type of the output stream
+     * @param out the output stream
+     * @param digits the raw digits to be dumped
+     * @param digitsPerLine number of ticks per line (`0` skips the ticks)
+     * @param pedestal digit values are written relative to this number
+     * @param indent indentation of all the lines but the first one
+     * @param firstIndent indentation of the first line
+     *
+     * The digits are uncompressed; repeated lines are printed only once.
+     */
+    template <typename Stream>
+    void DumpRawDigit(
+      Stream&& out, raw::RawDigit const& digits,
+      unsigned int digitsPerLine,
+      raw::RawDigit::ADCvector_t::value_type pedestal = 0,
+      std::string indent = "  ", std::string firstIndent = "  "
+      );
+
+  } // namespace dumper
+} // namespace raw
+
+
+//==============================================================================
+//=== template implementation
+//===
+template <typename Stream>
+void raw::dumper::DumpRawDigit(
+  Stream&& out, raw::RawDigit const& digits,
+  unsigned int digitsPerLine,
+  raw::RawDigit::ADCvector_t::value_type pedestal /* = 0 */,
+  std::string indent /* = "  " */, std::string firstIndent /* = "  " */
+) {
+
+  using Digit_t = raw::RawDigit::ADCvector_t::value_type;
+
+  //
+  // uncompress the digits
+  //
+  raw::RawDigit::ADCvector_t ADCs(digits.Samples());
+  raw::Uncompress(digits.ADCs(), ADCs, digits.Compression());
+
+  //
+  // print a header for the raw digits
+  //
+  out << firstIndent
+    << "  #" << digits.Channel() << ": " << ADCs.size() << " time ticks";
+  if (digits.Samples() != ADCs.size())
+    out << " [!!! EXPECTED " << digits.Samples() << "] ";
+  out
+    << " (" << digits.NADC() << " after compression); compression type: ";
+  switch (digits.Compression()) {
+    case raw::kNone:            out << "no compression"; break;
+    case raw::kHuffman:         out << "Huffman encoding" ; break;
+    case raw::kZeroSuppression: out << "zero suppression"; break;
+    case raw::kZeroHuffman:     out << "zero suppression + Huffman encoding";
+                                break;
+    case raw::kDynamicDec:      out << "dynamic decimation"; break;
+    default:
+      out << "unknown (#" << ((int) digits.Compression()) << ")"; break;
+  } // switch
+
+  // print the content of the channel
+  if (digitsPerLine > 0) {
+    std::vector<Digit_t> DigitBuffer(digitsPerLine), LastBuffer;
+
+    unsigned int repeat_count = 0; // additional lines like the last one
+    unsigned int index = 0;
+    lar::util::MinMaxCollector<Digit_t> Extrema;
+    out << "\n" << indent
+      << "content of the channel (" << digitsPerLine << " ticks per line):";
+    auto iTick = ADCs.cbegin(), tend = ADCs.cend(); // const iterators
+    while (iTick != tend) {
+      // the next line will show at most digitsPerLine ticks
+      unsigned int line_size
+        = std::min(digitsPerLine, (unsigned int) ADCs.size() - index);
+      if (line_size == 0) break; // no more ticks
+
+      // fill the new buffer (iTick will move forward)
+      DigitBuffer.resize(line_size);
+      auto iBuf = DigitBuffer.begin(), bend = DigitBuffer.end();
+      while ((iBuf != bend) && (iTick != tend))
+        Extrema.add(*(iBuf++) = (*(iTick++) - pedestal));
+      index += line_size;
+
+      // if the new buffer is the same as the old one, just mark it
+      if (DigitBuffer == LastBuffer) {
+        repeat_count += 1;
+        continue;
+      }
+
+      // if there are previous repeats, write that on screen
+      // before the new, different line
+      if (repeat_count > 0) {
+        out << "\n" << indent
+          << "  [ ... repeated " << repeat_count << " more times, "
+          << (repeat_count * LastBuffer.size()) << " ticks ]";
+        repeat_count = 0;
+      }
+
+      // dump the new line of ticks
+      out << "\n" << indent << " ";
+      for (auto digit: DigitBuffer)
+        out << " " << std::setw(4) << digit;
+
+      // quick way to assign DigitBuffer to LastBuffer
+      // (we don't care we lose the former)
+      std::swap(LastBuffer, DigitBuffer);
+
+    } // while
+    if (repeat_count > 0) {
+      out << "\n" << indent
+        << "  [ ... repeated " << repeat_count << " more times to the end ]";
+    }
+    if (Extrema.min() < Extrema.max()) {
+      out << "\n" << indent
+        << "  range of " << index
+        << " samples: [" << Extrema.min() << ";" << Extrema.max() << "]";
+    }
+  } // if dumping the ticks
+
+} // raw::dumper::DumpRawDigit()
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARDATA_ARTDATAHELPER_DUMPERS_RAWDIGITDUMPERS_H
@@ -0,0 +1,193 @@
+/**
+ * @file   WireDumpers.h
+ * @brief  Functions dumping wires
+ * @date   October 19, 2026
+ * @see    DumpWires_module.cc
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARDATA_ARTDATAHELPER_DUMPERS_WIREDUMPERS_H
+#define LARDATA_ARTDATAHELPER_DUMPERS_WIREDUMPERS_H 1
+
+// LArSoft libraries
+#include "lardataalg/Utilities/StatCollector.h" // lar::util::MinMaxCollector<>
+#include "lardataobj/RecoBase/Wire.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// framework libraries
+#include "canvas/Persistency/Provenance/EventID.h"
+#include "canvas/Utilities/InputTag.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min()
+#include <cstddef> // std::size_t
+#include <ios> // std::fixed
+#include <iomanip> // std::setprecision(), std::setw()
+#include <string>
+#include <utility> // std::swap()
+#include <vector>
+
+
+namespace recob {
+  namespace dumper {
+
+    /// Returns the name of the view (copied from geo::PlaneGeo).
+    inline std::string ViewName(geo::View_t view) {
+      switch (view) {
+        case geo::kU:       return "U";
+        case geo::kV:       return "V";
+        case geo::kZ:       return "Z";
+      //  case geo::kY:       return "Y";
+      //  case geo::kX:       return "X";
+        case geo::k3D:      return "3D";
+        case geo::kUnknown: return "?";
+        default:
+          return "<UNSUPPORTED (" + std::to_string((int) view) + ")>";
+      } // switch
+    } // ViewName()
+
+
+    /**
+     * @brief Dumps the line introducing the wires of an event
+     * @tparam Stream the type of the output stream
+     * @param out the output stream
+     * @param eventID the event the wires belong to
+     * @param nWires number of wires in the collection
+     * @param tag input tag of the wire collection
+     */
+    template <typename Stream>
+    void DumpWiresHeader(
+      Stream&& out, art::EventID const& eventID, std::size_t nWires,
+      art::InputTag const& tag
+      )
+    {
+      out << "Event " << eventID << " contains " << nWires << " '"
+        << tag.encode() << "' wires";
+    }
+
+
+    /**
+     * @brief Dumps the content of the wire into a stream
+     * @tparam Stream the type of the output stream
+     * @param out the output stream
+     * @param wire the wire to be dumped
+     * @param digitsPerLine number of ticks per line (`0` skips the ticks)
+     * @param indent indentation of all the lines but the first one
+     * @param firstIndent indentation of the first line
+     *
+     * Repeated lines of ticks are printed only once.
+     */
+    template <typename Stream>
+    void DumpWire(
+      Stream&& out, recob::Wire const& wire, unsigned int digitsPerLine,
+      std::string indent = "  ", std::string firstIndent = "  "
+      );
+
+  } // namespace dumper
+} // namespace recob
+
+
+//==============================================================================
+//=== template implementation
+//===
+template <typename Stream>
+void recob::dumper::DumpWire(
+  Stream&& out, recob::Wire const& wire, unsigned int digitsPerLine,
+  std::string indent /* = "  " */, std::string firstIndent /* = "  " */
+) {
+
+  using RegionsOfInterest_t = recob::Wire::RegionsOfInterest_t;
+
+  RegionsOfInterest_t const & RoIs = wire.SignalROI();
+
+  //
+  // print a header for the wire
+  //
+  out << firstIndent << "channel #" << wire.Channel() << " on view "
+    << ViewName(wire.View()) << "; " << wire.NSignal() << " time ticks";
+  if (wire.NSignal() != RoIs.size())
+    out << " [!!! EXPECTED " << RoIs.size() << "]";
+  if (RoIs.n_ranges() == 0) {
+    out << " with nothing in them";
+    return;
+  }
+  out << " with " << RoIs.n_ranges() << " regions of interest:";
+
+  //
+  // print the list of regions of interest
+  //
+  for (RegionsOfInterest_t::datarange_t const& RoI: RoIs.get_ranges()) {
+    out << "\n" << indent
+      << "  from " << RoI.offset << " for " << RoI.size() << " ticks";
+  } // for
+
+  //
+  // print the content of the wire
+  //
+  if (digitsPerLine > 0) {
+
+    std::vector<RegionsOfInterest_t::value_type> DigitBuffer(digitsPerLine),
+      LastBuffer;
+
+    unsigned int repeat_count = 0; // additional lines like the last one
+    unsigned int index = 0;
+    lar::util::MinMaxCollector<RegionsOfInterest_t::value_type> Extrema;
+    out << "\n" << indent
+      << "  content of the wire (" << digitsPerLine << " ticks per line):";
+    auto iTick = RoIs.cbegin(), tend = RoIs.cend();
+    while (iTick != tend) {
+      // the next line will show at most digitsPerLine ticks
+      unsigned int line_size
+        = std::min(digitsPerLine, (unsigned int) RoIs.size() - index);
+      if (line_size == 0) break; // no more ticks
+
+      // fill the new buffer (iTick will move forward)
+      DigitBuffer.resize(line_size);
+      auto iBuf = DigitBuffer.begin(), bend = DigitBuffer.end();
+      while ((iBuf != bend) && (iTick != tend))
+        Extrema.add(*(iBuf++) = *(iTick++));
+      index += line_size;
+
+      // if the new buffer is the same as the old one, just mark it
+      if (DigitBuffer == LastBuffer) {
+        repeat_count += 1;
+        continue;
+      }
+
+      // if there are previous repeats, write that on screen
+      // before the new, different line
+      if (repeat_count > 0) {
+        out << "\n" << indent
+          << "  [ ... repeated " << repeat_count << " more times, "
+          << (repeat_count * LastBuffer.size()) << " ticks ]";
+        repeat_count = 0;
+      }
+
+      // dump the new line of ticks
+      out << "\n" << indent
+        << " " << std::fixed << std::setprecision(3);
+      for (auto digit: DigitBuffer) out << std::setw(8) << digit;
+
+      // quick way to assign DigitBuffer to LastBuffer
+      // (we don't care we lose the former)
+      std::swap(LastBuffer, DigitBuffer);
+
+    } // while
+    if (repeat_count > 0) {
+      out << "\n" << indent
+        << "  [ ... repeated " << repeat_count << " more times to the end ]";
+    }
+    if (Extrema.min() < Extrema.max()) {
+      out << "\n" << indent
+        << "    range of " << index
+        << " samples: [" << Extrema.min() << ";" << Extrema.max() << "]";
+    }
+  } // if dumping the ticks
+
+} // recob::dumper::DumpWire()
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARDATA_ARTDATAHELPER_DUMPERS_WIREDUMPERS_H
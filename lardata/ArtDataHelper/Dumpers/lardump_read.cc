@@ -0,0 +1,83 @@
+/**
+ * @file   lardump_read.cc
+ * @brief  Prints the content of the binary files of the dumper modules
+ * @date   October 19, 2026
+ * @see    DumpOutput.h
+ *
+ * Usage:
+ *
+ *     lardump_read [--digest] DumpFile [DumpFile ...]
+ *
+ * Each block (one data product in one event) is printed with a header line
+ * and then one line per record, with its type tag (see `recob::dumper::record`)
+ * and its value. With `--digest`, only the header lines are printed, with the
+ * digest of each block: it is the same digest the module prints in `"hash"`
+ * mode, so that a binary dump can be compared with a digest-only one.
+ */
+
+// LArSoft libraries
+#include "lardata/ArtDataHelper/Dumpers/DumpOutput.h"
+
+// support libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  bool digestOnly = false;
+  std::vector<std::string> fileNames;
+  for (int iArg = 1; iArg < argc; ++iArg) {
+    std::string const arg = argv[iArg];
+    if (arg == "--digest") digestOnly = true;
+    else if ((arg == "-h") || (arg == "--help")) {
+      std::cout << "Usage:  " << argv[0] << " [--digest] DumpFile [DumpFile ...]"
+        << std::endl;
+      return 0;
+    }
+    else fileNames.push_back(arg);
+  } // for
+
+  if (fileNames.empty()) {
+    std::cerr << "Usage:  " << argv[0] << " [--digest] DumpFile [DumpFile ...]"
+      << std::endl;
+    return 1;
+  }
+
+  try {
+    for (std::string const& fileName: fileNames) {
+      if (fileNames.size() > 1) std::cout << "File '" << fileName << "'\n";
+
+      recob::dumper::DumpFileReader reader(fileName);
+      recob::dumper::DumpBlock block;
+      while (reader.next(block)) {
+        std::cout << "Run " << block.run << " subrun " << block.subRun
+          << " event " << block.event << " '" << block.label << "'";
+        if (digestOnly) {
+          std::cout << " digest: "
+            << recob::dumper::DigestString(recob::dumper::HashRecords(block.records))
+            << "\n";
+          continue;
+        }
+        std::cout << ":\n";
+        std::size_t const nRecords = recob::dumper::DecodeRecords(
+          block.records,
+          [](char tag, std::string const& value)
+            { std::cout << "  " << tag << " " << value << "\n"; }
+          );
+        std::cout << "  (" << nRecords << " records)\n";
+      } // while
+    } // for files
+  }
+  catch (cet::exception const& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+} // main()
@@ -15,6 +15,11 @@
 
 #include "lardata/ArtDataHelper/MVAWrapperBase.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <type_traits>
+
 namespace anab {
 
 /// Index to the MVA output / FeatureVector collection, used when result vectors are added or set.
@@ -60,6 +65,23 @@ public:
     void setVector(FVector_ID id, size_t key, std::vector<float> const & values) { (*(fVectors[id]))[key] = values; }
     void setVector(FVector_ID id, size_t key, std::vector<double> const & values) { (*(fVectors[id]))[key] = values; }
 
+    /// Set feature vectors for nKeys consecutive items, starting from firstKey, reading
+    /// N values per item from the contiguous buffer (e.g. the output tensor of a network
+    /// evaluated on all the items in one go: values[(key - firstKey) * N + i]).
+    /// Throws if the range does not fit in the container prepared with initOutputs().
+    void setVectors(FVector_ID id, size_t firstKey, float const * values, size_t nKeys);
+
+    /// Set all feature vectors from the contiguous buffer; its size must be size(id) * N.
+    void setVectors(FVector_ID id, std::vector<float> const & values)
+    {
+        if (values.size() != size(id) * N)
+        {
+            throw cet::exception("FVectorWriter") << "Buffer of " << values.size() << " values does not match the "
+                << size(id) << " vectors of length " << N << std::endl;
+        }
+        setVectors(id, 0, values.data(), size(id));
+    }
+
 
     /// Initialize container for FeatureVectors and, if not yet done, the container for
     /// metadata, then creates metadata for data products of type T. FeatureVector container
@@ -80,6 +102,17 @@ public:
     void addVector(FVector_ID id, std::vector<float> const & values) { fVectors[id]->emplace_back(values); }
     void addVector(FVector_ID id, std::vector<double> const & values) { fVectors[id]->emplace_back(values); }
 
+    /// Append nKeys feature vectors, reading N values per item from the contiguous buffer.
+    /// The container is grown once, then filled in place.
+    void addVectors(FVector_ID id, float const * values, size_t nKeys);
+
+    /// Append feature vectors from the contiguous buffer; its size must be a multiple of N.
+    void addVectors(FVector_ID id, std::vector<float> const & values)
+    { checkBufferSize(values.size()); addVectors(id, values.data(), values.size() / N); }
+
+    /// Reserve space for n feature vectors, to be filled with addVector() calls.
+    void reserveVectors(FVector_ID id, size_t n) { fVectors[id]->reserve(n); }
+
     /// Set tag of associated data products in case it was not ready at the initialization time.
     void setDataTag(FVector_ID id, art::InputTag const & dataTag) { (*fDescriptions)[id].setDataTag(dataTag.encode()); }
 
@@ -147,6 +180,18 @@ private:
         fDescriptions.reset(nullptr);
     }
 
+    /// Copy nKeys feature vectors from the buffer into the container, starting at dest.
+    static void copyVectors(anab::FeatureVector<N> * dest, float const * values, size_t nKeys);
+
+    /// Throw if the buffer size is not a multiple of N.
+    static void checkBufferSize(size_t size)
+    {
+        if (size % N)
+        {
+            throw cet::exception("FVectorWriter") << "Buffer of " << size << " values is not a multiple of the vector length " << N << std::endl;
+        }
+    }
+
     /// Check if the the writer is configured to write results for data product type name.
     bool dataTypeRegistered(const std::string & dname) const;
     /// Check if the containers for results prepared for "tname" data type are ready.
@@ -182,6 +227,12 @@ public:
     void addOutput(FVector_ID id, std::vector<float> const & values) { FVectorWriter<N>::addVector(id, values); }
     void addOutput(FVector_ID id, std::vector<double> const & values) { FVectorWriter<N>::addVector(id, values); }
 
+    /// Bulk versions of setOutput() / addOutput(), taking N values per item from a contiguous buffer.
+    void setOutputs(FVector_ID id, size_t firstKey, float const * values, size_t nKeys) { FVectorWriter<N>::setVectors(id, firstKey, values, nKeys); }
+    void setOutputs(FVector_ID id, std::vector<float> const & values) { FVectorWriter<N>::setVectors(id, values); }
+    void addOutputs(FVector_ID id, float const * values, size_t nKeys) { FVectorWriter<N>::addVectors(id, values, nKeys); }
+    void addOutputs(FVector_ID id, std::vector<float> const & values) { FVectorWriter<N>::addVectors(id, values); }
+
 
     /// Get MVA results accumulated over the vector of items (eg. over hits associated to a cluster).
     /// NOTE: MVA outputs for these items has to be added to the MVAWriter first!
@@ -321,6 +372,53 @@ anab::FVector_ID anab::FVectorWriter<N>::initOutputs(
 }
 //----------------------------------------------------------------------------
 
+template <size_t N>
+void anab::FVectorWriter<N>::copyVectors(
+    anab::FeatureVector<N> * dest, float const * values, size_t nKeys)
+{
+    if constexpr (std::is_trivially_copyable_v< anab::FeatureVector<N> >
+        && (sizeof(anab::FeatureVector<N>) == N * sizeof(float)))
+    {
+        // FeatureVector<N> is just N floats: the buffer is already in the final layout
+        std::memcpy(static_cast<void*>(dest), values, nKeys * N * sizeof(float));
+    }
+    else
+    {
+        std::array<float, N> vec;
+        for (size_t k = 0; k < nKeys; ++k, values += N)
+        {
+            std::copy(values, values + N, vec.begin());
+            dest[k] = vec;
+        }
+    }
+}
+//----------------------------------------------------------------------------
+
+template <size_t N>
+void anab::FVectorWriter<N>::setVectors(
+    FVector_ID id, size_t firstKey, float const * values, size_t nKeys)
+{
+    auto & vectors = *(fVectors[id]);
+    if (firstKey + nKeys > vectors.size())
+    {
+        throw cet::exception("FVectorWriter") << "Cannot set vectors [" << firstKey << ", " << (firstKey + nKeys)
+            << "): only " << vectors.size() << " vectors were initialized" << std::endl;
+    }
+    if (nKeys) { copyVectors(vectors.data() + firstKey, values, nKeys); }
+}
+//----------------------------------------------------------------------------
+
+template <size_t N>
+void anab::FVectorWriter<N>::addVectors(
+    FVector_ID id, float const * values, size_t nKeys)
+{
+    auto & vectors = *(fVectors[id]);
+    size_t const firstKey = vectors.size();
+    vectors.resize(firstKey + nKeys, anab::FeatureVector<N>(0.0F));
+    if (nKeys) { copyVectors(vectors.data() + firstKey, values, nKeys); }
+}
+//----------------------------------------------------------------------------
+
 template <size_t N>
 void anab::FVectorWriter<N>::saveOutputs(art::Event & evt)
 {
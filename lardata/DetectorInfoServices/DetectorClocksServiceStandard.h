@@ -84,6 +84,7 @@ namespace detinfo {
   class DetectorClocksServiceStandard : public DetectorClocksService {
   public:
     DetectorClocksServiceStandard(fhicl::ParameterSet const& pset, art::ActivityRegistry& reg);
+    ~DetectorClocksServiceStandard() override;
 
   private:
     void preBeginRun(art::Run const& run);
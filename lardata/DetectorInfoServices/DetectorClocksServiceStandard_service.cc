@@ -7,23 +7,13 @@
 #include "art/Framework/Services/Registry/ServiceHandle.h"
 #include "art/Framework/Services/Registry/ServiceMacros.h"
 #include "art/Persistency/Provenance/ScheduleContext.h"
-#include "art_root_io/RootDB/SQLite3Wrapper.h"
-#include "canvas/Persistency/Provenance/FileFormatVersion.h"
-#include "canvas/Persistency/Provenance/ParameterSetMap.h"
-#include "canvas/Persistency/Provenance/rootNames.h"
 #include "cetlib_except/exception.h"
 #include "fhiclcpp/ParameterSet.h"
-#include "fhiclcpp/make_ParameterSet.h"
 #include "lardata/DetectorInfoServices/DetectorClocksService.h"
+#include "lardata/DetectorInfoServices/InputFileMetadataCache.h"
 #include "lardataalg/DetectorInfo/DetectorClocksStandard.h"
 #include "lardataalg/DetectorInfo/DetectorClocksStandardDataFor.h"
 
-#include "TFile.h"
-#include "TTree.h"
-
-#include "art_root_io/Inputfwd.h"
-#include "art_root_io/detail/readMetadata.h"
-
 #include <bitset>
 #include <string>
 #include <vector>
@@ -36,10 +26,23 @@ namespace detinfo {
                                                                art::ActivityRegistry& reg)
     : fClocks{pset}, fInheritClockConfig{pset.get<bool>("InheritClockConfig")}
   {
+    if (fInheritClockConfig) {
+      // the input file is read once for all the services needing it
+      InputFileMetadataCache::instance().registerConsumer(
+        "DetectorClocksServiceStandard",
+        [this](fhicl::ParameterSet const& ps) { return fClocks.IsRightConfig(ps); });
+    }
     reg.sPostOpenFile.watch(this, &DetectorClocksServiceStandard::postOpenFile);
     reg.sPreBeginRun.watch(this, &DetectorClocksServiceStandard::preBeginRun);
   }
 
+  DetectorClocksServiceStandard::~DetectorClocksServiceStandard()
+  {
+    // the selection function refers to this service
+    if (fInheritClockConfig)
+      InputFileMetadataCache::instance().unregisterConsumer("DetectorClocksServiceStandard");
+  }
+
   void
   DetectorClocksServiceStandard::preBeginRun(art::Run const& run)
   {
@@ -52,17 +55,12 @@ namespace detinfo {
   {
     if (!fInheritClockConfig) { return; }
     if (filename.empty()) { return; }
-    std::unique_ptr<TFile> file{TFile::Open(filename.c_str(), "READ")};
-    if (!file || file->IsZombie() || !file->IsOpen()) { return; }
-    std::unique_ptr<TTree> metaDataTree{
-      file->Get<TTree>(art::rootNames::metaDataTreeName().c_str())};
-    if (metaDataTree == nullptr) {
+    auto const metadata = InputFileMetadataCache::instance().metadata(filename);
+    if (!metadata->open) { return; }
+    if (!metadata->hasMetaDataTree) {
       throw cet::exception("DetectorClocksServiceStandard",
                            "Input file does not contain a metadata tree!");
     }
-    auto const fileFormatVersion =
-      art::detail::readMetadata<art::FileFormatVersion>(metaDataTree.get());
-    fhicl::ParameterSet ps;
     vector<string> const cfgName(fClocks.ConfigNames());
     vector<double> const cfgValue(fClocks.ConfigValues());
     bitset<kConfigTypeMax> config_set;
@@ -84,34 +82,9 @@ namespace detinfo {
         }
       };
 
-    if (fileFormatVersion.value_ < 5) {
-      art::ParameterSetMap psetMap;
-      if (!art::detail::readMetadata(metaDataTree.get(), psetMap)) {
-        throw cet::exception("DetectorClocksServiceStandard",
-                             "Could not read ParameterSetMap from metadata tree!");
-      }
-
-      for (auto const& psEntry : psetMap) {
-        fhicl::ParameterSet ps;
-        fhicl::make_ParameterSet(psEntry.second.pset_, ps);
-        if (!fClocks.IsRightConfig(ps)) { continue; }
-
-        count_configuration_changes(ps);
-      }
-    }
-    else {
-      art::SQLite3Wrapper sqliteDB(file.get(), "RootFileDB");
-      sqlite3_stmt* stmt{nullptr};
-      sqlite3_prepare_v2(sqliteDB, "SELECT PSetBlob from ParameterSets;", -1, &stmt, nullptr);
-      while (sqlite3_step(stmt) == SQLITE_ROW) {
-        fhicl::ParameterSet ps;
-        fhicl::make_ParameterSet(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0)), ps);
-        if (!fClocks.IsRightConfig(ps)) { continue; }
-
-        count_configuration_changes(ps);
-      }
-      sqlite3_finalize(stmt);
-    }
+    // the parameter sets passing IsRightConfig(), as stored in the file
+    for (auto const& ps : metadata->parameterSets("DetectorClocksServiceStandard"))
+      count_configuration_changes(ps);
 
     for (size_t i = 0; i < kConfigTypeMax; ++i) {
       if (not config_set[i]) continue;
@@ -11,7 +11,9 @@
 
 #include "art/Framework/Principal/fwd.h"
 #include "art/Framework/Services/Registry/ServiceMacros.h"
+#include "larcorealg/Geometry/GeometryCore.h"
 #include "lardata/DetectorInfoServices/DetectorClocksService.h"
+#include "lardata/DetectorInfoServices/DetectorPropertiesSnapshot.h"
 #include "lardataalg/DetectorInfo/DetectorProperties.h"
 #include "lardataalg/DetectorInfo/DetectorPropertiesData.h"
 
@@ -48,6 +50,23 @@ namespace detinfo {
       return getDataFor(e, clockData);
     }
 
+    /// Compiles the properties of the job into a flat snapshot.
+    DetectorPropertiesSnapshot
+    SnapshotForJob(
+      geo::GeometryCore const& geom,
+      std::vector<DetectorPropertiesSnapshot::ElossCurveSpec> const& curves = {}) const
+    {
+      return makeDetectorPropertiesSnapshot(DataForJob(), geom, curves);
+    }
+    /// Compiles the properties of the event into a flat snapshot.
+    DetectorPropertiesSnapshot
+    SnapshotFor(art::Event const& e,
+                geo::GeometryCore const& geom,
+                std::vector<DetectorPropertiesSnapshot::ElossCurveSpec> const& curves = {}) const
+    {
+      return makeDetectorPropertiesSnapshot(DataFor(e), geom, curves);
+    }
+
   private:
     virtual DetectorPropertiesData getDataForJob(
       detinfo::DetectorClocksData const& clockData) const = 0;
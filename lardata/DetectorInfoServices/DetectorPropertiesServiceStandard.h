@@ -57,6 +57,7 @@ namespace detinfo {
     using Parameters = art::ServiceTable<ServiceConfiguration_t>;
 
     DetectorPropertiesServiceStandard(fhicl::ParameterSet const& pset, art::ActivityRegistry& reg);
+    ~DetectorPropertiesServiceStandard() override;
 
   private:
     DetectorPropertiesData
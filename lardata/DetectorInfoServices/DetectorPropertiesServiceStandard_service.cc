@@ -9,13 +9,13 @@
 #include "larcore/Geometry/Geometry.h"
 #include "lardata/DetectorInfoServices/DetectorClocksService.h"
 #include "lardata/DetectorInfoServices/DetectorPropertiesServiceStandard.h"
+#include "lardata/DetectorInfoServices/InputFileMetadataCache.h"
 #include "lardata/DetectorInfoServices/LArPropertiesService.h"
 #include "lardata/DetectorInfoServices/ServicePack.h" // lar::extractProviders()
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
 // Art includes
-#include "art_root_io/RootDB/SQLite3Wrapper.h"
-#include "fhiclcpp/make_ParameterSet.h"
+#include "fhiclcpp/ParameterSet.h"
 
 namespace detinfo {
 
@@ -30,9 +30,23 @@ namespace detinfo {
     , fPS{pset}
     , fInheritNumberTimeSamples{pset.get<bool>("InheritNumberTimeSamples", false)}
   {
+    if (fInheritNumberTimeSamples) {
+      // the input file is read once for all the services needing it
+      InputFileMetadataCache::instance().registerConsumer(
+        "DetectorPropertiesServiceStandard",
+        [this](fhicl::ParameterSet const& ps) { return isDetectorPropertiesServiceStandard(ps); });
+    }
     reg.sPostOpenFile.watch(this, &DetectorPropertiesServiceStandard::postOpenFile);
   }
 
+  //--------------------------------------------------------------------
+  DetectorPropertiesServiceStandard::~DetectorPropertiesServiceStandard()
+  {
+    // the selection function refers to this service
+    if (fInheritNumberTimeSamples)
+      InputFileMetadataCache::instance().unregisterConsumer("DetectorPropertiesServiceStandard");
+  }
+
   //--------------------------------------------------------------------
   //  Callback called after input file is opened.
 
@@ -65,50 +79,39 @@ namespace detinfo {
 
     if (!fInheritNumberTimeSamples) return;
 
-    // The only way to access art service metadata from the input file
-    // is to open it as a separate TFile object.  Do that now.
+    // The art service metadata from the input file is read once for all the
+    // services which need it (see InputFileMetadataCache).
 
     if (filename.empty()) { return; }
 
-    std::unique_ptr<TFile> file{TFile::Open(filename.c_str(), "READ")};
-    if (!file) { return; }
-
-    if (file->IsZombie() || !file->IsOpen()) { return; }
-
-    // Open the sqlite datatabase.
-
-    art::SQLite3Wrapper sqliteDB(file.get(), "RootFileDB");
+    auto const metadata = InputFileMetadataCache::instance().metadata(filename);
+    if (!metadata->open) { return; }
 
     // Loop over all stored ParameterSets.
 
     unsigned int iNumberTimeSamples = 0; // Combined value of NumberTimeSamples.
     unsigned int nNumberTimeSamples = 0; // Number of NumberTimeSamples parameters seen.
 
-    sqlite3_stmt* stmt = nullptr;
-    sqlite3_prepare_v2(sqliteDB, "SELECT PSetBlob from ParameterSets;", -1, &stmt, nullptr);
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
-      fhicl::ParameterSet ps;
-      fhicl::make_ParameterSet(reinterpret_cast<char const*>(sqlite3_column_text(stmt, 0)), ps);
-      // Is this a DetectorPropertiesService parameter set?
-
-      if (isDetectorPropertiesServiceStandard(ps)) {
+    // These are the parameter sets which look like DetectorPropertiesService
+    // configurations (isDetectorPropertiesServiceStandard()).
+    for (fhicl::ParameterSet const& ps :
+         metadata->parameterSets("DetectorPropertiesServiceStandard")) {
 
-        // Check NumberTimeSamples
+      // Check NumberTimeSamples
 
-        auto const newNumberTimeSamples = ps.get<unsigned int>("NumberTimeSamples");
+      auto const newNumberTimeSamples = ps.get<unsigned int>("NumberTimeSamples");
 
-        // Ignore parameter values that match the current configuration.
+      // Ignore parameter values that match the current configuration.
 
-        if (newNumberTimeSamples != fPS.get<unsigned int>("NumberTimeSamples")) {
-          if (nNumberTimeSamples == 0)
-            iNumberTimeSamples = newNumberTimeSamples;
-          else if (newNumberTimeSamples != iNumberTimeSamples) {
-            throw cet::exception(__FUNCTION__)
-              << "Historical values of NumberTimeSamples do not agree: " << iNumberTimeSamples
-              << " " << newNumberTimeSamples << "\n";
-          }
-          ++nNumberTimeSamples;
+      if (newNumberTimeSamples != fPS.get<unsigned int>("NumberTimeSamples")) {
+        if (nNumberTimeSamples == 0)
+          iNumberTimeSamples = newNumberTimeSamples;
+        else if (newNumberTimeSamples != iNumberTimeSamples) {
+          throw cet::exception(__FUNCTION__)
+            << "Historical values of NumberTimeSamples do not agree: " << iNumberTimeSamples
+            << " " << newNumberTimeSamples << "\n";
         }
+        ++nNumberTimeSamples;
       }
     }
 
@@ -0,0 +1,265 @@
+/**
+ * @file   lardata/DetectorInfoServices/DetectorPropertiesSnapshot.h
+ * @brief  Flat, precomputed copy of the detector properties of an event
+ * @date   October 19, 2026
+ *
+ * This is a header-only library.
+ */
+
+#ifndef LARDATA_DETECTORINFOSERVICES_DETECTORPROPERTIESSNAPSHOT_H
+#define LARDATA_DETECTORINFOSERVICES_DETECTORPROPERTIESSNAPSHOT_H
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace detinfo {
+
+  /**
+   * @brief Detector properties of one event, compiled into plain tables.
+   *
+   * `detinfo::DetectorPropertiesData` answers each query by asking its
+   * provider, which recomputes the answer every time. A snapshot holds the
+   * results of the queries reconstruction needs per hit and per step:
+   *
+   * * the x to ticks conversion of each plane, as the affine coefficients
+   *   `ticks = x / coefficient + offset`; the conversions give the same
+   *   result as `DetectorPropertiesData::ConvertXToTicks()` and
+   *   `ConvertTicksToX()`, which use the same formula;
+   * * drift velocity, electric field, temperature and readout parameters;
+   * * energy loss curves (mean and variance) tabulated for a few
+   *   mass and delta ray cut hypotheses, interpolated linearly in the
+   *   logarithm of the momentum.
+   *
+   * The snapshot is trivially copyable and has no pointer nor virtual
+   * function, so it can be copied into each thread or algorithm and queried
+   * in tight loops. It is large (tens of kilobytes): pass it by reference.
+   *
+   * It is created by `makeDetectorPropertiesSnapshot()`, usually via
+   * `detinfo::DetectorPropertiesService::SnapshotFor()` once per event,
+   * with the geometry from `lar::providerFrom<geo::Geometry>()`.
+   * The tabulated energy loss is an approximation: check `inRange()` and
+   * fall back to the `DetectorPropertiesData` outside the tabulated range.
+   */
+  struct DetectorPropertiesSnapshot {
+
+    /// Maximum number of (cryostat, TPC, plane) entries.
+    static constexpr unsigned int MaxPlanes = 1024U;
+
+    /// Maximum number of tabulated energy loss curves.
+    static constexpr unsigned int MaxElossCurves = 4U;
+
+    /// Number of momentum points in each energy loss curve.
+    static constexpr unsigned int NElossPoints = 256U;
+
+    /// Parameters of a tabulated energy loss curve.
+    struct ElossCurveSpec {
+      double mass;           ///< Particle mass [GeV/c^2].
+      double tcut;           ///< Maximum delta ray energy [GeV].
+      double pMin = 0.01;    ///< Lowest tabulated momentum [GeV/c].
+      double pMax = 100.0;   ///< Highest tabulated momentum [GeV/c].
+    };
+
+    /// Conversion between x and ticks on one plane.
+    struct PlaneConversion {
+      double coefficient = 0.0; ///< Drift distance per tick [cm], with sign.
+      double offset = 0.0;      ///< Tick of x = 0.
+    };
+
+    /// Energy loss and its variance, tabulated versus log(momentum).
+    struct ElossCurve {
+      double mass = 0.0;
+      double tcut = 0.0;
+      double logPMin = 0.0;       ///< Natural logarithm of the first momentum.
+      double logPMax = 0.0;       ///< Natural logarithm of the last momentum.
+      double invLogStep = 0.0;    ///< Inverse of the logarithmic step.
+      double eloss[NElossPoints] = {};    ///< Mean energy loss [MeV/cm].
+      double elossVar[NElossPoints] = {}; ///< Energy loss variance [MeV^2/cm].
+
+      /// Returns whether the momentum is within the tabulated range.
+      bool inRange(double mom) const
+      {
+        double const logP = std::log(mom);
+        return (logP >= logPMin) && (logP <= logPMax);
+      }
+
+      /// Returns the interpolated mean energy loss [MeV/cm].
+      double Eloss(double mom) const { return interpolate(eloss, mom); }
+
+      /// Returns the interpolated energy loss variance [MeV^2/cm].
+      double ElossVar(double mom) const { return interpolate(elossVar, mom); }
+
+    private:
+      double interpolate(double const* table, double mom) const
+      {
+        double const u = (std::log(mom) - logPMin) * invLogStep;
+        int i = static_cast<int>(u);
+        if (i < 0) i = 0;
+        if (i > int(NElossPoints) - 2) i = int(NElossPoints) - 2;
+        double const f = u - i;
+        return table[i] + f * (table[i + 1] - table[i]);
+      }
+    }; // ElossCurve
+
+    //--- scalar properties
+    double temperature = 0.0;      ///< Argon temperature [K].
+    double efield[3] = {};         ///< Electric field in the first gaps [kV/cm].
+    double driftVelocity = 0.0;    ///< Drift velocity at nominal field [cm/us].
+    double electronLifetime = 0.0; ///< Electron lifetime [us].
+    unsigned int numberTimeSamples = 0U;
+    unsigned int readOutWindowSize = 0U;
+
+    //--- plane conversions, indexed by (cryostat, TPC, plane)
+    unsigned int nCryostats = 0U;
+    unsigned int maxTPCs = 0U;   ///< Largest number of TPCs in a cryostat.
+    unsigned int maxPlanes = 0U; ///< Largest number of planes in a TPC.
+    PlaneConversion planes[MaxPlanes] = {};
+
+    //--- energy loss
+    unsigned int nElossCurves = 0U;
+    ElossCurve elossCurves[MaxElossCurves] = {};
+
+    /// Returns the conversion of the specified plane (no range check).
+    PlaneConversion const& Plane(unsigned int p, unsigned int t = 0, unsigned int c = 0) const
+    {
+      return planes[(c * maxTPCs + t) * maxPlanes + p];
+    }
+
+    /// Same as `DetectorPropertiesData::ConvertXToTicks()`.
+    double ConvertXToTicks(double X, unsigned int p, unsigned int t = 0, unsigned int c = 0) const
+    {
+      PlaneConversion const& conv = Plane(p, t, c);
+      return X / conv.coefficient + conv.offset;
+    }
+
+    /// Same as `DetectorPropertiesData::ConvertTicksToX()`.
+    double ConvertTicksToX(double ticks, unsigned int p, unsigned int t = 0, unsigned int c = 0)
+      const
+    {
+      PlaneConversion const& conv = Plane(p, t, c);
+      return (ticks - conv.offset) * conv.coefficient;
+    }
+
+    /// Same as `DetectorPropertiesData::GetXTicksOffset()`.
+    double GetXTicksOffset(unsigned int p, unsigned int t = 0, unsigned int c = 0) const
+    {
+      return Plane(p, t, c).offset;
+    }
+
+    /// Returns the index of the curve for mass and cut (-1 if not tabulated).
+    int ElossCurveIndex(double mass, double tcut) const
+    {
+      for (unsigned int i = 0; i < nElossCurves; ++i) {
+        if ((elossCurves[i].mass == mass) && (elossCurves[i].tcut == tcut)) return int(i);
+      }
+      return -1;
+    }
+
+    /// Returns the tabulated curve with the specified index.
+    ElossCurve const& Curve(unsigned int i) const { return elossCurves[i]; }
+
+  }; // struct DetectorPropertiesSnapshot
+
+  static_assert(std::is_trivially_copyable_v<DetectorPropertiesSnapshot>);
+
+  /**
+   * @brief Compiles the detector properties into a snapshot.
+   * @tparam DetProp type of detector properties (`DetectorPropertiesData`)
+   * @tparam Geometry type of geometry description (`geo::GeometryCore`)
+   * @param detProp the detector properties to be copied
+   * @param geom the geometry, for the list of planes
+   * @param curves energy loss curves to be tabulated
+   * @return the snapshot
+   * @throw cet::exception (category "DetectorPropertiesSnapshot") if the
+   *        geometry or the number of curves exceed the capacity of the snapshot
+   *
+   * The energy loss is tabulated at `NElossPoints` momenta evenly spaced in
+   * logarithm between `pMin` and `pMax` of each curve.
+   */
+  template <typename DetProp, typename Geometry>
+  DetectorPropertiesSnapshot makeDetectorPropertiesSnapshot(
+    DetProp const& detProp,
+    Geometry const& geom,
+    std::vector<DetectorPropertiesSnapshot::ElossCurveSpec> const& curves = {})
+  {
+    using Snapshot_t = DetectorPropertiesSnapshot;
+    Snapshot_t snapshot;
+
+    snapshot.temperature = detProp.Temperature();
+    for (int gap = 0; gap < 3; ++gap)
+      snapshot.efield[gap] = detProp.Efield(gap);
+    snapshot.driftVelocity = detProp.DriftVelocity();
+    snapshot.electronLifetime = detProp.ElectronLifetime();
+    snapshot.numberTimeSamples = detProp.NumberTimeSamples();
+    snapshot.readOutWindowSize = detProp.ReadOutWindowSize();
+
+    snapshot.nCryostats = geom.Ncryostats();
+    for (unsigned int c = 0; c < snapshot.nCryostats; ++c) {
+      unsigned int const nTPCs = geom.NTPC(c);
+      if (nTPCs > snapshot.maxTPCs) snapshot.maxTPCs = nTPCs;
+      for (unsigned int t = 0; t < nTPCs; ++t) {
+        unsigned int const nPlanes = geom.Nplanes(t, c);
+        if (nPlanes > snapshot.maxPlanes) snapshot.maxPlanes = nPlanes;
+      }
+    }
+    std::size_t const nEntries =
+      std::size_t(snapshot.nCryostats) * snapshot.maxTPCs * snapshot.maxPlanes;
+    if (nEntries > Snapshot_t::MaxPlanes) {
+      throw cet::exception("DetectorPropertiesSnapshot")
+        << "Geometry has " << snapshot.nCryostats << " cryostats with up to " << snapshot.maxTPCs
+        << " TPCs with up to " << snapshot.maxPlanes << " planes, more than the "
+        << Snapshot_t::MaxPlanes << " supported.\n";
+    }
+
+    for (unsigned int c = 0; c < snapshot.nCryostats; ++c) {
+      unsigned int const nTPCs = geom.NTPC(c);
+      for (unsigned int t = 0; t < nTPCs; ++t) {
+        double const coefficient = detProp.GetXTicksCoefficient(t, c);
+        unsigned int const nPlanes = geom.Nplanes(t, c);
+        for (unsigned int p = 0; p < nPlanes; ++p) {
+          Snapshot_t::PlaneConversion& conv =
+            snapshot.planes[(c * snapshot.maxTPCs + t) * snapshot.maxPlanes + p];
+          conv.coefficient = coefficient;
+          conv.offset = detProp.GetXTicksOffset(p, t, c);
+        }
+      }
+    }
+
+    if (curves.size() > Snapshot_t::MaxElossCurves) {
+      throw cet::exception("DetectorPropertiesSnapshot")
+        << curves.size() << " energy loss curves requested, only "
+        << Snapshot_t::MaxElossCurves << " supported.\n";
+    }
+    snapshot.nElossCurves = curves.size();
+    for (std::size_t i = 0; i < curves.size(); ++i) {
+      Snapshot_t::ElossCurveSpec const& spec = curves[i];
+      if (!(spec.pMin > 0.0) || !(spec.pMax > spec.pMin)) {
+        throw cet::exception("DetectorPropertiesSnapshot")
+          << "Invalid momentum range [ " << spec.pMin << " ; " << spec.pMax
+          << " ] for energy loss curve #" << i << ".\n";
+      }
+      Snapshot_t::ElossCurve& curve = snapshot.elossCurves[i];
+      curve.mass = spec.mass;
+      curve.tcut = spec.tcut;
+      curve.logPMin = std::log(spec.pMin);
+      curve.logPMax = std::log(spec.pMax);
+      double const logStep = (curve.logPMax - curve.logPMin) / (Snapshot_t::NElossPoints - 1);
+      curve.invLogStep = 1.0 / logStep;
+      for (unsigned int k = 0; k < Snapshot_t::NElossPoints; ++k) {
+        double const mom = std::exp(curve.logPMin + k * logStep);
+        curve.eloss[k] = detProp.Eloss(mom, spec.mass, spec.tcut);
+        curve.elossVar[k] = detProp.ElossVar(mom, spec.mass);
+      }
+    }
+
+    return snapshot;
+  } // makeDetectorPropertiesSnapshot()
+
+} // namespace detinfo
+
+#endif // LARDATA_DETECTORINFOSERVICES_DETECTORPROPERTIESSNAPSHOT_H
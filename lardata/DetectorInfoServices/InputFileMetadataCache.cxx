@@ -0,0 +1,148 @@
+/**
+ * @file   lardata/DetectorInfoServices/InputFileMetadataCache.cxx
+ * @brief  Configuration of past jobs, read once from each input file
+ * @date   October 19, 2026
+ * @see    InputFileMetadataCache.h
+ */
+
+// library header
+#include "lardata/DetectorInfoServices/InputFileMetadataCache.h"
+
+// framework libraries
+#include "art_root_io/RootDB/SQLite3Wrapper.h"
+#include "art_root_io/detail/readMetadata.h"
+#include "canvas/Persistency/Provenance/FileFormatVersion.h"
+#include "canvas/Persistency/Provenance/ParameterSetMap.h"
+#include "canvas/Persistency/Provenance/rootNames.h"
+#include "cetlib_except/exception.h"
+#include "fhiclcpp/make_ParameterSet.h"
+
+// ROOT libraries
+#include "TFile.h"
+#include "TTree.h"
+
+// C/C++ standard libraries
+#include <utility>
+
+namespace detinfo {
+
+  //--------------------------------------------------------------------------
+  std::vector<fhicl::ParameterSet> const&
+  InputFileMetadataCache::FileMetadata::parameterSets(std::string const& consumer) const
+  {
+    static std::vector<fhicl::ParameterSet> const none;
+    auto const iSelected = selected.find(consumer);
+    return (iSelected == selected.end()) ? none : iSelected->second;
+  }
+
+  //--------------------------------------------------------------------------
+  InputFileMetadataCache::InputFileMetadataCache(Reader_t reader) : fReader(std::move(reader)) {}
+
+  //--------------------------------------------------------------------------
+  InputFileMetadataCache&
+  InputFileMetadataCache::instance()
+  {
+    static InputFileMetadataCache cache{&InputFileMetadataCache::readInputFile};
+    return cache;
+  }
+
+  //--------------------------------------------------------------------------
+  void
+  InputFileMetadataCache::registerConsumer(std::string const& name, Selector_t selector)
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    fConsumers[name] = std::move(selector);
+    ++fConsumersVersion; // the cached selection is now incomplete
+  }
+
+  //--------------------------------------------------------------------------
+  void
+  InputFileMetadataCache::unregisterConsumer(std::string const& name)
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    fConsumers.erase(name); // the cached selection of the others is still valid
+  }
+
+  //--------------------------------------------------------------------------
+  std::shared_ptr<InputFileMetadataCache::FileMetadata const>
+  InputFileMetadataCache::metadata(std::string const& fileName)
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    if (fCached && (fCached->fileName == fileName) && (fCachedVersion == fConsumersVersion))
+      return fCached;
+    fCached = readMetadata(fileName);
+    fCachedVersion = fConsumersVersion;
+    return fCached;
+  }
+
+  //--------------------------------------------------------------------------
+  void
+  InputFileMetadataCache::clear()
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    fCached.reset();
+  }
+
+  //--------------------------------------------------------------------------
+  std::shared_ptr<InputFileMetadataCache::FileMetadata const>
+  InputFileMetadataCache::readMetadata(std::string const& fileName) const
+  {
+    auto metadata = std::make_shared<FileMetadata>();
+    metadata->fileName = fileName;
+    if (fConsumers.empty() || fileName.empty()) return metadata;
+
+    // each stored parameter set is parsed once, and offered to all consumers
+    auto select = [this, &metadata](char const* blob) {
+      fhicl::ParameterSet ps;
+      fhicl::make_ParameterSet(blob, ps);
+      for (auto const& [name, selector] : fConsumers) {
+        if (selector(ps)) metadata->selected[name].push_back(ps);
+      }
+    };
+
+    fReader(*metadata, select);
+    return metadata;
+  } // InputFileMetadataCache::readMetadata()
+
+  //--------------------------------------------------------------------------
+  void
+  InputFileMetadataCache::readInputFile(FileMetadata& metadata, Select_t const& select)
+  {
+    std::string const& fileName = metadata.fileName;
+
+    // The only way to access art service metadata from the input file
+    // is to open it as a separate TFile object.  Do that now, once.
+    std::unique_ptr<TFile> file{TFile::Open(fileName.c_str(), "READ")};
+    if (!file || file->IsZombie() || !file->IsOpen()) return;
+    metadata.open = true;
+
+    std::unique_ptr<TTree> metaDataTree{
+      file->Get<TTree>(art::rootNames::metaDataTreeName().c_str())};
+    metadata.hasMetaDataTree = (metaDataTree != nullptr);
+    if (metaDataTree) {
+      metadata.fileFormatVersion =
+        art::detail::readMetadata<art::FileFormatVersion>(metaDataTree.get()).value_;
+    }
+
+    if (metaDataTree && (metadata.fileFormatVersion < 5)) {
+      // old files store the parameter sets in the metadata tree
+      art::ParameterSetMap psetMap;
+      if (!art::detail::readMetadata(metaDataTree.get(), psetMap)) {
+        throw cet::exception("InputFileMetadataCache")
+          << "Could not read ParameterSetMap from metadata tree of '" << fileName << "'!\n";
+      }
+      for (auto const& psEntry : psetMap)
+        select(psEntry.second.pset_.c_str());
+    }
+    else {
+      art::SQLite3Wrapper sqliteDB(file.get(), "RootFileDB");
+      sqlite3_stmt* stmt{nullptr};
+      sqlite3_prepare_v2(sqliteDB, "SELECT PSetBlob from ParameterSets;", -1, &stmt, nullptr);
+      while (sqlite3_step(stmt) == SQLITE_ROW) {
+        select(reinterpret_cast<char const*>(sqlite3_column_text(stmt, 0)));
+      }
+      sqlite3_finalize(stmt);
+    }
+  } // InputFileMetadataCache::readInputFile()
+
+} // namespace detinfo
@@ -0,0 +1,118 @@
+/**
+ * @file   lardata/DetectorInfoServices/InputFileMetadataCache.h
+ * @brief  Configuration of past jobs, read once from each input file
+ * @date   October 19, 2026
+ * @see    InputFileMetadataCache.cxx
+ */
+
+#ifndef LARDATA_DETECTORINFOSERVICES_INPUTFILEMETADATACACHE_H
+#define LARDATA_DETECTORINFOSERVICES_INPUTFILEMETADATACACHE_H
+
+// framework libraries
+#include "fhiclcpp/ParameterSet.h"
+
+// C/C++ standard libraries
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace detinfo {
+
+  /**
+   * @brief Shared cache of the configuration stored in the input file.
+   *
+   * Services inheriting their configuration from the jobs which produced the
+   * input file need to read the parameter sets stored by _art_ in that file.
+   * This cache opens each input file only once, parses each stored parameter
+   * set only once, and keeps for each registered consumer the parameter sets
+   * it selected.
+   *
+   * A consumer (typically a service, on construction) calls
+   * `registerConsumer()` with a name and a selection function; then, in its
+   * `postOpenFile()` callback, it calls `metadata()` with the name of the
+   * file, and receives the parameter sets it selected with
+   * `FileMetadata::parameterSets()`. The first consumer asking for a file
+   * triggers its reading, the others receive the cached content.
+   *
+   * Only the metadata of the last file is kept. If no consumer is registered,
+   * the file is not opened at all.
+   * A consumer whose selection function refers to an object (like a service
+   * capturing `this`) must call `unregisterConsumer()` before that object is
+   * destroyed.
+   *
+   * The job uses the cache from `instance()`, which reads _art_/ROOT files.
+   * Other caches can be created with a different reader, e.g. for testing.
+   */
+  class InputFileMetadataCache {
+  public:
+    /// Function telling whether a parameter set is relevant to a consumer.
+    using Selector_t = std::function<bool(fhicl::ParameterSet const&)>;
+
+    struct FileMetadata;
+
+    /// Function called with each parameter set stored in the file (as FHiCL).
+    using Select_t = std::function<void(char const*)>;
+
+    /**
+     * @brief Function reading the input file.
+     *
+     * The reader fills the information about the file in the metadata object
+     * (which has already the file name), and calls the selection function
+     * with each of the stored parameter sets.
+     */
+    using Reader_t = std::function<void(FileMetadata&, Select_t const&)>;
+
+    /// Content extracted from one input file.
+    struct FileMetadata {
+      std::string fileName;        ///< Name of the input file.
+      bool        open = false;    ///< Whether the file could be opened.
+      bool        hasMetaDataTree = false; ///< Whether the file has an _art_ metadata tree.
+      int         fileFormatVersion = -1;  ///< _art_ format version (-1 if unknown).
+
+      /// Parameter sets selected by each consumer, in storage order.
+      std::map<std::string, std::vector<fhicl::ParameterSet>> selected;
+
+      /// Returns the parameter sets selected by the named consumer.
+      std::vector<fhicl::ParameterSet> const& parameterSets(std::string const& consumer) const;
+    }; // FileMetadata
+
+    /// Creates a cache using the specified function to read the files.
+    explicit InputFileMetadataCache(Reader_t reader);
+
+    /// Returns the cache shared by the whole job.
+    static InputFileMetadataCache& instance();
+
+    /// Registers (or replaces) a consumer and its parameter set selection.
+    void registerConsumer(std::string const& name, Selector_t selector);
+
+    /// Removes a consumer; its selection function is not used any more.
+    void unregisterConsumer(std::string const& name);
+
+    /// Returns the metadata of the file, reading it if not cached yet.
+    std::shared_ptr<FileMetadata const> metadata(std::string const& fileName);
+
+    /// Drops the cached metadata.
+    void clear();
+
+  private:
+    Reader_t fReader;                             ///< Reads the input files.
+    std::mutex fMutex;                            ///< Serializes all the operations.
+    std::map<std::string, Selector_t> fConsumers; ///< Registered consumers.
+    unsigned int fConsumersVersion = 0;           ///< Changes at each registration.
+    unsigned int fCachedVersion = 0;              ///< Registration version of the cache.
+    std::shared_ptr<FileMetadata const> fCached;  ///< Metadata of the last file.
+
+    /// Reads all the metadata from the specified file.
+    std::shared_ptr<FileMetadata const> readMetadata(std::string const& fileName) const;
+
+    /// Reads the parameter sets stored in an _art_ ROOT file.
+    static void readInputFile(FileMetadata& metadata, Select_t const& select);
+
+  }; // class InputFileMetadataCache
+
+} // namespace detinfo
+
+#endif // LARDATA_DETECTORINFOSERVICES_INPUTFILEMETADATACACHE_H
@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////////////////
+/// \file  DAQ480EventFile.cxx
+/// \brief Memory-mapped reader of DAQ480 binary event files
+///
+/// \date  October 19, 2026
+////////////////////////////////////////////////////////////////////////
+
+#include "lardata/RawData/utils/DAQ480EventFile.h"
+
+#include "canvas/Utilities/Exception.h"
+#include "lardataobj/RawData/DAQHeader.h"
+
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <utility>
+
+extern "C" {
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+}
+
+namespace lris {
+
+  // ======================================================================
+  MappedFile::MappedFile(std::string const& path)
+  {
+    int const fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw art::Exception(art::errors::FileOpenError)
+        << "failed to open input file " << path << ": " << std::strerror(errno) << std::endl;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+      int const error = errno;
+      ::close(fd);
+      throw art::Exception(art::errors::FileOpenError)
+        << "failed to stat input file " << path << ": " << std::strerror(error) << std::endl;
+    }
+    size_ = info.st_size;
+    if (size_ > 0) {
+      void* const mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapped == MAP_FAILED) {
+        int const error = errno;
+        ::close(fd);
+        throw art::Exception(art::errors::FileOpenError)
+          << "failed to map input file " << path << ": " << std::strerror(error) << std::endl;
+      }
+      ::madvise(mapped, size_, MADV_WILLNEED); // event files are read whole
+      data_ = static_cast<char const*>(mapped);
+    }
+    ::close(fd); // the mapping stays valid
+  }
+
+  MappedFile::~MappedFile() { unmap(); }
+
+  MappedFile::MappedFile(MappedFile&& from) noexcept
+    : data_(std::exchange(from.data_, nullptr))
+    , size_(std::exchange(from.size_, 0))
+  {}
+
+  MappedFile& MappedFile::operator=(MappedFile&& from) noexcept
+  {
+    if (this != &from) {
+      unmap();
+      data_ = std::exchange(from.data_, nullptr);
+      size_ = std::exchange(from.size_, 0);
+    }
+    return *this;
+  }
+
+  void MappedFile::unmap()
+  {
+    if (data_) ::munmap(const_cast<char*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+  }
+
+  // ======================================================================
+  DAQ480EventFile::DAQ480EventFile(std::string const& path,
+                                   int nChannelBlocks /* = -1 */,
+                                   bool hasFooter /* = true */)
+    : file_(path)
+  {
+    char const* const begin = file_.data();
+    std::size_t const size = file_.size();
+
+    if (size < sizeof header_) {
+      throw art::Exception(art::errors::FileReadError)
+        << "input file " << path << " is too short (" << size
+        << " bytes) for the event header" << std::endl;
+    }
+    std::memcpy(&header_, begin, sizeof header_);
+
+    // walk through all the channel blocks once, checking they are complete
+    std::size_t const nBlocks = (nChannelBlocks < 0)? header_.nchan: nChannelBlocks;
+    channels_.reserve(nBlocks);
+    std::size_t pos = sizeof header_;
+    for (std::size_t i = 0; i < nBlocks; ++i) {
+      daq480::channel c1;
+      if (size - pos < sizeof c1) {
+        throw art::Exception(art::errors::FileReadError)
+          << "input file " << path << " is truncated in the header of channel block #"
+          << i << " of " << nBlocks << std::endl;
+      }
+      std::memcpy(&c1, begin + pos, sizeof c1);
+      pos += sizeof c1;
+      std::size_t const adcSize = sizeof(short) * c1.samples;
+      if (size - pos < adcSize) {
+        throw art::Exception(art::errors::FileReadError)
+          << "input file " << path << " is truncated in the " << c1.samples
+          << " samples of channel block #" << i << " of " << nBlocks << std::endl;
+      }
+      channels_.push_back({c1.ch, c1.samples, begin + pos});
+      pos += adcSize;
+    }
+
+    if (hasFooter && (size - pos < sizeof(daq480::footer))) {
+      throw art::Exception(art::errors::FileReadError)
+        << "input file " << path << " is missing the event footer" << std::endl;
+    }
+  }
+
+  void DAQ480EventFile::fillDAQHeader(raw::DAQHeader& daqHeader) const
+  {
+    time_t mytime = header_.time;
+    mytime = mytime << 32;//Nov. 2, 2010 - "time_t" is a 64-bit word on many 64-bit machines
+    //so we had to change types in header struct to read in the correct
+    //number of bits.  Once we have the 32-bit timestamp from the binary
+    //data, shift it up to the upper half of the 64-bit timestamp.  - Mitch
+
+    daqHeader.SetStatus(1);
+    daqHeader.SetFixedWord(header_.fixed);
+    daqHeader.SetFileFormat(header_.format);
+    daqHeader.SetSoftwareVersion(header_.software);
+    daqHeader.SetRun(header_.run);
+    daqHeader.SetEvent(header_.event);
+    daqHeader.SetTimeStamp(mytime);
+    daqHeader.SetSpareWord(header_.spare);
+    daqHeader.SetNChannels(header_.nchan);
+  }
+
+} // namespace lris
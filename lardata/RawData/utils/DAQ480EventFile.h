@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////
+/// \file  DAQ480EventFile.h
+/// \brief Memory-mapped reader of DAQ480 binary event files
+///
+/// \date  October 19, 2026
+////////////////////////////////////////////////////////////////////////
+
+#ifndef LRIS_DAQ480EVENTFILE_H
+#define LRIS_DAQ480EVENTFILE_H
+
+#include "lardata/RawData/utils/RawDigitFormat.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace raw { class DAQHeader; }
+
+namespace lris {
+
+  /// Layout of the DAQ480 binary event files (ArgoNeuT, Bo).
+  namespace daq480 {
+
+    // ======================================================================
+    struct header
+    {
+      int             fixed;     //Fixed 32-bit word with value:  0x0000D480
+      unsigned short  format;    //File Format Version.  16-bit word.  Currently = 0x0001
+      unsigned short  software;  //DAQ480 Software Version.  16-bit word.  Currently 0x0600 (v6.0)
+      unsigned short  run;       //16-bit word.
+      unsigned short  event;     //16-bit word.
+      int             time;      //Event timestamp.  Coordinated Universal Time. 32-bit word.
+      short           spare;     //Spare 16-bit word.  Currently 0x0000
+      unsigned short  nchan;     //Total # of channels in readout. 16-bit word.
+    };
+
+    // ======================================================================
+    struct channel
+    {
+      unsigned short  ch;        //Channel #.  16-bit word.
+      unsigned short  samples;   //# samples for this channel.   16-bit word.
+    };
+
+    // ======================================================================
+    struct footer
+    {
+      int             spare;     //Spare 32-bit word.  Currently 0x00000000
+      int             checksum;  //Reserved for checksum.  32-bit word.  Currently 0x00000000
+    };
+
+  } // namespace daq480
+
+  // ======================================================================
+  /// Read-only memory mapping of a whole file (RAII).
+  class MappedFile {
+  public:
+    /// Maps the file; throws art::Exception (FileOpenError) on failure.
+    explicit MappedFile(std::string const& path);
+    ~MappedFile();
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+    MappedFile(MappedFile&& from) noexcept;
+    MappedFile& operator=(MappedFile&& from) noexcept;
+
+    /// Start of the mapped content.
+    char const* data() const { return data_; }
+    /// Size of the mapped content, in bytes.
+    std::size_t size() const { return size_; }
+
+  private:
+    void unmap();
+
+    char const* data_ = nullptr;
+    std::size_t size_ = 0;
+  }; // MappedFile
+
+  // ======================================================================
+  /**
+   * \brief DAQ480 event file, mapped in memory.
+   *
+   * The layout of the whole file (header, channel blocks and, optionally,
+   * footer) is validated on construction, and the position of each channel
+   * block is recorded. The ADC samples are then read straight from the
+   * mapped region: the only copy is the one into the vector which is moved
+   * into `raw::RawDigit`.
+   *
+   * Truncated files are reported by throwing art::Exception (FileReadError),
+   * while the stream-based reading used to produce garbage.
+   */
+  class DAQ480EventFile {
+  public:
+    /// A channel block in the mapped file.
+    using ChannelBlock = RawChannelBlock;
+
+    /**
+     * \brief Maps and validates the event file.
+     * \param path path of the file
+     * \param nChannelBlocks number of channel blocks (negative: from header)
+     * \param hasFooter whether a footer must follow the channel blocks
+     */
+    explicit DAQ480EventFile(std::string const& path,
+                             int nChannelBlocks = -1,
+                             bool hasFooter = true);
+
+    /// The header of the event.
+    daq480::header const& header() const { return header_; }
+
+    /// All the channel blocks, in file order.
+    std::vector<ChannelBlock> const& channels() const { return channels_; }
+
+    /// Fills the DAQ header from the file header (time in the upper 32 bits).
+    void fillDAQHeader(raw::DAQHeader& daqHeader) const;
+
+  private:
+    MappedFile file_;
+    daq480::header header_;
+    std::vector<ChannelBlock> channels_;
+  }; // DAQ480EventFile
+
+} // namespace lris
+
+#endif // LRIS_DAQ480EVENTFILE_H
@@ -0,0 +1,208 @@
+////////////////////////////////////////////////////////////////////////
+/// \file  DAQ480Format.cxx
+/// \brief Formats of the DAQ480 event files, and their decoding
+///
+/// \date  October 19, 2026
+////////////////////////////////////////////////////////////////////////
+
+#include "lardata/RawData/utils/DAQ480Format.h"
+#include "lardata/RawData/utils/DAQ480EventFile.h"
+
+#include "canvas/Utilities/Exception.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+extern "C" {
+#include <dirent.h>
+}
+
+// ======================================================================
+// DAQ480 interface, adapted from code by Rebel/Soderberg:
+
+namespace {
+
+  // ======================================================================
+  int run( std::string s1 )
+  {
+    size_t p1 = s1.find("R");
+    size_t p2 = s1.find("_E");
+
+    int run = atoi((s1.substr(p1+1,p2-p1-1)).c_str());
+    return run;
+  }
+
+
+  // ======================================================================
+  int event( std::string s1 )
+  {
+    size_t p1 = s1.find("E");
+    size_t p2 = s1.find("_T");
+
+    int event = atoi((s1.substr(p1+1,p2-p1-1)).c_str());
+    return event;
+  }
+
+
+  // ======================================================================
+  bool compare( std::string const& s1, std::string const& s2 )
+  {
+    int r1 = run(s1);
+    int r2 = run(s2);
+    int e1 = event(s1);
+    int e2 = event(s2);
+
+    // the name breaks the ties, so that the order does not depend on readdir
+    return r1 == r2 ? ( e1 == e2 ? s1 < s2 : e1 < e2 )
+      :  r1 < r2;
+  }
+
+} // namespace
+
+namespace lris {
+
+  // ======================================================================
+  DAQ480Format ArgoNeuTFormat()
+  {
+    DAQ480Format format;
+    format.digits.name = "ArgoNeuT";
+    format.digits.nDigits = 240*2; // wires per plane times planes
+    //subtract one from ch. number...
+    //hence offline channels will always be one lower
+    //than the DAQ480 definition. - mitch 7/8/2009
+    format.digits.channel
+      = [](std::size_t, RawChannelBlock const& c1, unsigned int){ return c1.ch - 1; };
+    format.digits.pedestal = 400.; //carl b assures me this will never change. bjr 4/15/2009
+    return format;
+  }
+
+  // ======================================================================
+  DAQ480Format ShortBoFormat()
+  {
+    DAQ480Format format;
+    format.digits.name = "ShortBo";
+    format.digits.nDigits = 48*3; // wires per plane times planes
+    format.digits.channel
+      = [](std::size_t i, RawChannelBlock const&, unsigned int run) -> raw::ChannelID_t
+      {
+        int iw = i;
+        if (run<280 && run>192) {
+          if (i==92) iw=95;
+          if (i==93) iw=94;
+          if (i==94) iw=93;
+          if (i==95) iw=92;
+        }
+        return iw;
+      };
+    format.digits.pedestal = 400.; //carl b assures me this will never change. bjr 4/15/2009
+    return format;
+  }
+
+  // ======================================================================
+  DAQ480Format LongBoFormat()
+  {
+    ///\todo Total number of channels=144 in Long Bo is hardcoded
+    DAQ480Format format;
+    format.digits.name = "LongBo";
+    format.digits.nDigits = 48*3; // wires per plane times planes
+    //flip collection wires to be consistent with offline geometry. TYang 12/23/2013
+    format.digits.slot = [](std::size_t i){ return (i<96)? i: 239-i; };
+    format.digits.channel = [](std::size_t i, RawChannelBlock const&, unsigned int)
+      { return raw::ChannelID_t((i<96)? i: 239-i); };
+    format.digits.fixSamples = [](std::size_t i, raw::RawDigit::ADCvector_t& adclist)
+      {
+        // set signal to be 400 if it is 0 (bad pedestal)
+        for (short& adc: adclist) {
+          if (std::abs(adc)<1e-5) adc+=400;
+        }
+        // invert the signals from the BNL ASIC
+        if (i>63 && i<80) {
+          for (short& adc: adclist) {
+            int mysig=adc-400;
+            adc=400-mysig;
+          }
+        }
+      };
+    format.digits.pedestal = 400.; //carl b assures me this will never change. bjr 4/15/2009
+    format.nWireBlocks = 48*3;
+    format.nTriggerBlocks = 16;
+    format.hasFooter = false;
+    return format;
+  }
+
+  // ======================================================================
+  void DecodeDAQ480File(std::string const& path,
+                        DAQ480Format const& format,
+                        DAQ480Event& event,
+                        unsigned int nThreads /* = 1U */)
+  {
+    // The whole file is mapped in memory and its layout checked up front;
+    // the mapping is released when efile goes out of scope.
+    int const nBlocks = (format.nWireBlocks < 0)
+      ? -1: (format.nWireBlocks + format.nTriggerBlocks);
+    DAQ480EventFile const efile(path, nBlocks, format.hasFooter);
+
+    efile.fillDAQHeader(event.daqHeader);
+
+    std::vector<RawChannelBlock> const& channels = efile.channels();
+    std::size_t const nWires = channels.size() - format.nTriggerBlocks;
+    std::vector<RawChannelBlock> const wires
+      (channels.begin(), channels.begin() + nWires);
+    BuildRawDigits(wires, format.digits, efile.header().run, event.digits, nThreads);
+
+    //
+    //  MStancari, TYang - Apr 4 2013
+    //
+    //  Add trigger information to the record
+    float const pedestal = format.digits.pedestal.value_or(0.);
+    event.triggers.clear();
+    event.triggers.resize(format.nTriggerBlocks);
+    for (unsigned int i = 0; i < format.nTriggerBlocks; ++i) {
+      unsigned int utrigtime = 0;
+      RawChannelBlock const& c1 = channels[nWires + i];
+      // the samples are scanned in place, no copy needed
+      short const* adclist = reinterpret_cast<short const*>(c1.adc);
+
+      int j=0;
+      while (j<c1.samples){
+        float test = pedestal-adclist[j];
+        if (test>10 && j>0) {
+          utrigtime=j;
+          break;
+        }
+        j++;
+      }
+      event.triggers[i] = raw::ExternalTrigger(nWires + i, utrigtime);
+    }
+  }
+
+  // ======================================================================
+  std::vector<std::string> SortedDAQ480Files(std::string const& dir)
+  {
+    if( dir == "" )
+      throw art::Exception( art::errors::Configuration )
+        << "Vacuous directory name" << std::endl;
+
+    std::vector<std::string> files;
+
+    DIR * dp = NULL;
+    if( (dp = opendir(dir.c_str())) == NULL ) {
+      throw art::Exception( art::errors::FileOpenError )
+        << "Error opening directory " << dir << std::endl;
+    }
+
+    dirent * dirp = NULL;
+    while( (dirp = readdir(dp)) != NULL ) {
+      std::string filename( dirp->d_name );
+      if( filename.find("bin") != std::string::npos ) {
+        files.push_back(filename);
+      }
+    }
+    closedir(dp);
+
+    sort( files.begin(), files.end(), compare );
+
+    return files;
+  }
+
+} // namespace lris
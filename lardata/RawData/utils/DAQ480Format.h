@@ -0,0 +1,72 @@
+////////////////////////////////////////////////////////////////////////
+/// \file  DAQ480Format.h
+/// \brief Formats of the DAQ480 event files, and their decoding
+///
+/// \date  October 19, 2026
+////////////////////////////////////////////////////////////////////////
+
+#ifndef LRIS_DAQ480FORMAT_H
+#define LRIS_DAQ480FORMAT_H
+
+#include "lardata/RawData/utils/RawDigitFormat.h"
+#include "lardataobj/RawData/DAQHeader.h"
+#include "lardataobj/RawData/ExternalTrigger.h"
+#include "lardataobj/RawData/RawDigit.h"
+
+#include <string>
+#include <vector>
+
+namespace lris {
+
+  // ======================================================================
+  /**
+   * \brief Layout of the event files of a detector read out by DAQ480.
+   *
+   * The wire channel blocks come first in the file, and they are turned
+   * into digits as described by `digits`. They may be followed by
+   * `nTriggerBlocks` external trigger inputs.
+   */
+  struct DAQ480Format {
+    RawDigitFormat digits;             ///< Construction of the digits.
+    int            nWireBlocks = -1;   ///< Wire channel blocks (negative: from header).
+    unsigned int   nTriggerBlocks = 0; ///< External trigger blocks after the wires.
+    bool           hasFooter = true;   ///< Whether the file ends with a footer.
+  };
+
+  /// ArgoNeuT: 480 wires, channel number from the file (starting at 1).
+  DAQ480Format ArgoNeuTFormat();
+
+  /// Short Bo: 144 wires, with four wires swapped in runs 193 to 279.
+  DAQ480Format ShortBoFormat();
+
+  /// Long Bo: 144 wires, collection plane flipped, 16 external triggers.
+  DAQ480Format LongBoFormat();
+
+  /// Products decoded from one event file.
+  struct DAQ480Event {
+    std::vector<raw::RawDigit>        digits;
+    raw::DAQHeader                    daqHeader;
+    std::vector<raw::ExternalTrigger> triggers;
+  };
+
+  /**
+   * \brief Decodes a DAQ480 event file.
+   * \param path path of the event file
+   * \param format layout of the file
+   * \param event products to be filled (replaced)
+   * \param nThreads number of threads to build the digits with
+   *
+   * The time of each external trigger is the first sample (after the first
+   * one) more than 10 ADC counts below the pedestal of the format.
+   */
+  void DecodeDAQ480File(std::string const& path,
+                        DAQ480Format const& format,
+                        DAQ480Event& event,
+                        unsigned int nThreads = 1U);
+
+  /// Returns the event files ("*bin*") in the directory, sorted by run and event.
+  std::vector<std::string> SortedDAQ480Files(std::string const& dir);
+
+} // namespace lris
+
+#endif // LRIS_DAQ480FORMAT_H
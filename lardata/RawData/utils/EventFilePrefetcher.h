@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////
+/// \file  EventFilePrefetcher.h
+/// \brief Decodes the next event files of a list in background threads
+///
+/// \date  October 19, 2026
+////////////////////////////////////////////////////////////////////////
+
+#ifndef LRIS_EVENTFILEPREFETCHER_H
+#define LRIS_EVENTFILEPREFETCHER_H
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lris {
+
+  // ======================================================================
+  /**
+   * \brief Decodes event files ahead of their use, in background threads.
+   * \tparam Event type of the products decoded from one event file
+   *
+   * The files are decoded by the decoder function, and the events are
+   * returned by next() in the same order as the file list, whatever the
+   * order the decoding ends in. Up to `window` files are being decoded at
+   * any time while the caller processes the current event; with a window of
+   * 0 each file is decoded synchronously when its event is requested.
+   *
+   * An exception thrown while decoding a file is rethrown by the next()
+   * call for that file.
+   *
+   * The decoder is called concurrently from different threads, and it must
+   * not share any state among calls.
+   */
+  template <typename Event>
+  class EventFilePrefetcher {
+  public:
+    /// Fills the event with the content of the file.
+    using Decoder_t = std::function<void(std::string const& file, Event& event)>;
+
+    /// Sets up a prefetcher decoding up to `window` files in advance.
+    explicit EventFilePrefetcher(unsigned int window = 0U)
+      : window_(window)
+    {}
+
+    EventFilePrefetcher(EventFilePrefetcher const&) = delete;
+    EventFilePrefetcher& operator=(EventFilePrefetcher const&) = delete;
+
+    /// Waits for the decoding in progress to end.
+    ~EventFilePrefetcher() { stop(); }
+
+    /// Number of files decoded in advance.
+    unsigned int window() const { return window_; }
+
+    /// Starts decoding a new list of files (drops the previous one).
+    void start(std::vector<std::string> files, Decoder_t decoder)
+    {
+      stop();
+      files_ = std::move(files);
+      decoder_ = std::move(decoder);
+      nextToRead_ = 0;
+      nextToDecode_ = 0;
+      fill();
+    }
+
+    /// Returns whether all the events of the list have been read.
+    bool done() const { return nextToRead_ >= files_.size(); }
+
+    /// Index in the list of the file next() will return the event of.
+    std::size_t nextIndex() const { return nextToRead_; }
+
+    /// Returns the event from the next file in the list.
+    Event next()
+    {
+      Event event;
+      if (pending_.empty()) {
+        decode(files_.at(nextToDecode_++), event);
+      }
+      else {
+        std::future<Event> result = std::move(pending_.front());
+        pending_.pop_front();
+        event = result.get();
+      }
+      ++nextToRead_;
+      fill(); // keep the window busy while the caller uses this event
+      return event;
+    }
+
+    /// Stops decoding, waiting for the files in progress.
+    void stop()
+    {
+      nextToDecode_ = files_.size();
+      pending_.clear(); // waits for each of the pending decodings
+    }
+
+  private:
+    unsigned int                   window_;       ///< Files decoded in advance.
+    std::vector<std::string>       files_;        ///< All the files to decode.
+    Decoder_t                      decoder_;      ///< Decoding function.
+    std::size_t                    nextToRead_ = 0;   ///< Next file to return.
+    std::size_t                    nextToDecode_ = 0; ///< Next file to decode.
+    std::deque<std::future<Event>> pending_;      ///< Decoding in progress.
+
+    void decode(std::string const& file, Event& event) const
+      { decoder_(file, event); }
+
+    /// Starts decoding files until the window is full.
+    void fill()
+    {
+      while ((pending_.size() < window_) && (nextToDecode_ < files_.size())) {
+        std::string const& file = files_[nextToDecode_++];
+        pending_.push_back(std::async(std::launch::async, [this, &file](){
+              Event event;
+              decode(file, event);
+              return event;
+            }));
+      }
+    }
+
+  }; // EventFilePrefetcher
+
+} // namespace lris
+
+#endif // LRIS_EVENTFILEPREFETCHER_H
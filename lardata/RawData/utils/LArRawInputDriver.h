@@ -6,6 +6,8 @@
 ////////////////////////////////////////////////////////////////////////
 
 #include "canvas/Persistency/Provenance/SubRunID.h"
+#include "lardata/RawData/utils/DAQ480Format.h"
+#include "lardata/RawData/utils/EventFilePrefetcher.h"
 
 #include <string>
 #include <vector>
@@ -54,4 +56,7 @@ class lris::LArRawInputDriver {
   stringvec_t::const_iterator    nextfile_;
   stringvec_t::const_iterator    filesdone_;
   art::SubRunID                  currentSubRunID_;
+  DAQ480Format                   format_;        ///< Layout of the event files.
+  unsigned int                   decodeThreads_; ///< Threads decoding each file.
+  EventFilePrefetcher<DAQ480Event> prefetcher_;  ///< Decodes the next event files.
 };  // LArRawInputDriver
@@ -18,12 +18,15 @@
 #include "art/Framework/Principal/RunPrincipal.h"
 #include "canvas/Persistency/Provenance/FileFormatVersion.h"
 #include "canvas/Persistency/Provenance/Timestamp.h"
+#include "fhiclcpp/ParameterSet.h"
 
 #include "TFile.h"
 #include "TObject.h"
 #include "TTree.h"
 
+#include <cstddef>
 #include <memory>
+#include <utility>
 #include <vector>
 
 // ======================================================================
@@ -32,12 +35,15 @@
 namespace lris {
   // ======================================================================
   // class c'tor/d'tor:
-  LArRawInputDriverJP250L::LArRawInputDriverJP250L(fhicl::ParameterSet const &, // Not used
+  LArRawInputDriverJP250L::LArRawInputDriverJP250L(fhicl::ParameterSet const &pset,
 						   art::ProductRegistryHelper &helper,
 						   art::SourceHelper const &pm)
     : principalMaker_(pm)
+    , m_file(0)
+    , m_eventTree(0)
     , m_current(0)
     , m_data(0)
+    , m_cacheSize(pset.get<long long>("TreeCacheSize", 32*1024*1024))
   {
     helper.reconstitutes<raw::DAQHeader,              art::InEvent>("daq");
     helper.reconstitutes<std::vector<raw::RawDigit>,  art::InEvent>("daq");
@@ -47,18 +53,22 @@ namespace lris {
   // ======================================================================
   void LArRawInputDriverJP250L::closeCurrentFile()
   {
+    delete m_file; // also deletes the event tree
+    m_file = 0;
+    m_eventTree = 0;
     delete [] m_data;
+    m_data = 0;
   }
 
   // ======================================================================
   void LArRawInputDriverJP250L::readFile(std::string const &name,
 					 art::FileBlock* &fb)
   {
-    TFile m_f(name.c_str());
-    TTree* runTree = dynamic_cast<TTree*>(m_f.Get("runTree"));
+    // the file stays open, as the events are read from it one at a time
+    m_file = new TFile(name.c_str());
+    TTree* runTree = dynamic_cast<TTree*>(m_file->Get("runTree"));
 
-    m_eventTree    = dynamic_cast<TTree*>(m_f.Get("eventTree"));
-    m_eventTree->SetDirectory(0);
+    m_eventTree    = dynamic_cast<TTree*>(m_file->Get("eventTree"));
     m_nEvent = m_eventTree->GetEntries();
 
     // run information
@@ -74,8 +84,16 @@ namespace lris {
 
     const int nLength=(m_nSamples+4)*m_nChannels;
     m_data = new unsigned short[nLength];
+    m_format = lris::JP250LFormat(m_nChannels);
     m_eventTree->SetBranchAddress("data",m_data);
 
+    // the events are read in sequence: read the baskets of the data ahead
+    if (m_cacheSize > 0) {
+      m_eventTree->SetCacheSize(m_cacheSize);
+      m_eventTree->AddBranchToCache("data", true);
+      m_eventTree->StopCacheLearningPhase();
+    }
+
     // Fill and return a new Fileblock.
     // The string tells you what the version of the LArRawInputDriver is
     fb = new art::FileBlock(art::FileFormatVersion(1, "LArRawInputJP250L 2013_01"),
@@ -116,16 +134,9 @@ namespace lris {
     std::unique_ptr<raw::DAQHeader>              daqcol( new raw::DAQHeader(daqHeader)  );
     std::unique_ptr<std::vector<raw::RawDigit> >  rdcol( new std::vector<raw::RawDigit> );
 
-    // loop over the signals and break them into
-    // one RawDigit for each channel
-    std::vector<short> adcVec(m_nSamples,0);
-    for(unsigned int n = 0; n < m_nChannels; ++n){
-      adcVec.clear();
-      for(unsigned int i = 0; i < m_nSamples; ++i){
-	adcVec.push_back(m_data[(m_nSamples+4)*n+(4+i)]);
-      }
-      rdcol->push_back(raw::RawDigit(n,m_nSamples,adcVec));
-    }
+    // break the signals into one RawDigit for each channel
+    lris::BuildRawDigits(lris::JP250LChannelBlocks(m_data, m_nChannels, m_nSamples),
+                         m_format, m_runID, *rdcol);
 
     art::RunNumber_t    rn     = daqHeader.GetRun();
     art::SubRunNumber_t sn     = 1;
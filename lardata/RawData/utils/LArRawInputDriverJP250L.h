@@ -5,6 +5,8 @@
 /// \author  eito@post.kek.jp, brebel@fnal.gov
 ////////////////////////////////////////////////////////////////////////
 
+#include "lardata/RawData/utils/RawDigitFormat.h"
+
 #include <string>
 
 namespace art {
@@ -17,6 +19,7 @@ namespace art {
 }
 namespace fhicl { class ParameterSet; }
 
+class TFile;
 class TTree;
 
 ///Conversion of binary data to root files
@@ -49,6 +52,7 @@ class lris::LArRawInputDriverJP250L {
   art::SourceHelper const& principalMaker_;
 
   // added by E.Iwai
+  TFile*          m_file;        ///< input file, open until closeCurrentFile()
   TTree*          m_eventTree;   ///< TTree containing information from each trigger
   unsigned int    m_nEvent;      ///< number of triggers in the TTree
   unsigned int    m_current;     ///< current entry in the TTree
@@ -57,5 +61,7 @@ class lris::LArRawInputDriverJP250L {
   unsigned short  m_nChannels;   ///< number of channels in the detector
   unsigned short  m_nSamples;    ///< number of time samples per channel
   unsigned short* m_data;        ///< the ADC of each time sample for each channel
+  long long       m_cacheSize;   ///< bytes of TTreeCache for the event tree (0: none)
+  RawDigitFormat  m_format;      ///< construction of the digits from the data
 
 };  // LArRawInputDriverJP250L
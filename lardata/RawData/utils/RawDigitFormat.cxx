@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////
+/// \file  RawDigitFormat.cxx
+/// \brief Description of raw data formats, and construction of RawDigits
+///
+/// \date  October 19, 2026
+////////////////////////////////////////////////////////////////////////
+
+#include "lardata/RawData/utils/RawDigitFormat.h"
+
+#include "canvas/Utilities/Exception.h"
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+namespace lris {
+
+  // ======================================================================
+  raw::RawDigit::ADCvector_t RawChannelBlock::adcVector() const
+  {
+    // blocks start at even offsets of aligned buffers
+    short const* const first = reinterpret_cast<short const*>(adc);
+    return raw::RawDigit::ADCvector_t(first, first + samples);
+  }
+
+  // ======================================================================
+  void BuildRawDigits(std::vector<RawChannelBlock> const& blocks,
+                      RawDigitFormat const& format,
+                      unsigned int run,
+                      std::vector<raw::RawDigit>& digits,
+                      unsigned int nThreads /* = 1U */)
+  {
+    std::size_t const N = blocks.size();
+
+    // the slots are checked up front, so that the workers can't fail
+    std::vector<std::size_t> slots(N);
+    std::vector<bool> used(format.nDigits, false);
+    for (std::size_t i = 0; i < N; ++i) {
+      std::size_t const slot = format.slot? format.slot(i): i;
+      if ((slot >= format.nDigits) || used[slot]) {
+        throw art::Exception(art::errors::FileReadError)
+          << "channel block #" << i << " of " << N << " maps to "
+          << ((slot >= format.nDigits)? "invalid": "duplicate")
+          << " digit #" << slot << " of the " << format.nDigits
+          << " in format '" << format.name << "'" << std::endl;
+      }
+      used[slot] = true;
+      slots[i] = slot;
+    }
+
+    digits.clear();
+    digits.resize(format.nDigits);
+
+    auto build = [&](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i) {
+        RawChannelBlock const& block = blocks[i];
+        raw::RawDigit::ADCvector_t adcs = block.adcVector();
+        if (format.fixSamples) format.fixSamples(i, adcs);
+        raw::RawDigit& digit = digits[slots[i]];
+        digit = raw::RawDigit
+          (format.channel(i, block, run), block.samples, std::move(adcs));
+        if (format.pedestal) digit.SetPedestal(*format.pedestal);
+      }
+    };
+
+    // a thread is worth starting only with a few blocks to process
+    std::size_t const nChunks = std::max<std::size_t>
+      (1U, std::min<std::size_t>(nThreads, N / 16U));
+    if (nChunks == 1U) {
+      build(0U, N);
+      return;
+    }
+
+    std::size_t const chunkSize = (N + nChunks - 1) / nChunks;
+    std::vector<std::thread> workers;
+    workers.reserve(nChunks);
+    for (std::size_t iChunk = 0; iChunk < nChunks; ++iChunk) {
+      std::size_t const first = iChunk * chunkSize;
+      workers.emplace_back(build, first, std::min(N, first + chunkSize));
+    }
+    for (auto& worker: workers) worker.join();
+  }
+
+  // ======================================================================
+  // JP250L layout: no pedestal.
+  RawDigitFormat JP250LFormat(unsigned short nChannels)
+  {
+    RawDigitFormat format;
+    format.name = "JP250L";
+    format.nDigits = nChannels;
+    format.channel = [](std::size_t n, RawChannelBlock const&, unsigned int)
+      { return raw::ChannelID_t(n); };
+    return format;
+  }
+
+  // ======================================================================
+  std::vector<RawChannelBlock> JP250LChannelBlocks(unsigned short const* data,
+                                                   unsigned short nChannels,
+                                                   unsigned short nSamples)
+  {
+    std::vector<RawChannelBlock> blocks;
+    blocks.reserve(nChannels);
+    std::size_t const stride = nSamples + 4;
+    for(unsigned int n = 0; n < nChannels; ++n){
+      char const* samples = reinterpret_cast<char const*>(data + stride*n + 4);
+      blocks.push_back({ (unsigned short) n, nSamples, samples });
+    }
+    return blocks;
+  }
+
+} // namespace lris
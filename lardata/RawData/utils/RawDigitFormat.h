@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////
+/// \file  RawDigitFormat.h
+/// \brief Description of raw data formats, and construction of RawDigits
+///
+/// \date  October 19, 2026
+////////////////////////////////////////////////////////////////////////
+
+#ifndef LRIS_RAWDIGITFORMAT_H
+#define LRIS_RAWDIGITFORMAT_H
+
+#include "lardataobj/RawData/RawDigit.h"
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace lris {
+
+  // ======================================================================
+  /// A block of ADC samples of one channel in a raw data buffer.
+  struct RawChannelBlock {
+    unsigned short ch;       ///< Channel number, as in the raw data.
+    unsigned short samples;  ///< Number of ADC samples.
+    char const* adc;         ///< Start of the 16-bit samples in the buffer.
+
+    /// Returns a new vector with the ADC samples of this channel.
+    raw::RawDigit::ADCvector_t adcVector() const;
+  };
+
+  // ======================================================================
+  /**
+   * \brief How the channel blocks of a format turn into `raw::RawDigit`.
+   *
+   * The digit list always has `nDigits` elements; the digit from the block
+   * number `i` (in raw data order) is stored at `slot(i)`, and digits no
+   * block is mapped to are left default-constructed.
+   *
+   * The functions are called concurrently when more than one thread is
+   * used, and they must not change any shared state.
+   */
+  struct RawDigitFormat {
+    /// Position of a digit in the list, from the block index.
+    using SlotFunc_t = std::function<std::size_t(std::size_t i)>;
+    /// Channel ID of the digit, from block index, block and run number.
+    using ChannelFunc_t = std::function
+      <raw::ChannelID_t(std::size_t i, RawChannelBlock const& block, unsigned int run)>;
+    /// Correction of the samples, from block index and samples.
+    using FixFunc_t = std::function
+      <void(std::size_t i, raw::RawDigit::ADCvector_t& adcs)>;
+
+    std::string          name;     ///< Name of the format.
+    std::size_t          nDigits;  ///< Number of digits in the list.
+    SlotFunc_t           slot;     ///< Slot of each digit (none: block index).
+    ChannelFunc_t        channel;  ///< Channel of each digit.
+    FixFunc_t            fixSamples; ///< Correction of the samples (optional).
+    std::optional<float> pedestal; ///< Pedestal assigned to each digit, if any.
+  };
+
+  /**
+   * \brief Fills the digit list with one digit per channel block.
+   * \param blocks the channel blocks, in raw data order
+   * \param format description of the digit construction
+   * \param run run number (passed to the channel mapping)
+   * \param digits the list to be filled (replaced)
+   * \param nThreads number of threads the blocks are split among
+   *
+   * An art::Exception (FileReadError) is thrown if a block is mapped out of
+   * the list or to the same slot as another one.
+   */
+  void BuildRawDigits(std::vector<RawChannelBlock> const& blocks,
+                      RawDigitFormat const& format,
+                      unsigned int run,
+                      std::vector<raw::RawDigit>& digits,
+                      unsigned int nThreads = 1U);
+
+  // ======================================================================
+  /// JP250L: one digit per channel, channel number from the block position.
+  RawDigitFormat JP250LFormat(unsigned short nChannels);
+
+  /// Channel blocks of a JP250L data block: each channel takes
+  /// (nSamples+4) words, 4 header words followed by the samples.
+  std::vector<RawChannelBlock> JP250LChannelBlocks(unsigned short const* data,
+                                                   unsigned short nChannels,
+                                                   unsigned short nSamples);
+
+} // namespace lris
+
+#endif // LRIS_RAWDIGITFORMAT_H
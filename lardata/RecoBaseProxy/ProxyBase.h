@@ -16,6 +16,7 @@
 // LArSoft libraries
 #include "lardata/RecoBaseProxy/ProxyBase/withCollectionProxy.h"
 #include "lardata/RecoBaseProxy/ProxyBase/withAssociated.h"
+#include "lardata/RecoBaseProxy/ProxyBase/withLazyAssociated.h"
 #include "lardata/RecoBaseProxy/ProxyBase/withParallelData.h"
 #include "lardata/RecoBaseProxy/ProxyBase/withZeroOrOne.h"
 #include "lardata/RecoBaseProxy/ProxyBase/getCollection.h"
@@ -27,7 +27,10 @@
 // #include <tuple> // std::tuple_element_t<>, std::get()
 #include <iterator> // std::distance(), std::forward_iterator_tag, ...
 #include <algorithm> // std::min()
-#include <memory> // std::addressof()
+#include <memory> // std::addressof(), std::shared_ptr<>
+#include <mutex> // std::call_once(), std::once_flag
+#include <atomic>
+#include <optional>
 #include <utility> // std::forward(), std::declval(), ...
 #include <type_traits> // std::is_same<>, std::enable_if_t<>, ...
 #include <cstdlib> // std::size_t
@@ -908,6 +911,146 @@ namespace proxy {
   //@}
 
 
+  //----------------------------------------------------------------------------
+  namespace details {
+
+    //--------------------------------------------------------------------------
+    /**
+     * @brief Associated data interface, with range boundaries built on demand.
+     * @tparam Main type of the main associated object (one)
+     * @tparam Aux type of the additional associated objects (many)
+     * @tparam Metadata type of metadata in the association (default: `void`)
+     * @tparam Tag tag this data is labeled with
+     * @see `AssociatedData`, `proxy::makeLazyAssociatedData()`
+     *
+     * This object offers the same interface as `AssociatedData`, but on
+     * creation it only records the association it is going to wrap.
+     * The list of boundaries of the associated `Aux` objects for each `Main`
+     * one is built the first time any of the data is accessed.
+     * When a proxy is created and only a few of its elements are used (or
+     * none at all), this saves the cost of the full scan of the association.
+     *
+     * The construction of the boundaries is thread-safe: concurrent first
+     * accesses will build the boundaries only once.
+     * The association object must stay valid for the whole lifetime of this
+     * object (which is always the case for data products read from the event).
+     *
+     * Construction is not part of the interface.
+     */
+    template <
+      typename Main, typename Aux, typename Metadata /* = void */,
+      typename Tag /* = Aux */
+      >
+    class LazyAssociatedData {
+      using This_t = LazyAssociatedData<Main, Aux, Metadata, Tag>;
+
+        public:
+      /// Type of the associated data object this one materializes into.
+      using materialized_t = AssociatedData<Main, Aux, Metadata, Tag>;
+
+      /// Type of _art_ association.
+      using assns_t = typename materialized_t::assns_t;
+
+      using tag = Tag; ///< Tag of this association proxy.
+
+      using group_ranges_t = typename materialized_t::group_ranges_t;
+
+      /// Type of collection of auxiliary data associated with a main item.
+      using auxiliary_data_t = typename materialized_t::auxiliary_data_t;
+
+      // constructor is not part of the interface
+      LazyAssociatedData(assns_t const& assns, std::size_t minSize = 0)
+        : fAssns(&assns)
+        , fMinSize(minSize)
+        , fCache(std::make_shared<Cache_t>())
+        {}
+
+      /// Returns whether the association boundaries have already been built.
+      bool isMaterialized() const { return fCache->ready.load(); }
+
+      /// Builds the association boundaries (if needed) and returns them.
+      materialized_t const& materialize() const
+        {
+          std::call_once(fCache->once, [this](){
+            fCache->data.emplace
+              (proxy::makeAssociatedData<tag>(*fAssns, fMinSize));
+            fCache->ready.store(true);
+          });
+          return *(fCache->data);
+        } // materialize()
+
+      /// Returns an iterator pointing to the first associated data range.
+      auto begin() const -> decltype(auto)
+        { return materialize().begin(); }
+
+      /// Returns an iterator pointing past the last associated data range.
+      auto end() const -> decltype(auto)
+        { return materialize().end(); }
+
+      /// Returns the range with the specified index (no check performed).
+      auto getRange(std::size_t i) const -> decltype(auto)
+        { return materialize().getRange(i); }
+
+      /// Returns the range with the specified index (no check performed).
+      auto operator[] (std::size_t index) const -> decltype(auto)
+        { return materialize()[index]; }
+
+      /// Returns whether this data is labeled with the specified tag.
+      template <typename TestTag>
+      static constexpr bool hasTag() { return std::is_same<TestTag, tag>(); }
+
+        private:
+      /// Content created on first access (shared among copies of this object).
+      struct Cache_t {
+        std::once_flag once;
+        std::atomic<bool> ready { false };
+        std::optional<materialized_t> data;
+      }; // Cache_t
+
+      assns_t const* fAssns = nullptr; ///< Association being wrapped.
+      std::size_t fMinSize = 0; ///< Minimum number of main elements.
+      std::shared_ptr<Cache_t> fCache; ///< Boundaries, when materialized.
+
+    }; // class LazyAssociatedData<>
+
+    //--------------------------------------------------------------------------
+
+  } // namespace details
+
+
+  //----------------------------------------------------------------------------
+  //@{
+  /**
+   * @brief Returns an associated data object building its content on demand.
+   * @tparam Tag the tag labelling this associated data
+   *             (if omitted: second type of the association: `right_t`)
+   * @tparam Assns type of association to be processed
+   * @param assns association object to be processed
+   * @param minSize minimum number of entries in the produced association data
+   * @return a new `LazyAssociatedData` wrapping `assns`
+   * @see `makeAssociatedData(Assns const&, std::size_t)`
+   *
+   * The returned object behaves like the one from `makeAssociatedData()`,
+   * with the same requirements on `assns`, but the association is parsed
+   * only when its content is first accessed.
+   * The association object `assns` must outlive the returned object.
+   */
+  template <typename Tag, typename Assns>
+  auto makeLazyAssociatedData(Assns const& assns, std::size_t minSize = 0)
+    {
+      using LazyAssociatedData_t = details::LazyAssociatedData<
+        typename Assns::left_t, typename Assns::right_t,
+        lar::util::assns_metadata_t<Assns>, Tag
+        >;
+      return LazyAssociatedData_t(assns, minSize);
+    } // makeLazyAssociatedData()
+
+  template <typename Assns>
+  auto makeLazyAssociatedData(Assns const& assns, std::size_t minSize = 0)
+    { return makeLazyAssociatedData<typename Assns::right_t>(assns, minSize); }
+  //@}
+
+
   //----------------------------------------------------------------------------
 
 
@@ -0,0 +1,217 @@
+/**
+ * @file   lardata/RecoBaseProxy/ProxyBase/withLazyAssociated.h
+ * @brief  Functions to add on-demand associated data to a collection proxy.
+ * @date   October 19, 2026
+ * @see    lardata/RecoBaseProxy/ProxyBase/withAssociated.h
+ *
+ * This library is header-only. It provides `proxy::withLazyAssociated()`,
+ * which works like `proxy::withAssociated()` but defers the parsing of the
+ * association to the first time its data is accessed.
+ *
+ */
+
+#ifndef LARDATA_RECOBASEPROXY_PROXYBASE_WITHLAZYASSOCIATED_H
+#define LARDATA_RECOBASEPROXY_PROXYBASE_WITHLAZYASSOCIATED_H
+
+// LArSoft libraries
+#include "lardata/RecoBaseProxy/ProxyBase/WithAssociatedStructBase.h"
+#include "lardata/RecoBaseProxy/ProxyBase/AssociatedData.h"
+
+// framework libraries
+#include "canvas/Utilities/InputTag.h"
+
+// C/C++ standard libraries
+#include <tuple>
+#include <utility> // std::forward(), std::move()
+#include <type_traits> // std::is_convertible<>
+
+
+namespace proxy {
+
+  // --- BEGIN Associated data infrastructure ----------------------------------
+  /// @addtogroup LArSoftProxiesAssociatedData
+  /// @{
+
+  /**
+   * @brief Creates an on-demand associated data wrapper for the specified types.
+   * @tparam Main type of main datum (element) to associate from ("left")
+   * @tparam Aux type of datum (element) to associate to ("right")
+   * @tparam Metadata type of metadata in the association
+   * @tparam CollProxy type of proxy this associated data works for
+   * @tparam AuxTag tag labelling this association
+   * @see `withLazyAssociated()`, `AssociatedDataProxyMaker`
+   *
+   * This is the equivalent of `AssociatedDataProxyMaker`, producing a
+   * `details::LazyAssociatedData` object instead of a `details::AssociatedData`
+   * one. The association data product is read from the event at proxy
+   * creation time, but the boundaries of the data associated to each main
+   * element are found only on the first access to the associated data.
+   */
+  template <
+    typename Main, typename Aux, typename Metadata,
+    typename CollProxy, typename AuxTag = Aux
+    >
+  struct LazyAssociatedDataProxyMaker {
+
+    /// Tag labelling the associated data we are going to produce.
+    using data_tag = AuxTag;
+
+    /// Type of the main datum ("left").
+    using main_element_t = Main;
+
+    /// Type of the auxiliary associated datum ("right").
+    using aux_element_t = Aux;
+
+    /// Type of metadata in the association.
+    using metadata_t = Metadata;
+
+    /// Type of associated data proxy being created.
+    using aux_collection_proxy_t = details::LazyAssociatedData
+      <main_element_t, aux_element_t, metadata_t, data_tag>;
+
+    /// Type of _art_ association being used as input.
+    using assns_t = typename aux_collection_proxy_t::assns_t;
+
+    /// Creates the associated data proxy using the main collection tag.
+    template<typename Event, typename Handle, typename MainArgs>
+    static auto make
+      (Event const& event, Handle&& mainHandle, MainArgs const& mainArgs)
+      {
+        return createFromTag
+          (event, std::forward<Handle>(mainHandle), art::InputTag(mainArgs));
+      }
+
+    /// Creates the associated data proxy using the specified tag.
+    template<typename Event, typename Handle, typename MainArgs>
+    static auto make(
+      Event const& event, Handle&& mainHandle,
+      MainArgs const&, art::InputTag const& auxInputTag
+      )
+      {
+        return
+          createFromTag(event, std::forward<Handle>(mainHandle), auxInputTag);
+      }
+
+    /// Wraps the specified association (which must outlive the proxy).
+    template<typename Event, typename Handle, typename MainArgs, typename Assns>
+    static auto make
+      (Event const&, Handle&& mainHandle, MainArgs const&, Assns const& assns)
+      {
+        static_assert(
+          std::is_convertible<typename Assns::right_t, aux_element_t>(),
+          "Improper right type for association."
+          );
+        return makeLazyAssociatedData<data_tag>(assns, mainHandle->size());
+      }
+
+
+      private:
+    template<typename Event, typename Handle>
+    static auto createFromTag(
+      Event const& event, Handle&& mainHandle,
+      art::InputTag const& auxInputTag
+      )
+      {
+        return makeLazyAssociatedData<data_tag>(
+          *(event.template getValidHandle<assns_t>(auxInputTag)),
+          mainHandle->size()
+          );
+      }
+
+  }; // struct LazyAssociatedDataProxyMaker<>
+
+  /// @}
+  // --- END Associated data infrastructure ------------------------------------
+
+
+  //----------------------------------------------------------------------------
+  namespace details {
+
+    template <
+      typename Aux, typename Metadata /* = void */,
+      typename AuxTag /* = Aux */
+      >
+    struct LazyAssociatedDataProxyMakerWrapper {
+      template <typename CollProxy>
+      using maker_t = LazyAssociatedDataProxyMaker
+        <typename CollProxy::main_element_t, Aux, Metadata, CollProxy, AuxTag>;
+    };
+
+    template <
+      typename Aux, typename Metadata,
+      typename ArgTuple, typename AuxTag = Aux
+      >
+    using WithLazyAssociatedStruct = WithAssociatedStructBase<
+      Aux,
+      Metadata,
+      ArgTuple,
+      LazyAssociatedDataProxyMakerWrapper<Aux, Metadata, AuxTag>::template maker_t,
+      AuxTag
+      >;
+
+  } // namespace details
+
+
+  // --- BEGIN Associated data -------------------------------------------------
+  /// @addtogroup LArSoftProxiesAssociatedData
+  /// @{
+
+  //----------------------------------------------------------------------------
+  /**
+   * @brief Helper function to merge associated data parsed on demand.
+   * @tparam Aux type of associated data requested
+   * @tparam Metadata type of associated metadata requested
+   * @tparam AuxTag tag to access the associated data within the proxy
+   * @tparam Args types of constructor arguments for associated data collection
+   * @param args constructor arguments for the associated data collection
+   * @return a temporary object that `getCollection()` knows to handle
+   * @see `withAssociatedMetaAs()`
+   *
+   * This function behaves like `withAssociatedMetaAs()` and accepts the same
+   * arguments. The association is read from the event when the proxy is
+   * created, but the work of matching each main element with its associated
+   * data is postponed until the first time any associated data is accessed.
+   * This is convenient when only a small part of the proxy is going to be
+   * used, and costs a check on each access.
+   */
+  template <typename Aux, typename Metadata, typename AuxTag, typename... Args>
+  auto withLazyAssociatedMetaAs(Args&&... args) {
+    using ArgTuple_t = std::tuple<Args&&...>;
+    ArgTuple_t argsTuple(std::forward<Args>(args)...);
+    return details::WithLazyAssociatedStruct<Aux, Metadata, ArgTuple_t, AuxTag>
+      (std::move(argsTuple));
+  } // withLazyAssociatedMetaAs()
+
+
+  /// Like `withLazyAssociatedMetaAs()`, with no metadata.
+  template <typename Aux, typename AuxTag, typename... Args>
+  auto withLazyAssociatedAs(Args&&... args)
+    {
+      return withLazyAssociatedMetaAs<Aux, void, AuxTag>
+        (std::forward<Args>(args)...);
+    }
+
+
+  /// Like `withLazyAssociatedMetaAs()`, with `Aux` as tag.
+  template <typename Aux, typename Metadata, typename... Args>
+  auto withLazyAssociatedMeta(Args&&... args)
+    {
+      return withLazyAssociatedMetaAs<Aux, Metadata, Aux>
+        (std::forward<Args>(args)...);
+    }
+
+
+  /// Like `withLazyAssociatedMetaAs()`, with no metadata and `Aux` as tag.
+  template <typename Aux, typename... Args>
+  auto withLazyAssociated(Args&&... args)
+    { return withLazyAssociatedMeta<Aux, void>(std::forward<Args>(args)...); }
+
+
+  /// @}
+  // --- END Associated data ---------------------------------------------------
+
+
+} // namespace proxy
+
+
+#endif // LARDATA_RECOBASEPROXY_PROXYBASE_WITHLAZYASSOCIATED_H
@@ -241,6 +241,7 @@
 // framework libraries
 #include "canvas/Persistency/Common/Ptr.h"
 
+#include <algorithm> // std::min()
 #include <limits>
 #include <tuple>
 #include <vector>
@@ -519,6 +520,27 @@ namespace proxy {
   }; // struct Tracks
 
 
+  /**
+   * @brief Proxy tag for a `recob::Track` collection proxy with lazy hits.
+   * @see `proxy::Tracks`, `proxy::withLazyAssociated()`
+   * @ingroup LArSoftProxyReco
+   *
+   * This proxy tag selects the same proxy as `proxy::Tracks`, except that the
+   * associated hits are parsed only when first accessed, rather than when the
+   * proxy is created (see `proxy::withLazyAssociated()`).
+   * The interface of the proxy is the same, and auxiliary data may be added
+   * in the same way:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * auto tracks = proxy::getCollection<proxy::LazyTracks>(event, tag);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * This is convenient for modules which use only a small subset of the tracks
+   * in each event, or none at all. Other associations can be made lazy by
+   * requesting them via `proxy::withLazyAssociated()`.
+   */
+  struct LazyTracks: public Tracks {};
+
+
+
 
   //----------------------------------------------------------------------------
   //---  track point information
@@ -1258,6 +1280,144 @@ namespace proxy {
   }; // struct CollectionProxyMaker<>
 
 
+  //----------------------------------------------------------------------------
+  /// Define the traits of `proxy::LazyTracks` proxy (same as `proxy::Tracks`).
+  template <>
+  struct CollectionProxyMakerTraits<LazyTracks>
+    : public CollectionProxyMakerTraits<Tracks>
+  {};
+
+
+  //----------------------------------------------------------------------------
+  /// Specialization to create a proxy for `recob::Track` with lazy hits.
+  template <>
+  struct CollectionProxyMaker<LazyTracks>
+    : public CollectionProxyMakerBase<LazyTracks>
+  {
+
+    /// Base class.
+    using maker_base_t = CollectionProxyMakerBase<LazyTracks>;
+
+    /**
+     * @brief Creates and returns a collection proxy for `recob::Track` based on
+     *        `proxy::LazyTracks` tag and with the requested associated data.
+     * @see `CollectionProxyMaker<Tracks>::make()`
+     *
+     * Associated hits (tag: `recob::Hit`) are automatically added to the proxy
+     * and must not be explicitly specified; they are parsed on first access.
+     */
+    template <typename Event, typename... WithArgs>
+    static auto make
+      (Event const& event, art::InputTag const& tag, WithArgs&&... withArgs)
+      {
+        return maker_base_t::make(
+          event, tag,
+          withLazyAssociatedAs<recob::Hit, Tracks::HitTag>(),
+          std::forward<WithArgs>(withArgs)...
+          );
+      } // make()
+
+  }; // struct CollectionProxyMaker<LazyTracks>
+
+
+  //----------------------------------------------------------------------------
+  //---  columnar track point information
+  //---
+  /**
+   * @brief Trajectory point information of many tracks, in contiguous arrays.
+   * @see `proxy::makeTrackPointColumns()`
+   * @ingroup LArSoftProxyReco
+   *
+   * The information of all the trajectory points of a set of tracks is stored
+   * "by column": all the _x_ coordinates of the positions of the points are
+   * in a single array `x`, and so on for the other coordinates, the momentum
+   * components, the point flags and the pointers to the associated hits.
+   * The points of each track are contiguous, in the same order as in the
+   * trajectory, and tracks follow each other in the order they were added.
+   * The points of the track number `i` are the ones with index from
+   * `beginPoint(i)` to `endPoint(i)` (excluded).
+   *
+   * This layout is suitable for algorithms processing many points at once,
+   * which can loop over plain arrays instead of querying each point proxy.
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * auto tracks = proxy::getCollection<proxy::Tracks>(event, tag);
+   * auto const columns = proxy::makeTrackPointColumns(tracks);
+   * double sumZ = 0.0;
+   * for (std::size_t i = 0; i < columns.nPoints(); ++i) sumZ += columns.z[i];
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   *
+   * The content is a copy: it stays valid after the proxy is gone.
+   */
+  struct TrackPointColumns {
+
+    /// Type of coordinate and momentum component.
+    using Coord_t = recob::Track::Point_t::Scalar;
+
+    /// Type of point flags.
+    using PointFlags_t = recob::Track::PointFlags_t;
+
+    /// Index of the first point of each track, plus the total number of points.
+    std::vector<std::size_t> trackOffsets { 0U };
+
+    std::vector<Coord_t> x; ///< Position _x_ coordinate of each point.
+    std::vector<Coord_t> y; ///< Position _y_ coordinate of each point.
+    std::vector<Coord_t> z; ///< Position _z_ coordinate of each point.
+
+    std::vector<Coord_t> px; ///< Momentum _x_ component of each point.
+    std::vector<Coord_t> py; ///< Momentum _y_ component of each point.
+    std::vector<Coord_t> pz; ///< Momentum _z_ component of each point.
+
+    std::vector<PointFlags_t> flags; ///< Flags of each point.
+
+    /// Pointer to the hit associated to each point (null if none).
+    std::vector<art::Ptr<recob::Hit>> hitPtrs;
+
+
+    /// Returns the number of tracks stored.
+    std::size_t nTracks() const { return trackOffsets.size() - 1U; }
+
+    /// Returns the total number of points stored.
+    std::size_t nPoints() const { return trackOffsets.back(); }
+
+    /// Returns the index of the first point of the specified track.
+    std::size_t beginPoint(std::size_t iTrack) const
+      { return trackOffsets[iTrack]; }
+
+    /// Returns the index after the last point of the specified track.
+    std::size_t endPoint(std::size_t iTrack) const
+      { return trackOffsets[iTrack + 1U]; }
+
+    /// Returns the number of points of the specified track.
+    std::size_t nPoints(std::size_t iTrack) const
+      { return endPoint(iTrack) - beginPoint(iTrack); }
+
+    /// Prepares the storage for the specified number of tracks and points.
+    void reserve(std::size_t nTracks, std::size_t nPoints);
+
+    /// Appends all the points of the specified track proxy.
+    template <typename TrackProxy>
+    void addTrack(TrackProxy const& track);
+
+    /// Removes all the content.
+    void clear();
+
+  }; // struct TrackPointColumns
+
+
+  /**
+   * @brief Returns the point information of all tracks in columnar format.
+   * @tparam TrackCollProxy type of track collection proxy
+   * @param tracks the collection proxy of the tracks (e.g. `proxy::Tracks`)
+   * @return a `TrackPointColumns` with all the points of all `tracks`
+   *
+   * Track number `i` in the result is the track number `i` in `tracks`.
+   */
+  template <typename TrackCollProxy>
+  TrackPointColumns makeTrackPointColumns(TrackCollProxy const& tracks);
+
+
+
   /// "Converts" point data into a `proxy::TrackPointWrapper`.
   template <typename Data>
   auto wrapTrackPoint(Data const& wrappedData)
@@ -1417,6 +1577,92 @@ namespace proxy {
   } // TrackCollectionProxyElement<>::fitInfoAtPoint()
 
 
+  //----------------------------------------------------------------------------
+  //--- TrackPointColumns
+  //----------------------------------------------------------------------------
+  inline void TrackPointColumns::reserve
+    (std::size_t nTracks, std::size_t nPoints)
+  {
+    trackOffsets.reserve(nTracks + 1U);
+    x.reserve(nPoints);
+    y.reserve(nPoints);
+    z.reserve(nPoints);
+    px.reserve(nPoints);
+    py.reserve(nPoints);
+    pz.reserve(nPoints);
+    flags.reserve(nPoints);
+    hitPtrs.reserve(nPoints);
+  } // TrackPointColumns::reserve()
+
+
+  //----------------------------------------------------------------------------
+  template <typename TrackProxy>
+  void TrackPointColumns::addTrack(TrackProxy const& track) {
+    static_assert(details::isTrackProxy<TrackProxy>(), "Not a proxy::Track!");
+
+    recob::TrackTrajectory const& traj = track.track().Trajectory();
+    std::size_t const nTrackPoints = track.nPoints();
+    std::size_t const nNewPoints = nPoints() + nTrackPoints;
+
+    x.resize(nNewPoints);
+    y.resize(nNewPoints);
+    z.resize(nNewPoints);
+    px.resize(nNewPoints);
+    py.resize(nNewPoints);
+    pz.resize(nNewPoints);
+    flags.resize(nNewPoints);
+    hitPtrs.resize(nNewPoints);
+
+    // hits are sequential with points; `hits()` is parsed only once here
+    auto const& hits = track.hits();
+    std::size_t const nHits = std::min(hits.size(), nTrackPoints);
+
+    std::size_t iDest = nPoints();
+    for (std::size_t iPoint = 0; iPoint < nTrackPoints; ++iPoint, ++iDest) {
+      auto const& pos = traj.LocationAtPoint(iPoint);
+      x[iDest] = pos.X();
+      y[iDest] = pos.Y();
+      z[iDest] = pos.Z();
+      auto const& mom = traj.MomentumVectorAtPoint(iPoint);
+      px[iDest] = mom.X();
+      py[iDest] = mom.Y();
+      pz[iDest] = mom.Z();
+      flags[iDest] = traj.FlagsAtPoint(iPoint);
+      if (iPoint < nHits) hitPtrs[iDest] = hits[iPoint];
+    } // for
+
+    trackOffsets.push_back(nNewPoints);
+  } // TrackPointColumns::addTrack()
+
+
+  //----------------------------------------------------------------------------
+  inline void TrackPointColumns::clear() {
+    trackOffsets.assign(1U, 0U);
+    x.clear();
+    y.clear();
+    z.clear();
+    px.clear();
+    py.clear();
+    pz.clear();
+    flags.clear();
+    hitPtrs.clear();
+  } // TrackPointColumns::clear()
+
+
+  //----------------------------------------------------------------------------
+  template <typename TrackCollProxy>
+  TrackPointColumns makeTrackPointColumns(TrackCollProxy const& tracks) {
+    TrackPointColumns columns;
+
+    std::size_t nPoints = 0U;
+    for (auto const& track: tracks) nPoints += track.nPoints();
+    columns.reserve(tracks.size(), nPoints);
+
+    for (auto const& track: tracks) columns.addTrack(track);
+    return columns;
+  } // makeTrackPointColumns()
+
+
   //----------------------------------------------------------------------------
   template <typename CollProxy>
   template <typename Pred>
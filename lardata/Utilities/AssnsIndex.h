@@ -0,0 +1,444 @@
+/**
+ * @file   lardata/Utilities/AssnsIndex.h
+ * @brief  Random access index of the groups of an association.
+ * @date   October 19, 2026
+ * @see    lardata/Utilities/ForEachAssociatedGroup.h
+ *
+ * This library is header-only.
+ *
+ */
+
+#ifndef LARDATA_UTILITIES_ASSNSINDEX_H
+#define LARDATA_UTILITIES_ASSNSINDEX_H
+
+// LArSoft libraries
+#include "lardata/Utilities/CollectionView.h"
+#include "lardata/Utilities/ParallelCountingSort.h"
+
+// framework libraries
+#include "canvas/Persistency/Common/Ptr.h"
+#include "canvas/Persistency/Provenance/ProductID.h"
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <memory> // std::unique_ptr<>
+#include <mutex> // std::call_once()
+#include <numeric> // std::iota()
+#include <iterator> // std::prev()
+#include <limits> // std::numeric_limits<>
+#include <cstddef> // std::size_t
+
+
+namespace util {
+
+  /**
+   * @brief Compressed sparse row index of an association, by left key.
+   * @tparam Assns type of the association (`art::Assns<L, R>` or
+   *               `art::Assns<L, R, D>`)
+   * @see `util::associated_groups()`
+   *
+   * `util::associated_groups()` and `art::for_each_group()` walk an
+   * association sorted by left pointer, one group after the other.
+   * This index gives instead random access to the group of any left object,
+   * in constant time, and does not require the association to be sorted.
+   *
+   * The index is meant for associations whose left pointers all belong to the
+   * same data product, as the ones created by a module associating its own
+   * products to something else: each group is identified by the key of its
+   * left object. Left keys with no association have an empty group.
+   *
+   * The right pointers of each group are stored contiguously, together with
+   * their keys and with the position of each association in the original
+   * `art::Assns` (which gives access to the association metadata, if any).
+   * Within a group, they keep the order they have in the association.
+   *
+   * Example: assuming that a module with input tag stored in `fTrackTag` has
+   * created associations of each track to its hits:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * auto const& tracks
+   *   = *event.getValidHandle<std::vector<recob::Track>>(fTrackTag);
+   * auto const& assns
+   *   = *event.getValidHandle<art::Assns<recob::Track, recob::Hit>>(fTrackTag);
+   *
+   * util::AssnsIndex<art::Assns<recob::Track, recob::Hit>> const trackHits
+   *   (assns, tracks.size());
+   *
+   * for (art::Ptr<recob::Hit> const& hit: trackHits.group(5)) // hits of track #5
+   *   // ...
+   *
+   * // tracks each hit belongs to
+   * auto const& hitTracks = trackHits.inverse();
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   *
+   * Construction
+   * -------------
+   *
+   * If the association is already sorted by left key, the index is built with
+   * two passes on it. Otherwise, a stable counting sort is performed, which
+   * can be split across `nThreads` threads: each thread counts the groups in
+   * its own section of the association, and after a prefix sum each thread
+   * places the elements of its section (see `util::parallelCountingSort()`).
+   * The cost is linear in the number of associations (plus the number of
+   * threads times the number of left keys).
+   *
+   * Inverse index
+   * --------------
+   *
+   * `inverse()` returns an index of the left pointers associated to each
+   * right object. It is built at the first call (in a thread-safe way).
+   * Since right pointers may come from multiple data products, the inverse
+   * index is organised by right product ID and key.
+   * The left pointers are copies of the ones in the association (the first
+   * one met for each left key), so they can be dereferenced like those.
+   */
+  template <typename Assns>
+  class AssnsIndex {
+
+      public:
+    using assns_t = Assns; ///< Type of the indexed association.
+    using left_t = typename assns_t::left_t; ///< Type of left objects.
+    using right_t = typename assns_t::right_t; ///< Type of right objects.
+    using LeftPtr_t = art::Ptr<left_t>; ///< Pointer to left objects.
+    using RightPtr_t = art::Ptr<right_t>; ///< Pointer to right objects.
+
+    /// Type of a sequence of `T` elements in the index.
+    template <typename T>
+    using Range_t
+      = lar::RangeAsCollection_t<typename std::vector<T>::const_iterator>;
+
+    /// Index of the left objects associated to each right object.
+    class Inverse;
+
+    /**
+     * @brief Constructor: indexes the specified association.
+     * @param assns the association to be indexed
+     * @param nLeft _(default: `0`)_ number of left keys (e.g. size of the
+     *              left data product); if smaller than the largest key in
+     *              `assns` (e.g. `0`), the latter is used
+     * @param nThreads _(default: `1`)_ threads to use for sorting
+     * @throw cet::exception (category: `AssnsIndex`) if the left pointers
+     *        belong to different data products
+     *
+     * The association is not needed after the index is constructed.
+     */
+    AssnsIndex
+      (assns_t const& assns, std::size_t nLeft = 0U, unsigned int nThreads = 1U);
+
+    /// Returns the number of indexed left keys (groups).
+    std::size_t size() const { return fOffsets.size() - 1U; }
+
+    /// Returns the total number of associations.
+    std::size_t nAssns() const { return fRights.size(); }
+
+    /// Returns the ID of the data product of the left objects.
+    art::ProductID leftID() const { return fLeftID; }
+
+    /// Returns the left pointer with key `key` from the association (null if
+    /// that key has no association; no check on `key`).
+    LeftPtr_t const& left(std::size_t key) const { return fLefts[key]; }
+
+    /// Returns the number of objects associated to left key `key` (no check).
+    std::size_t groupSize(std::size_t key) const
+      { return fOffsets[key + 1] - fOffsets[key]; }
+
+    /// Returns the right pointers associated to left key `key` (no check).
+    Range_t<RightPtr_t> group(std::size_t key) const
+      { return makeRange(fRights, key); }
+
+    /// Returns the right pointers associated to the left object `left`.
+    /// @throw cet::exception if `left` is not from the indexed data product
+    Range_t<RightPtr_t> group(LeftPtr_t const& left) const;
+
+    /// Returns the keys of the right objects associated to left key `key`.
+    Range_t<std::size_t> rightKeys(std::size_t key) const
+      { return makeRange(fRightKeys, key); }
+
+    /// Returns the positions in the association of the group of `key`.
+    Range_t<std::size_t> positions(std::size_t key) const
+      { return makeRange(fPositions, key); }
+
+    /// Returns all right pointers, grouped by left key.
+    std::vector<RightPtr_t> const& rights() const { return fRights; }
+
+    /// Returns the offsets of each group in `rights()` (`size() + 1` entries).
+    std::vector<std::size_t> const& offsets() const { return fOffsets; }
+
+    /// Returns the inverse index (right to left), building it if needed.
+    Inverse const& inverse() const;
+
+
+      private:
+    art::ProductID fLeftID; ///< ID of the left data product.
+    std::vector<LeftPtr_t> fLefts; ///< Left pointer of each key, from assns.
+    std::vector<std::size_t> fOffsets { 0U }; ///< Group boundaries.
+    std::vector<RightPtr_t> fRights; ///< Right pointers, grouped.
+    std::vector<std::size_t> fRightKeys; ///< Keys of `fRights`.
+    std::vector<std::size_t> fPositions; ///< Position of `fRights` in assns.
+
+    /// Inverse index, created on demand.
+    struct InverseCache_t {
+      std::once_flag flag; ///< Guard of inverse creation.
+      std::unique_ptr<Inverse> inverse; ///< Cached inverse index.
+    };
+    /// Cache of the inverse index (via pointer, to keep the index movable).
+    std::unique_ptr<InverseCache_t> fInverse
+      = std::make_unique<InverseCache_t>();
+
+    /// Returns the range of the group `key` within `data`.
+    template <typename T>
+    Range_t<T> makeRange(std::vector<T> const& data, std::size_t key) const
+      {
+        return lar::makeCollectionView
+          (data.cbegin() + fOffsets[key], data.cbegin() + fOffsets[key + 1]);
+      }
+
+  }; // class AssnsIndex<>
+
+
+  /**
+   * @brief Index of the left objects associated to each right object.
+   *
+   * Right objects are identified by their pointer, or by product ID and key.
+   * The left pointers of each right object keep the order they have in the
+   * association.
+   */
+  template <typename Assns>
+  class AssnsIndex<Assns>::Inverse {
+
+      public:
+    /// Value returned by `rowOf()` for right objects with no association.
+    static constexpr std::size_t NoRow = std::numeric_limits<std::size_t>::max();
+
+    /// Returns the left pointers associated to the right object `right`.
+    Range_t<LeftPtr_t> group(RightPtr_t const& right) const
+      { return group(right.id(), right.key()); }
+
+    /// Returns the left pointers associated to the right object `key` from
+    /// the data product `id`.
+    Range_t<LeftPtr_t> group(art::ProductID const& id, std::size_t key) const;
+
+    /// Returns the positions in the association of the group of `right`.
+    Range_t<std::size_t> positions(RightPtr_t const& right) const;
+
+    /// Returns the IDs of all the right data products.
+    std::vector<art::ProductID> const& rightIDs() const { return fIDs; }
+
+      private:
+    friend class AssnsIndex<Assns>;
+
+    std::vector<art::ProductID> fIDs; ///< IDs of right products.
+    std::vector<std::size_t> fFirstRow; ///< First row of each right product.
+    std::vector<std::size_t> fOffsets { 0U }; ///< Group boundaries.
+    std::vector<LeftPtr_t> fLefts; ///< Left pointers, grouped by right.
+    std::vector<std::size_t> fPositions; ///< Position of `fLefts` in assns.
+
+    /// Returns the row of the right object, or `NoRow`.
+    std::size_t rowOf(art::ProductID const& id, std::size_t key) const;
+
+    template <typename T>
+    Range_t<T> makeRange(std::vector<T> const& data, std::size_t row) const
+      {
+        if (row == NoRow)
+          return lar::makeCollectionView(data.cend(), data.cend());
+        return lar::makeCollectionView
+          (data.cbegin() + fOffsets[row], data.cbegin() + fOffsets[row + 1]);
+      }
+
+  }; // class AssnsIndex<>::Inverse
+
+
+  /// Returns an index of `assns` (see `util::AssnsIndex`).
+  template <typename Assns>
+  AssnsIndex<Assns> makeAssnsIndex
+    (Assns const& assns, std::size_t nLeft = 0U, unsigned int nThreads = 1U)
+    { return AssnsIndex<Assns>(assns, nLeft, nThreads); }
+
+
+} // namespace util
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Assns>
+util::AssnsIndex<Assns>::AssnsIndex(
+  assns_t const& assns,
+  std::size_t nLeft /* = 0U */, unsigned int nThreads /* = 1U */
+) {
+  std::size_t const N = assns.size();
+
+  //
+  // first pass: left product, number of keys and whether already sorted
+  //
+  bool sorted = true;
+  std::size_t nKeys = nLeft;
+  std::size_t lastKey = 0U;
+  for (std::size_t i = 0; i < N; ++i) {
+    LeftPtr_t const& left = assns[i].first;
+    if (i == 0) fLeftID = left.id();
+    else if (left.id() != fLeftID) {
+      throw cet::exception("AssnsIndex")
+        << "Association #" << i << " has left object from product "
+        << left.id() << ", while previous ones were from " << fLeftID << "\n";
+    }
+    std::size_t const key = left.key();
+    if (key < lastKey) sorted = false;
+    lastKey = key;
+    if (key >= nKeys) nKeys = key + 1U;
+  } // for
+
+  //
+  // second pass: the order of the associations, and the group boundaries
+  //
+  if (sorted) {
+    fOffsets.assign(nKeys + 1U, 0U);
+    fPositions.resize(N);
+    std::iota(fPositions.begin(), fPositions.end(), 0U);
+    for (std::size_t i = 0; i < N; ++i) ++fOffsets[assns[i].first.key() + 1U];
+    for (std::size_t key = 0; key < nKeys; ++key)
+      fOffsets[key + 1U] += fOffsets[key];
+  }
+  else {
+    fPositions.resize(N);
+    fOffsets = parallelCountingSort(
+      N, nKeys,
+      [&assns](std::size_t i){ return assns[i].first.key(); },
+      [this](std::size_t i, std::size_t slot){ fPositions[slot] = i; },
+      nThreads
+      );
+  }
+
+  //
+  // final pass: copy of the left pointers (one per key) and of the right
+  // pointers, in the sorted order
+  //
+  fLefts.resize(nKeys);
+  for (std::size_t key = 0; key < nKeys; ++key) {
+    if (fOffsets[key] == fOffsets[key + 1U]) continue;
+    fLefts[key] = assns[fPositions[fOffsets[key]]].first;
+  } // for
+  fRights.reserve(N);
+  fRightKeys.reserve(N);
+  for (std::size_t const pos: fPositions) {
+    RightPtr_t const& right = assns[pos].second;
+    fRights.push_back(right);
+    fRightKeys.push_back(right.key());
+  } // for
+
+} // util::AssnsIndex<>::AssnsIndex()
+
+
+//------------------------------------------------------------------------------
+template <typename Assns>
+auto util::AssnsIndex<Assns>::group(LeftPtr_t const& left) const
+  -> Range_t<RightPtr_t>
+{
+  if (left.id() != fLeftID) {
+    throw cet::exception("AssnsIndex")
+      << "Left pointer " << left << " is not from the indexed product "
+      << fLeftID << "\n";
+  }
+  if (left.key() >= size()) // no association for this one
+    return lar::makeCollectionView(fRights.cend(), fRights.cend());
+  return group(left.key());
+} // util::AssnsIndex<>::group(Ptr)
+
+
+//------------------------------------------------------------------------------
+template <typename Assns>
+auto util::AssnsIndex<Assns>::inverse() const -> Inverse const& {
+
+  std::call_once(fInverse->flag, [this]()
+    {
+      auto inv = std::make_unique<Inverse>();
+
+      // row blocks for each right product
+      std::vector<std::size_t> nKeys;
+      for (RightPtr_t const& right: fRights) {
+        std::size_t iID = 0;
+        while ((iID < inv->fIDs.size()) && (inv->fIDs[iID] != right.id()))
+          ++iID;
+        if (iID == inv->fIDs.size()) {
+          inv->fIDs.push_back(right.id());
+          nKeys.push_back(0U);
+        }
+        if (right.key() >= nKeys[iID]) nKeys[iID] = right.key() + 1U;
+      } // for
+      std::size_t nRows = 0U;
+      for (std::size_t const n: nKeys) {
+        inv->fFirstRow.push_back(nRows);
+        nRows += n;
+      }
+
+      // counting sort by right object; it's stable, so left pointers are
+      // in association order within each group
+      inv->fOffsets.assign(nRows + 1U, 0U);
+      for (RightPtr_t const& right: fRights)
+        ++(inv->fOffsets[inv->rowOf(right.id(), right.key()) + 1U]);
+      for (std::size_t iRow = 0; iRow < nRows; ++iRow)
+        inv->fOffsets[iRow + 1U] += inv->fOffsets[iRow];
+
+      // left key of each of our entries, and our entry at each position
+      std::size_t const N = fRights.size();
+      std::vector<std::size_t> leftKeys(N), entryAt(N);
+      for (std::size_t key = 0; key < size(); ++key) {
+        for (std::size_t i = fOffsets[key]; i < fOffsets[key + 1]; ++i)
+          leftKeys[i] = key;
+      }
+      for (std::size_t i = 0; i < N; ++i) entryAt[fPositions[i]] = i;
+
+      // placement following the association order
+      inv->fLefts.resize(N);
+      inv->fPositions.resize(N);
+      std::vector<std::size_t> next
+        (inv->fOffsets.begin(), std::prev(inv->fOffsets.end()));
+      for (std::size_t pos = 0; pos < N; ++pos) {
+        std::size_t const i = entryAt[pos];
+        RightPtr_t const& right = fRights[i];
+        std::size_t const slot = next[inv->rowOf(right.id(), right.key())]++;
+        inv->fLefts[slot] = fLefts[leftKeys[i]];
+        inv->fPositions[slot] = pos;
+      } // for
+
+      fInverse->inverse = std::move(inv);
+    });
+
+  return *(fInverse->inverse);
+} // util::AssnsIndex<>::inverse()
+
+
+//------------------------------------------------------------------------------
+template <typename Assns>
+std::size_t util::AssnsIndex<Assns>::Inverse::rowOf
+  (art::ProductID const& id, std::size_t key) const
+{
+  for (std::size_t iID = 0; iID < fIDs.size(); ++iID) {
+    if (fIDs[iID] != id) continue;
+    std::size_t const row = fFirstRow[iID] + key;
+    std::size_t const endRow = (iID + 1 < fIDs.size())
+      ? fFirstRow[iID + 1]: fOffsets.size() - 1U;
+    return (row < endRow)? row: NoRow;
+  } // for
+  return NoRow;
+} // util::AssnsIndex<>::Inverse::rowOf()
+
+
+//------------------------------------------------------------------------------
+template <typename Assns>
+auto util::AssnsIndex<Assns>::Inverse::group
+  (art::ProductID const& id, std::size_t key) const -> Range_t<LeftPtr_t>
+  { return makeRange(fLefts, rowOf(id, key)); }
+
+
+//------------------------------------------------------------------------------
+template <typename Assns>
+auto util::AssnsIndex<Assns>::Inverse::positions
+  (RightPtr_t const& right) const -> Range_t<std::size_t>
+  { return makeRange(fPositions, rowOf(right.id(), right.key())); }
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // LARDATA_UTILITIES_ASSNSINDEX_H
@@ -87,6 +87,10 @@ namespace lar {
    * member). Each allocator type has its own singleton, i.e., a
    * BulkAllocator<int> does not share memory with a BulkAllocator<double>,
    * but all BulkAllocator<int> share.
+   *
+   * @note This allocator is not thread-safe. `lar::ThreadBulkAllocator`
+   *       (in `lardata/Utilities/ThreadBulkAllocator.h`) offers the same
+   *       allocation policy with per-thread memory arenas.
    */
   template <typename T>
   class BulkAllocator: public std::allocator<T> {
@@ -120,6 +120,33 @@ namespace lar {
       void add(Data_t x, Data_t y, Data_t s)
         { fChiSq += sqr(z(y, expected(x), s)); ++fN; }
 
+      /**
+       * @brief Removes a data point from the &chi;&sup2;.
+       * @param x parameter
+       * @param y observed data with the `x` parameter
+       * @see `add(Data_t, Data_t)`
+       *
+       * The point must have been previously added with `add(x, y)`.
+       * Together with `add()`, this allows to keep the &chi;&sup2; of a window
+       * of points sliding on the data, at a constant cost per step.
+       * Subtraction accumulates rounding errors, which are discarded when the
+       * last point is removed.
+       */
+      void remove(Data_t x, Data_t y)
+        { subtract(sqr(y - expected(x))); }
+
+      /**
+       * @brief Removes a data point from the &chi;&sup2;.
+       * @param x parameter
+       * @param y observed data with the `x` parameter
+       * @param s uncertainty on the observed data
+       * @see `add(Data_t, Data_t, Data_t)`, `remove(Data_t, Data_t)`
+       *
+       * The point must have been previously added with `add(x, y, s)`.
+       */
+      void remove(Data_t x, Data_t y, Data_t s)
+        { subtract(sqr(z(y, expected(x), s))); }
+
       /// Resets all the counts, starting from no data.
       void clear() { fChiSq = Data_t{0}; fN = 0U; }
 
@@ -139,6 +166,13 @@ namespace lar {
       /// The usual square function.
       static Data_t sqr(Data_t v) { return v*v; }
 
+      /// Removes a contribution to the &chi;&sup2; and a point.
+      void subtract(Data_t chi2)
+        {
+          if (fN <= 1U) clear(); // start again from an exact 0
+          else { fChiSq -= chi2; --fN; }
+        }
+
     }; // ChiSquareAccumulator<>
 
 
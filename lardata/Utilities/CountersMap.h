@@ -10,8 +10,12 @@
 
 // interface include
 #include <cstddef> // std::ptrdiff_t
+#include <cstdint> // std::uint64_t
+#include <climits> // CHAR_BIT
 #include <map>
+#include <vector>
 #include <array>
+#include <algorithm> // std::lower_bound(), std::sort()
 #include <functional> // std::less<>
 #include <memory> // std::allocator<>
 #include <utility> // std::pair<>
@@ -29,6 +33,33 @@ namespace lar {
   constexpr int LowestSetBit(unsigned long long int v);
 
 
+  /// Storage options for the blocks of `lar::CountersMap`.
+  namespace counters_map {
+
+    /// Blocks stored in a `std::map` (default).
+    struct TreeStorage {};
+
+    /**
+     * @brief Blocks stored in a flat hash table with open addressing.
+     *
+     * Access to a counter costs a hash and (usually) a single memory lookup.
+     * Iteration requires the blocks to be sorted, which is done at the first
+     * `begin()` after new blocks were created.
+     */
+    struct HashStorage {};
+
+    /**
+     * @brief Blocks stored in a vector sorted by key.
+     *
+     * Access to a counter is a binary search on contiguous memory; creation
+     * of a new block requires moving all the blocks after it. This is best
+     * suited for counters whose blocks are mostly created in key order.
+     */
+    struct FlatStorage {};
+
+  } // namespace counters_map
+
+
   namespace details {
 
     /// Type of block of counters (just a STL array until SUBCOUNTERS are in)
@@ -56,10 +87,305 @@ namespace lar {
 
     }; // CounterBlock
 
+
+    namespace counters_map {
+
+      /**
+       * @brief Storage of counter blocks in a `std::map`.
+       *
+       * All the block storage classes expose the same minimal interface:
+       * `find_block()` returns a pointer to the block with the specified key
+       * (`nullptr` if not present), `get_or_create_block()` returns a block,
+       * creating it with all counters set to `0` if needed, and the constant
+       * iterators visit `(key, block)` pairs sorted by key.
+       */
+      template <typename Key, typename Block, typename Alloc>
+      class TreeBlockMap: public std::map<Key, Block, std::less<Key>, Alloc> {
+        using Base_t = std::map<Key, Block, std::less<Key>, Alloc>;
+          public:
+        using Base_t::Base_t;
+
+        /// Returns the block with the specified key, `nullptr` if none.
+        Block const* find_block(Key key) const
+          {
+            auto const iBlock = Base_t::find(key);
+            return (iBlock == Base_t::end())? nullptr: &(iBlock->second);
+          }
+
+        /// Returns the block with the specified key, creating it if needed.
+        Block& get_or_create_block(Key key) { return Base_t::operator[](key); }
+
+      }; // class TreeBlockMap
+
+
+      /**
+       * @brief Storage of counter blocks in a sorted vector.
+       * @see TreeBlockMap for the interface
+       */
+      template <typename Key, typename Block, typename Alloc>
+      class FlatBlockMap {
+          public:
+        using value_type = std::pair<Key, Block>;
+        using allocator_type = Alloc;
+
+          private:
+        using Blocks_t = std::vector<value_type, Alloc>;
+
+          public:
+        using const_iterator = typename Blocks_t::const_iterator;
+
+        FlatBlockMap() = default;
+        FlatBlockMap(Alloc const& alloc): blocks(alloc) {}
+
+        const_iterator begin() const { return blocks.begin(); }
+        const_iterator end() const { return blocks.end(); }
+
+        bool empty() const { return blocks.empty(); }
+        std::size_t size() const { return blocks.size(); }
+        void clear() { blocks.clear(); }
+
+        /// Prepares memory for the specified number of blocks.
+        void reserve(std::size_t n) { blocks.reserve(n); }
+
+        /// Returns the block with the specified key, `nullptr` if none.
+        Block const* find_block(Key key) const
+          {
+            auto const iBlock = lower_bound(key);
+            return ((iBlock == blocks.end()) || (iBlock->first != key))
+              ? nullptr: &(iBlock->second);
+          }
+
+        /// Returns the block with the specified key, creating it if needed.
+        Block& get_or_create_block(Key key)
+          {
+            auto iBlock = lower_bound(key);
+            if ((iBlock == blocks.end()) || (iBlock->first != key))
+              iBlock = blocks.emplace(iBlock, key, Block());
+            return iBlock->second;
+          }
+
+          private:
+        Blocks_t blocks; ///< Blocks, sorted by key.
+
+        typename Blocks_t::const_iterator lower_bound(Key key) const
+          {
+            return std::lower_bound(blocks.begin(), blocks.end(), key,
+              [](value_type const& a, Key b){ return a.first < b; });
+          }
+        typename Blocks_t::iterator lower_bound(Key key)
+          {
+            return std::lower_bound(blocks.begin(), blocks.end(), key,
+              [](value_type const& a, Key b){ return a.first < b; });
+          }
+
+      }; // class FlatBlockMap
+
+
+      /**
+       * @brief Storage of counter blocks in an open-addressing hash table.
+       * @tparam KeyBits number of low bits of the key which are always 0
+       * @see TreeBlockMap for the interface
+       *
+       * Blocks are stored directly in the table slots, and collisions are
+       * resolved by linear probing. Blocks are never removed.
+       * Iteration follows the key order: a list of the occupied slots is
+       * kept and sorted on demand when iteration starts.
+       * Creating a block invalidates all iterators.
+       */
+      template <typename Key, typename Block, typename Alloc, int KeyBits>
+      class HashBlockMap {
+          public:
+        using value_type = std::pair<Key, Block>;
+        using allocator_type = Alloc;
+
+          private:
+        using Slots_t = std::vector<value_type, Alloc>;
+        using Used_t = std::vector<bool,
+          typename std::allocator_traits<Alloc>::template rebind_alloc<bool>
+          >;
+        using Order_t = std::vector<std::size_t,
+          typename std::allocator_traits<Alloc>::template rebind_alloc
+            <std::size_t>
+          >;
+
+          public:
+        /// Iterator through the blocks, in key order.
+        class const_iterator {
+            public:
+          using value_type = typename HashBlockMap::value_type;
+          using difference_type = std::ptrdiff_t;
+          using pointer = value_type const*;
+          using reference = value_type const&;
+          using iterator_category = std::bidirectional_iterator_tag;
+
+          const_iterator() = default;
+          const_iterator
+            (value_type const* slots, typename Order_t::const_iterator it)
+            : slots(slots), it(it) {}
+
+          reference operator*() const { return slots[*it]; }
+          pointer operator->() const { return slots + *it; }
+
+          const_iterator& operator++() { ++it; return *this; }
+          const_iterator operator++(int)
+            { const_iterator old(*this); ++it; return old; }
+          const_iterator& operator--() { --it; return *this; }
+          const_iterator operator--(int)
+            { const_iterator old(*this); --it; return old; }
+
+          bool operator== (const_iterator const& other) const
+            { return it == other.it; }
+          bool operator!= (const_iterator const& other) const
+            { return it != other.it; }
+
+            private:
+          value_type const* slots = nullptr;
+          typename Order_t::const_iterator it;
+        }; // class const_iterator
+
+
+        HashBlockMap() = default;
+        HashBlockMap(Alloc const& alloc)
+          : slots(alloc), used(alloc), order(alloc) {}
+
+        /// Returns an iterator to the block with the lowest key.
+        const_iterator begin() const
+          { sortOrder(); return { slots.data(), order.begin() }; }
+
+        /// Returns an iterator past the block with the highest key.
+        const_iterator end() const
+          { sortOrder(); return { slots.data(), order.end() }; }
+
+        bool empty() const { return order.empty(); }
+        std::size_t size() const { return order.size(); }
+        void clear()
+          { slots.clear(); used.clear(); order.clear(); sorted = true; }
+
+        /// Prepares the table for the specified number of blocks.
+        void reserve(std::size_t n)
+          { if (needsGrowth(n)) rehash(capacityFor(n)); }
+
+        /// Returns the block with the specified key, `nullptr` if none.
+        Block const* find_block(Key key) const
+          {
+            if (slots.empty()) return nullptr;
+            std::size_t const mask = slots.size() - 1;
+            for (std::size_t i = hash(key) & mask; used[i]; i = (i + 1) & mask)
+              if (slots[i].first == key) return &(slots[i].second);
+            return nullptr;
+          }
+
+        /// Returns the block with the specified key, creating it if needed.
+        Block& get_or_create_block(Key key)
+          {
+            if (needsGrowth(size() + 1)) rehash(capacityFor(size() + 1));
+            std::size_t const mask = slots.size() - 1;
+            std::size_t i = hash(key) & mask;
+            for (; used[i]; i = (i + 1) & mask)
+              if (slots[i].first == key) return slots[i].second;
+            slots[i].first = key;
+            used[i] = true;
+            order.push_back(i);
+            sorted = false;
+            return slots[i].second;
+          }
+
+          private:
+        static constexpr std::size_t MinCapacity = 16;
+
+        Slots_t slots; ///< Table of blocks (size is a power of 2).
+        Used_t used; ///< Whether each slot is occupied.
+        mutable Order_t order; ///< Occupied slots (sorted if `sorted`).
+        mutable bool sorted = true; ///< Whether `order` follows key order.
+
+        /// Returns whether the table is too small for `n` blocks.
+        bool needsGrowth(std::size_t n) const
+          { return n * 4 > slots.size() * 3; } // load factor 0.75
+
+        /// Returns the smallest table capacity suitable for `n` blocks.
+        static std::size_t capacityFor(std::size_t n)
+          {
+            std::size_t capacity = MinCapacity;
+            while (n * 4 > capacity * 3) capacity *= 2;
+            return capacity;
+          }
+
+        /// Fibonacci hashing of the key, ignoring the always-zero bits.
+        static std::size_t hash(Key key)
+          {
+            std::uint64_t const k = static_cast<std::uint64_t>(key) >> KeyBits;
+            return static_cast<std::size_t>
+              ((k * 0x9E3779B97F4A7C15ULL) >> 32);
+          }
+
+        /// Moves all the blocks into a table with the specified capacity.
+        void rehash(std::size_t capacity)
+          {
+            Slots_t newSlots(capacity, value_type(), slots.get_allocator());
+            Used_t newUsed(capacity, false, used.get_allocator());
+            std::size_t const mask = capacity - 1;
+            for (std::size_t& index: order) {
+              std::size_t i = hash(slots[index].first) & mask;
+              while (newUsed[i]) i = (i + 1) & mask;
+              newSlots[i] = std::move(slots[index]);
+              newUsed[i] = true;
+              index = i;
+            } // for
+            slots = std::move(newSlots);
+            used = std::move(newUsed);
+          } // rehash()
+
+        /// Sorts the list of occupied slots by key, if needed.
+        void sortOrder() const
+          {
+            if (sorted) return;
+            std::sort(order.begin(), order.end(),
+              [this](std::size_t a, std::size_t b)
+                { return slots[a].first < slots[b].first; }
+              );
+            sorted = true;
+          } // sortOrder()
+
+      }; // class HashBlockMap
+
+
+      /// Selects the storage class of blocks from the storage tag.
+      template <typename Storage, int KeyBits>
+      struct BlockStorage;
+
+      template <int KeyBits>
+      struct BlockStorage<lar::counters_map::TreeStorage, KeyBits> {
+        template <typename Key, typename Block>
+        using value_t = std::pair<const Key, Block>;
+        template <typename Key, typename Block, typename Alloc>
+        using map_t = TreeBlockMap<Key, Block, Alloc>;
+      };
+
+      template <int KeyBits>
+      struct BlockStorage<lar::counters_map::FlatStorage, KeyBits> {
+        template <typename Key, typename Block>
+        using value_t = std::pair<Key, Block>;
+        template <typename Key, typename Block, typename Alloc>
+        using map_t = FlatBlockMap<Key, Block, Alloc>;
+      };
+
+      template <int KeyBits>
+      struct BlockStorage<lar::counters_map::HashStorage, KeyBits> {
+        template <typename Key, typename Block>
+        using value_t = std::pair<Key, Block>;
+        template <typename Key, typename Block, typename Alloc>
+        using map_t = HashBlockMap<Key, Block, Alloc, KeyBits>;
+      };
+
+    } // namespace counters_map
+
+
     template <
       typename KEY,
       typename COUNTER,
-      size_t SIZE
+      size_t SIZE,
+      typename STORAGE = lar::counters_map::TreeStorage,
+      unsigned int SUBCOUNTERS = 1
       >
     struct CountersMapTraits {
 
@@ -72,19 +398,27 @@ namespace lar {
       /// Type of counter block actually stored.
       using CounterBlock_t = CounterBlock<Counter_t, NCounters>;
 
-      /// General type of map (no special allocator specified).
-      using PlainBaseMap_t = std::map<Key_t, CounterBlock_t, std::less<Key_t>>;
+      /// Tag of the storage of the blocks.
+      using Storage_t = STORAGE;
+
+      /// Selector of the block storage class.
+      using BlockStorage_t = counters_map::BlockStorage
+        <Storage_t, LowestSetBit(SIZE * SUBCOUNTERS)>;
+
+      /// Type of value in the map.
+      using MapValue_t = typename BlockStorage_t::template value_t
+        <Key_t, CounterBlock_t>;
 
       /// Type of allocator for the plain map.
-      using DefaultAllocator_t = typename PlainBaseMap_t::allocator_type;
+      using DefaultAllocator_t = std::allocator<MapValue_t>;
 
       /// Base type of map, allowing a custom allocator.
       template <typename Alloc>
-      using BaseMap_t
-        = std::map<Key_t, CounterBlock_t, std::less<Key_t>, Alloc>;
+      using BaseMap_t = typename BlockStorage_t::template map_t
+        <Key_t, CounterBlock_t, Alloc>;
 
-      /// Type of value in the map.
-      using MapValue_t = typename PlainBaseMap_t::value_type;
+      /// General type of map (no special allocator specified).
+      using PlainBaseMap_t = BaseMap_t<DefaultAllocator_t>;
 
     }; // struct CountersMapTraits
 
@@ -98,7 +432,8 @@ namespace lar {
    * @param COUNTER the type of a basic counter (can be signed or unsigned)
    * @param BLOCKSIZE the number of counters in a cluster
    * @param ALLOC allocator for the underlying STL map
-   * @param SUBCOUNTERS split each counter in subcounters (not implemented yet)
+   * @param SUBCOUNTERS split each counter in subcounters
+   * @param STORAGE how to store the blocks (see `lar::counters_map`)
    *
    * This class is designed for the need of a vast number of counters with
    * a integral numerical key, when the counter keys are usually clustered.
@@ -117,15 +452,27 @@ namespace lar {
    * "next counter" is well defined and we can store contiguous counters
    * in a fixed structure.
    *
+   * <h3>Storage</h3>
+   * The blocks of counters are stored by default in a STL map
+   * (`lar::counters_map::TreeStorage`). A flat open-addressing hash table
+   * (`lar::counters_map::HashStorage`) or a sorted vector
+   * (`lar::counters_map::FlatStorage`) can be used instead, saving the tree
+   * walk and the pointer chasing on each access. In all cases, iteration
+   * visits the counters in key order. The aliases `lar::HashedCountersMap`
+   * and `lar::FlatCountersMap` select those storages with the default
+   * allocator.
+   *
    * <h3>Subcounters</h3>
    * The idea behind subcounters is that you migt want to split a counter into
    * subcounters to save memory if the maximum counter value is smaller than
    * the range of the counter type.
-   * <strong>The implementation is delayed</strong> since in the end the same
-   * effect can be achieved by using a small counter type (e.g. signed char),
-   * unless the range is smaller that 16 (or 4, or 2), in which case the
-   * character can be split into bits. That will cause some overhead for
-   * increment and decrement instructions.
+   * The same effect can be achieved by using a small counter type (e.g.
+   * `unsigned char`), unless the range is smaller that 16 (or 4, or 2), in
+   * which case the character can be split into bits: with `SUBCOUNTERS` set to
+   * 2, 4 or 8 each `unsigned char` counter holds 4-, 2- or 1-bit subcounters.
+   * The counter type must be unsigned, and subcounters wrap around on overflow
+   * and underflow (e.g. 3 + 1 = 0 for 2-bit subcounters).
+   * This costs some overhead for the increment and decrement instructions.
    */
   template <
     typename KEY,
@@ -133,15 +480,22 @@ namespace lar {
     size_t SIZE,
     typename ALLOC
       = typename details::CountersMapTraits<KEY, COUNTER, SIZE>::DefaultAllocator_t,
-    unsigned int SUBCOUNTERS=1
+    unsigned int SUBCOUNTERS=1,
+    typename STORAGE = counters_map::TreeStorage
     >
   class CountersMap {
-    static_assert(SUBCOUNTERS == 1, "subcounters not implemented yet");
+    static_assert(IsPowerOf2(SUBCOUNTERS),
+      "the number of subcounters must be a power of 2");
+    static_assert(SUBCOUNTERS <= sizeof(COUNTER) * CHAR_BIT,
+      "too many subcounters for the counter type");
+    static_assert((SUBCOUNTERS == 1) || std::is_unsigned<COUNTER>(),
+      "subcounters require an unsigned counter type");
     static_assert(IsPowerOf2(SIZE),
       "the size of the cluster of counters must be a power of 2");
 
     /// Set of data types pertaining this counter.
-    using Traits_t = details::CountersMapTraits<KEY, COUNTER, SIZE>;
+    using Traits_t
+      = details::CountersMapTraits<KEY, COUNTER, SIZE, STORAGE, SUBCOUNTERS>;
 
       public:
     using Key_t = KEY; ///< type of counter key in the map
@@ -149,7 +503,11 @@ namespace lar {
     using Allocator_t = ALLOC; ///< type of the single counter
 
     /// This class
-    using CounterMap_t = CountersMap<KEY, COUNTER, SIZE, ALLOC, SUBCOUNTERS>;
+    using CounterMap_t
+      = CountersMap<KEY, COUNTER, SIZE, ALLOC, SUBCOUNTERS, STORAGE>;
+
+    /// Tag of the storage of counter blocks.
+    using Storage_t = STORAGE;
 
 
     /// Number of counters in one counter block
@@ -161,6 +519,10 @@ namespace lar {
     /// Type of the subcounter (that is, the actual counter)
     using SubCounter_t = Counter_t;
 
+    /// Number of bits of each subcounter
+    static constexpr unsigned int SubCounterBits
+      = sizeof(Counter_t) * CHAR_BIT / SUBCOUNTERS;
+
 
     using CounterBlock_t = typename Traits_t::CounterBlock_t;
 
@@ -195,7 +557,8 @@ namespace lar {
     CountersMap() {}
 
     /// Constructor, specifies an allocator
-    CountersMap(Allocator_t alloc): BaseMap_t(alloc) {}
+    CountersMap(Allocator_t alloc)
+      : counter_map(typename BaseMap_t::allocator_type(alloc)) {}
 
 
     /// Read-only access to an element; returns 0 if no counter is present
@@ -363,13 +726,22 @@ namespace lar {
     Counter_t GetCounter(CounterKey_t key) const;
 
     /// Returns the value of the subcounter at the specified split key
-    // Since subcounters are not implemented yet, this is a no-op
-    SubCounter_t GetSubCounter(CounterKey_t key) const
-      { return GetCounter(key); }
+    SubCounter_t GetSubCounter(CounterKey_t key) const;
 
     /// Returns the counter at the specified split key
     Counter_t& GetOrCreateCounter(CounterKey_t key);
 
+    /// Returns the value of the subcounter with the specified block index
+    static SubCounter_t ExtractSubCounter
+      (CounterBlock_t const& block, CounterIndex_t index);
+
+    /// Returns the mask of the subcounter bits (all for a single subcounter)
+    static constexpr Counter_t SubCounterMask()
+      {
+        return (SUBCOUNTERS == 1)
+          ? ~Counter_t(0): Counter_t((Counter_t(1) << SubCounterBits) - 1);
+      }
+
 
     /// Returns a split key corresponding to the specified key
     static CounterKey_t SplitKey(Key_t key) { return key; }
@@ -420,22 +792,28 @@ namespace lar {
   // (or else the reference would not be needed).
   // I am not providing the same for the protected and private members
   // (just because of laziness).
-  template <typename K, typename C, size_t S, typename A, unsigned int SUB>
-  constexpr size_t CountersMap<K, C, S, A, SUB>::NCounters;
+  template <
+    typename K, typename C, size_t S, typename A, unsigned int SUB, typename ST
+    >
+  constexpr size_t CountersMap<K, C, S, A, SUB, ST>::NCounters;
 
-  template <typename K, typename C, size_t S, typename A, unsigned int SUB>
-  constexpr size_t CountersMap<K, C, S, A, SUB>::NSubcounters;
+  template <
+    typename K, typename C, size_t S, typename A, unsigned int SUB, typename ST
+    >
+  constexpr size_t CountersMap<K, C, S, A, SUB, ST>::NSubcounters;
 
 
   // CountersMap<>::const_iterator does not fully implement the STL iterator
   // interface, since it does not implement operator-> () (for technical reason:
   // the value does not actually exist and it does not have an address),
   // in addition to std::swap().
-  template <typename K, typename C, size_t S, typename A, unsigned int SUB>
-  class CountersMap<K, C, S, A, SUB>::const_iterator:
+  template <
+    typename K, typename C, size_t S, typename A, unsigned int SUB, typename ST
+    >
+  class CountersMap<K, C, S, A, SUB, ST>::const_iterator:
     public std::bidirectional_iterator_tag
   {
-    friend CountersMap<K, C, S, A, SUB>;
+    friend CountersMap<K, C, S, A, SUB, ST>;
 
       public:
     using value_type = typename CounterMap_t::value_type; ///< value type: pair
@@ -450,7 +828,8 @@ namespace lar {
     const_iterator() = default;
 
     /// Access to the pointed pair
-    value_type operator*() const { return { key(), iter->second[index] }; }
+    value_type operator*() const
+      { return { key(), ExtractSubCounter(iter->second, index) }; }
 
     iterator_type& operator++()
       {
@@ -490,36 +869,48 @@ namespace lar {
   }; // CountersMap<>::const_iterator
 
 
-  template <typename K, typename C, size_t S, typename A, unsigned int SUB>
-  inline typename CountersMap<K, C, S, A, SUB>::SubCounter_t
-    CountersMap<K, C, S, A, SUB>::set(Key_t key, SubCounter_t value)
+  template <
+    typename K, typename C, size_t S, typename A, unsigned int SUB, typename ST
+    >
+  inline typename CountersMap<K, C, S, A, SUB, ST>::SubCounter_t
+    CountersMap<K, C, S, A, SUB, ST>::set(Key_t key, SubCounter_t value)
     { return unchecked_set(CounterKey_t(key), value); }
 
-  template <typename K, typename C, size_t S, typename A, unsigned int SUB>
-  inline typename CountersMap<K, C, S, A, SUB>::SubCounter_t
-    CountersMap<K, C, S, A, SUB>::increment(Key_t key)
+  template <
+    typename K, typename C, size_t S, typename A, unsigned int SUB, typename ST
+    >
+  inline typename CountersMap<K, C, S, A, SUB, ST>::SubCounter_t
+    CountersMap<K, C, S, A, SUB, ST>::increment(Key_t key)
     { return unchecked_add(CounterKey_t(key), +1); }
 
-  template <typename K, typename C, size_t S, typename A, unsigned int SUB>
-  inline typename CountersMap<K, C, S, A, SUB>::SubCounter_t
-    CountersMap<K, C, S, A, SUB>::decrement(Key_t key)
+  template <
+    typename K, typename C, size_t S, typename A, unsigned int SUB, typename ST
+    >
+  inline typename CountersMap<K, C, S, A, SUB, ST>::SubCounter_t
+    CountersMap<K, C, S, A, SUB, ST>::decrement(Key_t key)
     { return unchecked_add(CounterKey_t(key), -1); }
 
 
-  template <typename K, typename C, size_t S, typename A, unsigned int SUB>
-  inline typename CountersMap<K, C, S, A, SUB>::const_iterator
-    CountersMap<K, C, S, A, SUB>::begin() const
+  template <
+    typename K, typename C, size_t S, typename A, unsigned int SUB, typename ST
+    >
+  inline typename CountersMap<K, C, S, A, SUB, ST>::const_iterator
+    CountersMap<K, C, S, A, SUB, ST>::begin() const
     { return const_iterator{ counter_map.begin(), 0 }; }
 
-  template <typename K, typename C, size_t S, typename A, unsigned int SUB>
-  inline typename CountersMap<K, C, S, A, SUB>::const_iterator
-    CountersMap<K, C, S, A, SUB>::end() const
+  template <
+    typename K, typename C, size_t S, typename A, unsigned int SUB, typename ST
+    >
+  inline typename CountersMap<K, C, S, A, SUB, ST>::const_iterator
+    CountersMap<K, C, S, A, SUB, ST>::end() const
     { return const_iterator{ counter_map.end(), 0 }; }
 
 
-  template <typename K, typename C, size_t S, typename A, unsigned int SUB>
+  template <
+    typename K, typename C, size_t S, typename A, unsigned int SUB, typename ST
+    >
   template <typename OALLOC>
-  bool CountersMap<K, C, S, A, SUB>::is_equal(
+  bool CountersMap<K, C, S, A, SUB, ST>::is_equal(
     const std::map<Key_t, SubCounter_t, std::less<Key_t>, OALLOC>& to,
     Key_t& first_difference
   ) const {
@@ -587,65 +978,116 @@ namespace lar {
   } // CountersMap<>::is_equal()
 
 
-  template <typename K, typename C, size_t S, typename A, unsigned int SUB>
-  inline typename CountersMap<K, C, S, A, SUB>::Counter_t
-    CountersMap<K, C, S, A, SUB>::GetCounter(CounterKey_t key) const
+  template <
+    typename K, typename C, size_t S, typename A, unsigned int SUB, typename ST
+    >
+  inline typename CountersMap<K, C, S, A, SUB, ST>::Counter_t
+    CountersMap<K, C, S, A, SUB, ST>::GetCounter(CounterKey_t key) const
   {
-    typename BaseMap_t::const_iterator iBlock = counter_map.find(key.block);
-    return (iBlock == counter_map.end())? 0: iBlock->second[key.counter];
+    CounterBlock_t const* block = counter_map.find_block(key.block);
+    return block? (*block)[key.counter / SUB]: 0;
   } // CountersMap<>::GetCounter() const
 
 
-  template <typename K, typename C, size_t S, typename A, unsigned int SUB>
-  inline typename CountersMap<K, C, S, A, SUB>::Counter_t&
-    CountersMap<K, C, S, A, SUB>::GetOrCreateCounter(CounterKey_t key)
-    { return counter_map[key.block][key.counter]; }
+  template <
+    typename K, typename C, size_t S, typename A, unsigned int SUB, typename ST
+    >
+  inline typename CountersMap<K, C, S, A, SUB, ST>::SubCounter_t
+    CountersMap<K, C, S, A, SUB, ST>::GetSubCounter(CounterKey_t key) const
+  {
+    CounterBlock_t const* block = counter_map.find_block(key.block);
+    return block? ExtractSubCounter(*block, key.counter): 0;
+  } // CountersMap<>::GetSubCounter() const
+
+
+  template <
+    typename K, typename C, size_t S, typename A, unsigned int SUB, typename ST
+    >
+  inline typename CountersMap<K, C, S, A, SUB, ST>::Counter_t&
+    CountersMap<K, C, S, A, SUB, ST>::GetOrCreateCounter(CounterKey_t key)
+    { return counter_map.get_or_create_block(key.block)[key.counter / SUB]; }
+
 
+  template <
+    typename K, typename C, size_t S, typename A, unsigned int SUB, typename ST
+    >
+  inline typename CountersMap<K, C, S, A, SUB, ST>::SubCounter_t
+    CountersMap<K, C, S, A, SUB, ST>::ExtractSubCounter
+    (CounterBlock_t const& block, CounterIndex_t index)
+  {
+    if constexpr (SUB == 1) return block[index];
+    else {
+      unsigned int const shift = (index % SUB) * SubCounterBits;
+      return (block[index / SUB] >> shift) & SubCounterMask();
+    }
+  } // CountersMap<>::ExtractSubCounter()
 
-  template <typename K, typename C, size_t S, typename A, unsigned int SUB>
-  typename CountersMap<K, C, S, A, SUB>::SubCounter_t
-    CountersMap<K, C, S, A, SUB>::unchecked_set
+
+  template <
+    typename K, typename C, size_t S, typename A, unsigned int SUB, typename ST
+    >
+  typename CountersMap<K, C, S, A, SUB, ST>::SubCounter_t
+    CountersMap<K, C, S, A, SUB, ST>::unchecked_set
     (CounterKey_t key, SubCounter_t value)
   {
-    // take it low level here
-    // first get the iterator to the block
-    typename BaseMap_t::iterator iBlock = counter_map.lower_bound(key.block);
-    if (iBlock != counter_map.end()) {
-      if (iBlock->first == key.block) { // sweet, we have that counter already
-        return iBlock->second[key.counter] = value;
-      }
+    // the block is created (with all counters set to 0) if not present yet
+    Counter_t& counter = GetOrCreateCounter(key);
+    if constexpr (SUB == 1) return counter = value;
+    else {
+      unsigned int const shift = (key.counter % SUB) * SubCounterBits;
+      Counter_t const mask = SubCounterMask() << shift;
+      value &= SubCounterMask();
+      counter = (counter & ~mask) | Counter_t(value << shift);
+      return value;
     }
-    // no counter there yet: create one;
-    // hint to insert before the block in the position we jave already found
-    // (this is optimal in STL map for C++11);
-    // create a block using the special constructor;
-    // the temporary value created here is moved to the map
-    counter_map.insert(iBlock, { key.block, { key.counter, value } } );
-    return value;
-  } // CountersMap<>::unchecked_add() const
-
-
-  template <typename K, typename C, size_t S, typename A, unsigned int SUB>
-  typename CountersMap<K, C, S, A, SUB>::SubCounter_t
-    CountersMap<K, C, S, A, SUB>::unchecked_add
+  } // CountersMap<>::unchecked_set()
+
+
+  template <
+    typename K, typename C, size_t S, typename A, unsigned int SUB, typename ST
+    >
+  typename CountersMap<K, C, S, A, SUB, ST>::SubCounter_t
+    CountersMap<K, C, S, A, SUB, ST>::unchecked_add
     (CounterKey_t key, SubCounter_t delta)
   {
-    // take it low level here
-    // first get the iterator to the block
-    typename BaseMap_t::iterator iBlock = counter_map.lower_bound(key.block);
-    if (iBlock != counter_map.end()) {
-      if (iBlock->first == key.block) { // sweet, we have that counter already
-        return iBlock->second[key.counter] += delta;
-      }
+    // the block is created (with all counters set to 0) if not present yet
+    Counter_t& counter = GetOrCreateCounter(key);
+    if constexpr (SUB == 1) return counter += delta;
+    else {
+      unsigned int const shift = (key.counter % SUB) * SubCounterBits;
+      SubCounter_t const value
+        = ((counter >> shift) + delta) & SubCounterMask();
+      Counter_t const mask = SubCounterMask() << shift;
+      counter = (counter & ~mask) | Counter_t(value << shift);
+      return value;
     }
-    // no counter there yet: create one;
-    // hint to insert before the block in the position we jave already found
-    // (this is optimal in STL map for C++11);
-    // create a block using the special constructor;
-    // the temporary value created here is moved to the map
-    counter_map.insert(iBlock, { key.block, { key.counter, delta } } );
-    return delta;
-  } // CountersMap<>::unchecked_add() const
+  } // CountersMap<>::unchecked_add()
+
+
+
+
+  //----------------------------------------------------------------------------
+  /// `lar::CountersMap` storing its blocks in a flat hash table.
+  template <
+    typename KEY, typename COUNTER, size_t SIZE, unsigned int SUBCOUNTERS = 1
+    >
+  using HashedCountersMap = CountersMap<
+    KEY, COUNTER, SIZE,
+    typename details::CountersMapTraits
+      <KEY, COUNTER, SIZE, counters_map::HashStorage>::DefaultAllocator_t,
+    SUBCOUNTERS, counters_map::HashStorage
+    >;
+
+  /// `lar::CountersMap` storing its blocks in a sorted vector.
+  template <
+    typename KEY, typename COUNTER, size_t SIZE, unsigned int SUBCOUNTERS = 1
+    >
+  using FlatCountersMap = CountersMap<
+    KEY, COUNTER, SIZE,
+    typename details::CountersMapTraits
+      <KEY, COUNTER, SIZE, counters_map::FlatStorage>::DefaultAllocator_t,
+    SUBCOUNTERS, counters_map::FlatStorage
+    >;
 
 
 } // namespace lar
@@ -13,45 +13,18 @@
 #include "art/Framework/Services/Registry/ActivityRegistry.h"
 #include "art/Framework/Services/Registry/ServiceHandle.h"
 #include "art/Framework/Services/Registry/ServiceMacros.h"
+#include "lardata/Utilities/RunConditionsCache.h"
+#include "lardata/Utilities/UBChannelTable.h"
 #include <libpq-fe.h>
+#include <memory>
+#include <utility>
 
 ///General LArSoft Utilities
 namespace util{
 
-  class UBDaqID {
-  public:
-  UBDaqID() : crate(-1), card(-1), channel(-1) {};
-  UBDaqID( int _crate, int _card, int _channel ) :
-    crate(_crate), card(_card), channel(_channel) {};
-    ~UBDaqID() {};
-
-    int crate;
-    int card;
-    int channel;
-
-    const bool operator<(const UBDaqID& rhs) const {
-      bool is_less=false;
-      if (this->crate   == rhs.crate &&
-    	  this->card    == rhs.card  &&
-    	  this->channel <  rhs.channel) is_less=true;
-      else if (this->crate == rhs.crate &&
-    	       this->card  <  rhs.card) is_less=true;
-      else if (this->crate < rhs.crate) is_less=true;
-      return is_less;
-    }
-
-  };
-
-
-  typedef int UBLArSoftCh_t;
-
-  typedef std::map< UBDaqID, UBLArSoftCh_t > UBChannelMap_t;
-  typedef std::map< UBLArSoftCh_t, UBDaqID > UBChannelReverseMap_t;
-
-
   class DatabaseUtil {
   public:
-    DatabaseUtil(fhicl::ParameterSet const& pset);
+    DatabaseUtil(fhicl::ParameterSet const& pset, art::ActivityRegistry& reg);
 
     void   reconfigure(fhicl::ParameterSet const& pset);
 
@@ -60,6 +33,17 @@ namespace util{
     int GetTemperatureFromDB(int run,double &temp_real);
     int GetEfieldValuesFromDB(int run,std::vector<double> &efield);
     int GetPOTFromDB(int run,long double &POT);
+
+    /// Reads all the conditions of the runs not cached yet, with two queries.
+    int PrefetchRunConditions(std::vector<int> const& runs);
+    /// Run conditions read so far (from database or snapshot file).
+    RunConditionsCache const& RunConditionsCached() const { return fRunConditions; }
+    /// Writes the run conditions read so far into a snapshot file.
+    void WriteRunConditionsSnapshot(std::string const& path) const
+      { fRunConditions.writeSnapshot(path); }
+
+    /// Channel map for the timestamps, built once and shared.
+    std::shared_ptr<UBChannelTable const> GetUBChannelTable(int data_taking_timestamp = -1 , int  swizzling_timestamp = -1 );
     UBChannelMap_t GetUBChannelMap(int data_taking_timestamp = -1 , int  swizzling_timestamp = -1 );
     UBChannelReverseMap_t GetUBChannelReverseMap(int data_taking_timestamp = -1 , int  swizzling_timestamp = -1 );
 
@@ -71,6 +55,8 @@ namespace util{
 
   private:
 
+    void postEndJob();
+
     int SelectSingleFieldByQuery(std::vector<std::string> &value,const char * query);
     int Connect(int conn_wait=0);
     int DisConnect();
@@ -86,9 +72,13 @@ namespace util{
     bool fToughErrorTreatment;
     bool fShouldConnect;
 
-    UBChannelMap_t        fChannelMap;
-    UBChannelReverseMap_t fChannelReverseMap;
-    void LoadUBChannelMap(int data_taking_timestamp = -1 , int  swizzling_timestamp = -1 );
+    RunConditionsCache fRunConditions; ///< Conditions already read, by run.
+    std::string fSaveSnapshot; ///< File to save the run conditions at end of job.
+
+    std::string fChannelMapCacheDir; ///< Directory of the channel map cache files.
+    /// Channel maps already loaded, by data taking and swizzling timestamps.
+    std::map<std::pair<int, int>, std::shared_ptr<UBChannelTable const>> fChannelTables;
+    UBChannelTable LoadUBChannelMap(int data_taking_timestamp = -1 , int  swizzling_timestamp = -1 );
 
   }; // class DatabaseUtil
 } //namespace util
@@ -8,6 +8,12 @@
 // C++ language includes
 #include <iostream>
 #include <fstream>
+#include <cstdio> // std::rename(), std::remove()
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unistd.h> // getpid()
 //#include <libpq-fe.h>
 
 // LArSoft includes
@@ -16,12 +22,19 @@
 #include "cetlib_except/exception.h"
 
 //-----------------------------------------------
-util::DatabaseUtil::DatabaseUtil(fhicl::ParameterSet const& pset)
+util::DatabaseUtil::DatabaseUtil(fhicl::ParameterSet const& pset, art::ActivityRegistry& reg)
 {
   conn = NULL;
   this->reconfigure(pset);
-  fChannelMap.clear();
-  fChannelReverseMap.clear();
+  reg.sPostEndJob.watch(this, &DatabaseUtil::postEndJob);
+}
+
+//------------------------------------------------
+void util::DatabaseUtil::postEndJob()
+{
+  // all the conditions read by the job, including the ones queried run by run
+  if (!fSaveSnapshot.empty())
+    WriteRunConditionsSnapshot(fSaveSnapshot);
 }
 
 //----------------------------------------------
@@ -77,6 +90,7 @@ void util::DatabaseUtil::reconfigure(fhicl::ParameterSet const& pset)
   fPassword 		 = "";
   fToughErrorTreatment   = pset.get< bool >("ToughErrorTreatment");
   fShouldConnect   	 = pset.get< bool >("ShouldConnect");
+  fChannelMapCacheDir    = pset.get< std::string >("ChannelMapCacheDir", "");
 
   // constructor decides if initialized value is a path or an environment variable
   std::string passfname;
@@ -101,6 +115,20 @@ void util::DatabaseUtil::reconfigure(fhicl::ParameterSet const& pset)
 
   sprintf(connection_str,"host=%s dbname=%s user=%s port=%d password=%s ",fDBHostName.c_str(),fDBName.c_str(),fDBUser.c_str(),fPort,fPassword.c_str());
 
+  // run conditions from a previous job, then the ones of the runs to be
+  // processed, all read at once; a job with a complete snapshot needs no DB
+  std::string const snapshot = pset.get< std::string >("RunConditionsSnapshot", "");
+  if (!snapshot.empty()) {
+    std::size_t const nRuns = fRunConditions.readSnapshot(snapshot);
+    mf::LogInfo("DatabaseUtil") << "Read conditions of " << nRuns << " runs from '" << snapshot << "'\n";
+  }
+
+  std::vector<int> const prefetchRuns = pset.get< std::vector<int> >("PrefetchRuns", {});
+  if (!prefetchRuns.empty())
+    PrefetchRunConditions(prefetchRuns);
+
+  fSaveSnapshot = pset.get< std::string >("SaveRunConditionsSnapshot", "");
+
   return;
 }
 
@@ -169,6 +197,9 @@ int util::DatabaseUtil::SelectSingleFieldByQuery(std::vector<std::string> &value
 
 int util::DatabaseUtil::GetTemperatureFromDB(int run,double &temp_real)
 {
+  if (auto const cached = fRunConditions.lookup(run, &RunConditions::temperature, temp_real))
+    return *cached;
+
   std::vector<std::string> retvalue;
   char cond[30];
   sprintf(cond,"run = %d",run);
@@ -177,6 +208,7 @@ int util::DatabaseUtil::GetTemperatureFromDB(int run,double &temp_real)
   if(err!=-1 && retvalue.size()==1){
     char * endstr;
     temp_real=std::strtod(retvalue[0].c_str(),&endstr);
+    fRunConditions.get(run).temperature=temp_real;
     return 0;
   }
 
@@ -190,6 +222,8 @@ int util::DatabaseUtil::GetTemperatureFromDB(int run,double &temp_real)
 
 int util::DatabaseUtil::GetEfieldValuesFromDB(int run,std::vector<double> &efield)
 {
+  if (auto const cached = fRunConditions.lookupEfield(run, efield))
+    return *cached;
 
   std::vector<std::string> retvalue;
 
@@ -203,6 +237,7 @@ int util::DatabaseUtil::GetEfieldValuesFromDB(int run,std::vector<double> &efiel
       char * endstr;
       efield.push_back(std::strtod(retvalue[i].c_str(),&endstr));
     }
+    fRunConditions.get(run).efield=efield;
     return 0;
   }
 
@@ -232,6 +267,8 @@ int util::DatabaseUtil::SelectFieldByName(std::vector<std::string> &value,
 
 
 int util::DatabaseUtil::GetLifetimeFromDB(int run,double &lftime_real) {
+  if (auto const cached = fRunConditions.lookup(run, &RunConditions::lifetime, lftime_real))
+    return *cached;
 
   //  char query[100];
   //  sprintf(query,"SELECT tau FROM argoneut_test WHERE run = %d",run);
@@ -244,6 +281,7 @@ int util::DatabaseUtil::GetLifetimeFromDB(int run,double &lftime_real) {
   if(err!=-1 && retvalue.size()==1){
     char * endstr;
     lftime_real=std::strtod(retvalue[0].c_str(),&endstr);
+    fRunConditions.get(run).lifetime=lftime_real;
     return 0;
   }
 
@@ -253,6 +291,8 @@ int util::DatabaseUtil::GetLifetimeFromDB(int run,double &lftime_real) {
 }
 
 int util::DatabaseUtil::GetTriggerOffsetFromDB(int run,double &T0_real) {
+  if (auto const cached = fRunConditions.lookup(run, &RunConditions::triggerOffset, T0_real))
+    return *cached;
 
   //  char query[100];
   //  sprintf(query,"SELECT tau FROM argoneut_test WHERE run = %d",run);
@@ -265,6 +305,7 @@ int util::DatabaseUtil::GetTriggerOffsetFromDB(int run,double &T0_real) {
   if(err!=-1 && retvalue.size()==1){
     char * endstr;
     T0_real=std::strtod(retvalue[0].c_str(),&endstr);
+    fRunConditions.get(run).triggerOffset=T0_real;
     return 0;
   }
 
@@ -275,6 +316,8 @@ int util::DatabaseUtil::GetTriggerOffsetFromDB(int run,double &T0_real) {
 
 
 int util::DatabaseUtil::GetPOTFromDB(int run,long double &POT) {
+  if (auto const cached = fRunConditions.lookup(run, &RunConditions::pot, POT))
+    return *cached;
 
   //  char query[100];
   //  sprintf(query,"SELECT tau FROM argoneut_test WHERE run = %d",run);
@@ -287,6 +330,7 @@ int util::DatabaseUtil::GetPOTFromDB(int run,long double &POT) {
   if(err!=-1 && retvalue.size()==1){
     char * endstr;
     POT=std::strtold(retvalue[0].c_str(),&endstr);
+    fRunConditions.get(run).pot=POT;
     return 0;
   }
 
@@ -295,15 +339,69 @@ int util::DatabaseUtil::GetPOTFromDB(int run,long double &POT) {
 
 }
 
+//------------------------------------------------
+int util::DatabaseUtil::PrefetchRunConditions(std::vector<int> const& runs)
+{
+  // conditions are cached only if the run table query succeeds
+  std::vector<int> const missing = fRunConditions.missingRuns(runs);
+  if (missing.empty()) return 0; // all cached already
+  std::string runList;
+  for (int run: missing) {
+    if (!runList.empty()) runList += ',';
+    runList += std::to_string(run);
+  }
+
+  if(this->Connect()==-1)  {
+    if(fShouldConnect)
+      mf::LogWarning("DatabaseUtil")<< "DB Connection error \n";
+    else
+      mf::LogInfo("DatabaseUtil")<< "Not connecting to DB by choice. \n";
+    return -1;
+  }
+
+  std::string query = "SELECT run, tau, T0, temp, pot FROM " + fTableName
+    + " WHERE run IN (" + runList + ")";
+  PGresult *result = PQexec(conn, query.c_str());
+  if (!result || PQresultStatus(result)!=PGRES_TUPLES_OK) {
+    mf::LogWarning("DatabaseUtil")<<"Run conditions prefetch failed: "
+				  <<(result? PQresultErrorMessage(result): "no error code")<<"\n";
+    PQclear(result);
+    this->DisConnect();
+    return -1;
+  }
+  std::vector<RunConditionsCache::ConditionsRow_t> rows;
+  for(int i=0;i<PQntuples(result);i++) {
+    rows.push_back({ PQgetvalue(result,i,0), PQgetvalue(result,i,1),
+      PQgetvalue(result,i,2), PQgetvalue(result,i,3), PQgetvalue(result,i,4) });
+  }
+  PQclear(result);
+
+  query = "SELECT run, EFbet FROM EField," + fTableName + " WHERE Efield.FID = "
+    + fTableName + ".FID AND run IN (" + runList + ") ORDER BY run, planegap";
+  result = PQexec(conn, query.c_str());
+  bool const hasEfield = result && (PQresultStatus(result)==PGRES_TUPLES_OK);
+  std::vector<RunConditionsCache::EfieldRow_t> efieldRows;
+  if (hasEfield) {
+    for(int i=0;i<PQntuples(result);i++)
+      efieldRows.push_back({ PQgetvalue(result,i,0), PQgetvalue(result,i,1) });
+  }
+  else {
+    mf::LogWarning("DatabaseUtil")<<"Electric field prefetch failed: "
+				  <<(result? PQresultErrorMessage(result): "no error code")<<"\n";
+  }
+  PQclear(result);
+  this->DisConnect();
+
+  std::size_t const nRuns
+    = fRunConditions.addPrefetched(missing, rows, hasEfield? &efieldRows: nullptr);
+  mf::LogInfo("DatabaseUtil") << "Prefetched conditions of " << nRuns << " runs\n";
+  return 0;
+}
+
 namespace util {
 
-  void DatabaseUtil::LoadUBChannelMap( int data_taking_timestamp, int  swizzling_timestamp) {
+  UBChannelTable DatabaseUtil::LoadUBChannelMap( int data_taking_timestamp, int  swizzling_timestamp) {
 
-    if ( fChannelMap.size()>0 ) {
-      // Use prevously grabbed data to avoid repeated call to database.
-      // Also this avoids inglorious segfault.
-      return;
-    }
     if ( conn==NULL )
       Connect( 0 );
 
@@ -314,9 +412,6 @@ namespace util {
         << "Failed to get channel map from DB."<< std::endl;
     }
 
-    fChannelMap.clear();
-    fChannelReverseMap.clear();
-
     PGresult *res  = PQexec(conn, "BEGIN");
     if (PQresultStatus(res) != PGRES_COMMAND_OK) {
       mf::LogError("")<< "postgresql BEGIN failed";
@@ -349,43 +444,93 @@ namespace util {
 
     int num_records=PQntuples(res);            //One record per channel, ideally.
 
+    std::vector<UBChannelTable::Entry> entries;
+    entries.reserve(num_records);
+    UBChannelMap_t seen; // only for the report of duplicate entries
     for (int i=0;i<num_records;i++) {
-      std::string tup = PQgetvalue(res, i, 0); // (crate,slot,FEMch,larsoft_chan) format
-      tup = tup.substr(1,tup.length()-2);      // Strip initial & final parentheses.
-      std::vector<std::string> fields;
-      split(tup, ',', fields);                 // Explode substrings into vector with comma delimiters.
-
-      int crate_id     = atoi( fields[0].c_str() );
-      int slot         = atoi( fields[1].c_str() );
-      int boardChan    = atoi( fields[2].c_str() );
-      int larsoft_chan = atoi( fields[3].c_str() );
-
-      UBDaqID daq_id(crate_id,slot,boardChan);
-      std::pair<UBDaqID, UBLArSoftCh_t> p(daq_id,larsoft_chan);
+      char const* tup = PQgetvalue(res, i, 0); // (crate,slot,FEMch,larsoft_chan) format
+      std::optional<UBChannelTable::Entry> const entry = UBChannelTable::parseDBTuple(tup);
+      if (!entry) {
+        PQclear(res);
+        this->DisConnect();
+        throw art::Exception( art::errors::FileReadError )
+          << "Malformed channel map entry '" << tup << "' from DB." << std::endl;
+      }
 
-      if ( fChannelMap.find(daq_id) != fChannelMap.end() ){
+      UBDaqID const& daq_id = entry->daqID;
+      auto const iSeen = seen.find(daq_id);
+      if ( iSeen != seen.end() ){
 	std::cout << __PRETTY_FUNCTION__ << ": ";
         std::cout << "Multiple entries!" << std::endl;
         mf::LogWarning("")<< "Multiple DB entries for same (crate,card,channel). "<<std::endl
 			  << "Redefining (crate,card,channel)=>id link ("
 			  << daq_id.crate<<", "<< daq_id.card<<", "<< daq_id.channel<<")=>"
-			  << fChannelMap.find(daq_id)->second;
+			  << iSeen->second;
       }
+      else seen.emplace(daq_id, entry->channel);
 
-      fChannelMap.insert( p );
-      fChannelReverseMap.insert( std::pair< UBLArSoftCh_t, UBDaqID >( larsoft_chan, daq_id ) );
+      entries.push_back(*entry);
     }
+    PQclear(res);
     this->DisConnect();
+    return UBChannelTable(std::move(entries));
   }// end of LoadUBChannelMap
 
+  std::shared_ptr<UBChannelTable const> DatabaseUtil::GetUBChannelTable( int data_taking_timestamp, int swizzling_timestamp ) {
+    // Use prevously grabbed data to avoid repeated call to database.
+    auto& table = fChannelTables[{ data_taking_timestamp, swizzling_timestamp }];
+    if (table) return table;
+
+    // then the cache file from a previous job, if any;
+    // the cache is only an optimization: on any failure the database is used;
+    // negative timestamps ask for the current map, which a file may not be
+    std::string cacheFile;
+    if (!fChannelMapCacheDir.empty()
+      && (data_taking_timestamp >= 0) && (swizzling_timestamp >= 0))
+    {
+      cacheFile = fChannelMapCacheDir + "/ubchannelmap_" + std::to_string(data_taking_timestamp)
+        + "_" + std::to_string(swizzling_timestamp) + ".bin";
+      if (std::ifstream(cacheFile).good()) {
+        try {
+          table = std::make_shared<UBChannelTable const>(UBChannelTable::readCache(cacheFile));
+          MF_LOG_DEBUG("DatabaseUtil") << "Channel map read from '" << cacheFile << "'\n";
+          return table;
+        }
+        catch (cet::exception const& e) {
+          mf::LogWarning("DatabaseUtil") << "Channel map cache ignored, reading the database: "
+            << e.what();
+        }
+      }
+    }
+
+    table = std::make_shared<UBChannelTable const>
+      (LoadUBChannelMap( data_taking_timestamp, swizzling_timestamp ));
+
+    if (!cacheFile.empty()) {
+      // written aside and renamed, so that concurrent jobs never see half a file
+      std::string const tmpFile = cacheFile + ".tmp" + std::to_string(getpid());
+      try {
+        table->writeCache(tmpFile);
+        if (std::rename(tmpFile.c_str(), cacheFile.c_str()) != 0) {
+          mf::LogWarning("DatabaseUtil") << "Could not move the channel map cache to '"
+            << cacheFile << "'\n";
+          std::remove(tmpFile.c_str());
+        }
+      }
+      catch (cet::exception const& e) {
+        mf::LogWarning("DatabaseUtil") << "Channel map cache not written: " << e.what();
+        std::remove(tmpFile.c_str());
+      }
+    }
+    return table;
+  }
+
   UBChannelMap_t DatabaseUtil::GetUBChannelMap( int data_taking_timestamp, int swizzling_timestamp ) {
-    LoadUBChannelMap( data_taking_timestamp, swizzling_timestamp );
-    return fChannelMap;
+    return GetUBChannelTable( data_taking_timestamp, swizzling_timestamp )->map();
   }
 
   UBChannelReverseMap_t DatabaseUtil::GetUBChannelReverseMap( int data_taking_timestamp, int swizzling_timestamp ) {
-    LoadUBChannelMap( data_taking_timestamp, swizzling_timestamp );
-    return fChannelReverseMap;
+    return GetUBChannelTable( data_taking_timestamp, swizzling_timestamp )->reverseMap();
   }
 
   // Handy, typical string-splitting-to-vector function.
@@ -11,15 +11,15 @@
 #include "larcorealg/Geometry/PlaneGeo.h"
 #include "larcorealg/Geometry/TPCGeo.h"
 #include "lardata/DetectorInfoServices/DetectorClocksService.h"
+#include "lardata/DetectorInfoServices/InputFileMetadataCache.h"
 #include "lardata/DetectorInfoServices/LArPropertiesService.h"
 #include "lardata/Utilities/DatabaseUtil.h"
 #include "lardata/Utilities/DetectorPropertiesServiceArgoNeuT.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
 // Art includes
-#include "art_root_io/RootDB/SQLite3Wrapper.h"
 #include "canvas/Utilities/Exception.h"
-#include "fhiclcpp/make_ParameterSet.h"
+#include "fhiclcpp/ParameterSet.h"
 
 namespace util {
 
@@ -40,6 +40,11 @@ namespace util {
            "DetectorPropertiesServiceArgoNeuT!";
 
     // Register for callbacks.
+    if (fInheritNumberTimeSamples) {
+      // the input file is read once for all the services needing it
+      detinfo::InputFileMetadataCache::instance().registerConsumer(
+        "DetectorPropertiesServiceArgoNeuT", &isDetectorPropertiesServiceArgoNeuT);
+    }
     reg.sPostOpenFile.watch(this, &DetectorPropertiesServiceArgoNeuT::postOpenFile);
   }
 
@@ -73,47 +78,37 @@ namespace util {
 
     if (!fInheritNumberTimeSamples) return;
 
-    // The only way to access art service metadata from the input file
-    // is to open it as a separate TFile object.  Do that now.
+    // The art service metadata from the input file is read once for all the
+    // services which need it (see detinfo::InputFileMetadataCache).
 
     if (empty(filename)) return;
 
-    std::unique_ptr<TFile> file{TFile::Open(filename.c_str(), "READ")};
-    if (file && !file->IsZombie() && file->IsOpen()) {
-
-      // Open the sqlite datatabase.
-
-      art::SQLite3Wrapper sqliteDB(file.get(), "RootFileDB");
+    auto const metadata = detinfo::InputFileMetadataCache::instance().metadata(filename);
+    if (metadata->open) {
 
       // Loop over all stored ParameterSets.
 
       unsigned int iNumberTimeSamples = 0; // Combined value of NumberTimeSamples.
       unsigned int nNumberTimeSamples = 0; // Number of NumberTimeSamples parameters seen.
 
-      sqlite3_stmt* stmt = nullptr;
-      sqlite3_prepare_v2(sqliteDB, "SELECT PSetBlob from ParameterSets;", -1, &stmt, nullptr);
-      while (sqlite3_step(stmt) == SQLITE_ROW) {
-        fhicl::ParameterSet ps;
-        fhicl::make_ParameterSet(reinterpret_cast<char const*>(sqlite3_column_text(stmt, 0)), ps);
-        // Is this a DetectorPropertiesServiceArgoNeuT parameter set?
-
-        if (isDetectorPropertiesServiceArgoNeuT(ps)) {
-          // Check NumberTimeSamples
-
-          unsigned int newNumberTimeSamples = ps.get<unsigned int>("NumberTimeSamples");
-
-          // Ignore parameter values that match the current configuration.
-
-          if (newNumberTimeSamples != fPS.get<unsigned int>("NumberTimeSamples")) {
-            if (nNumberTimeSamples == 0)
-              iNumberTimeSamples = newNumberTimeSamples;
-            else if (newNumberTimeSamples != iNumberTimeSamples) {
-              throw cet::exception("DetectorPropertiesServiceArgoNeuT")
-                << "Historical values of NumberTimeSamples do not agree: " << iNumberTimeSamples
-                << " " << newNumberTimeSamples << "\n";
-            }
-            ++nNumberTimeSamples;
+      // These are the DetectorPropertiesServiceArgoNeuT parameter sets.
+      for (fhicl::ParameterSet const& ps :
+           metadata->parameterSets("DetectorPropertiesServiceArgoNeuT")) {
+        // Check NumberTimeSamples
+
+        unsigned int newNumberTimeSamples = ps.get<unsigned int>("NumberTimeSamples");
+
+        // Ignore parameter values that match the current configuration.
+
+        if (newNumberTimeSamples != fPS.get<unsigned int>("NumberTimeSamples")) {
+          if (nNumberTimeSamples == 0)
+            iNumberTimeSamples = newNumberTimeSamples;
+          else if (newNumberTimeSamples != iNumberTimeSamples) {
+            throw cet::exception("DetectorPropertiesServiceArgoNeuT")
+              << "Historical values of NumberTimeSamples do not agree: " << iNumberTimeSamples
+              << " " << newNumberTimeSamples << "\n";
           }
+          ++nNumberTimeSamples;
         }
       }
 
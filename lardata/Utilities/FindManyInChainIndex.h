@@ -0,0 +1,342 @@
+/**
+ * @file   lardata/Utilities/FindManyInChainIndex.h
+ * @brief  Reusable, flat index of chains of associations.
+ * @date   October 19, 2026
+ * @see    lardata/Utilities/FindManyInChainP.h
+ *
+ * This library is header-only.
+ *
+ */
+
+#ifndef LARDATA_UTILITIES_FINDMANYINCHAININDEX_H
+#define LARDATA_UTILITIES_FINDMANYINCHAININDEX_H
+
+// LArSoft libraries
+#include "lardata/Utilities/FindManyInChainP.h" // lar::SameAsData
+#include "lardata/Utilities/CollectionView.h"
+
+// framework
+#include "canvas/Persistency/Common/Ptr.h"
+#include "canvas/Persistency/Provenance/EventID.h"
+#include "canvas/Persistency/Provenance/ProductID.h"
+#include "canvas/Utilities/InputTag.h"
+
+// C/C++ standard library
+#include <vector>
+#include <map>
+#include <deque>
+#include <tuple>
+#include <string>
+#include <memory> // std::shared_ptr<>
+#include <mutex>
+#include <typeindex>
+#include <limits> // std::numeric_limits<>
+#include <cstdlib> // std::size_t
+
+
+namespace lar {
+
+  namespace details {
+
+    /// Rows of a single product in a `PtrAdjacency`.
+    struct PtrAdjacencyBlock {
+      art::ProductID id; ///< ID of the product of the left objects.
+      std::size_t firstRow = 0U; ///< Index of the row of the key `0`.
+      std::size_t nKeys = 0U; ///< Number of keys (rows) in this product.
+    }; // struct PtrAdjacencyBlock
+
+
+    /**
+     * @brief Compressed-sparse-row adjacency from art pointers to targets.
+     * @tparam Target type of the objects the rows are connected to
+     *
+     * Each row represents a left object, identified by its product ID and key.
+     * The rows of a single product are contiguous (a "block"), so that a left
+     * pointer is translated into a row index with a lookup among the (few)
+     * blocks and an addition. The connected target pointers of all rows are
+     * stored in a single contiguous vector, delimited by an offset vector.
+     */
+    template <typename Target>
+    class PtrAdjacency {
+
+        public:
+      using Target_t = Target;
+      using TargetPtr_t = art::Ptr<Target_t>;
+      using TargetPtrs_t = std::vector<TargetPtr_t>;
+      using const_iterator = typename TargetPtrs_t::const_iterator;
+      using Row_t = lar::RangeAsCollection_t<const_iterator>;
+
+      /// Value returned by `rowOf()` when the pointer is not indexed.
+      static constexpr std::size_t NoRow = std::numeric_limits<std::size_t>::max();
+
+      /// Rows of a single product.
+      using Block_t = PtrAdjacencyBlock;
+
+
+      /// Returns the number of rows.
+      std::size_t nRows() const { return fOffsets.size() - 1U; }
+
+      /// Returns the target pointers connected to the row `i` (no check!).
+      Row_t row(std::size_t i) const
+        {
+          return lar::makeCollectionView(
+            fTargets.cbegin() + fOffsets[i], fTargets.cbegin() + fOffsets[i + 1]
+            );
+        }
+
+      /// Returns the row of the left object with `id` and `key`, or `NoRow`.
+      std::size_t rowOf(art::ProductID const& id, std::size_t key) const;
+
+      /// Returns the row of the left object pointed by `ptr`, or `NoRow`.
+      template <typename Left>
+      std::size_t rowOf(art::Ptr<Left> const& ptr) const
+        { return rowOf(ptr.id(), ptr.key()); }
+
+      /// Returns all the target pointers, row after row.
+      TargetPtrs_t const& targets() const { return fTargets; }
+
+      /// Returns the blocks of rows.
+      std::vector<Block_t> const& blocks() const { return fBlocks; }
+
+
+      /**
+       * @brief Builds the adjacency of the left objects of an association.
+       * @param assns the association data product
+       * @param restrictTo if valid, only left objects from this product are
+       *                   considered
+       * @param nKeys if not `0`, number of rows for the `restrictTo` product
+       *
+       * The construction takes three passes on `assns` and is linear in its
+       * size; the targets of each row keep the order in `assns`.
+       */
+      template <typename Assns>
+      static PtrAdjacency fromAssns(
+        Assns const& assns,
+        art::ProductID const& restrictTo = art::ProductID{},
+        std::size_t nKeys = 0U
+        );
+
+      /**
+       * @brief Returns a new adjacency from our rows to the targets of `next`.
+       * @tparam Further type of targets of the new adjacency
+       * @param next list of adjacencies from our targets to `Further`
+       *
+       * Each of our targets is looked up in `next` and its connections are
+       * appended to the ones of the row it belongs to. The blocks of rows are
+       * the same as ours.
+       */
+      template <typename Further>
+      PtrAdjacency<Further> compose
+        (std::vector<PtrAdjacency<Further>> const& next) const;
+
+
+        private:
+      template <typename> friend class PtrAdjacency;
+
+      std::vector<Block_t> fBlocks; ///< Rows of each product.
+      std::vector<std::size_t> fOffsets { 0U }; ///< Row boundaries.
+      TargetPtrs_t fTargets; ///< All the connected targets, row by row.
+
+      /// Returns the index of the block for `id`, or `fBlocks.size()`.
+      std::size_t blockOf(art::ProductID const& id) const;
+
+    }; // class PtrAdjacency<>
+
+  } // namespace details
+
+
+  /**
+   * @brief Flat index of the objects associated via a chain of associations.
+   * @tparam Target type of objects to be fetched
+   * @tparam Intermediate types of objects connecting to Target by association
+   * @see `lar::FindManyInChainP`, `lar::FindManyInChainCache`
+   *
+   * This object delivers the same information as `lar::FindManyInChainP`
+   * (with the same template arguments and the same input tag conventions),
+   * and the same target pointers in the same order.
+   * It differs from it in the layout of the result: all the target pointers
+   * are stored in a single vector, and a vector of offsets delimits the ones
+   * pertaining each source element (compressed sparse row format).
+   * The construction is linear in the size of the association data products
+   * involved (three passes each), and a query costs as much as its answer.
+   *
+   * The source of the chain must be a whole data product (via its handle).
+   * When the same chain needs to be queried by different modules in the same
+   * event, `lar::FindManyInChainCache` allows to share a single index.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * auto showers = event.getValidHandle<std::vector<recob::Shower>>(showerTag);
+   * lar::FindManyInChainIndex<recob::Hit, recob::Cluster> showerToHits
+   *   (showers, event, showerTag);
+   *
+   * for (std::size_t iShower = 0; iShower < showers->size(); ++iShower) {
+   *   for (art::Ptr<recob::Hit> const& hit: showerToHits[iShower]) {
+   *     // ...
+   *   }
+   * } // for each shower
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   *
+   * @note Due to the inability to retrieve provenance information in _gallery_,
+   *       this class is not compatible with _gallery_.
+   */
+  template <typename Target, typename... Intermediate>
+  class FindManyInChainIndex {
+
+      public:
+    using Target_t = Target; ///< Type of the associated objects.
+    using TargetPtr_t = art::Ptr<Target_t>; ///< Pointer to associated objects.
+
+    /// Type of the index of the whole chain.
+    using Adjacency_t = details::PtrAdjacency<Target_t>;
+
+    /// Type returned by `at()`: a sequence of `TargetPtr_t`.
+    using TargetPtrRange_t = typename Adjacency_t::Row_t;
+
+    /**
+     * @brief Constructor: indexes the target objects associated to all the
+     *        objects in the specified data product.
+     * @tparam Handle type of _art_ handle to the source data product
+     * @tparam Event type of event to be used
+     * @tparam InputTags a variable number of `art::InputTag` objects
+     * @param source art handle to the source objects
+     * @param event the event to read associations and objects from
+     * @param tags input tags for each one of the required associations
+     *
+     * The tags follow the same convention as `lar::FindManyInChainP::find()`.
+     */
+    template <typename Handle, typename Event, typename... InputTags>
+    FindManyInChainIndex
+      (Handle const& source, Event const& event, InputTags... tags);
+
+    /// Returns the number of source objects we have information about.
+    std::size_t size() const { return fIndex.nRows(); }
+
+    /// Returns the targets associated to the source element `i` (no check).
+    TargetPtrRange_t operator[] (std::size_t i) const { return fIndex.row(i); }
+
+    /// Returns the targets associated to the source element `i`.
+    /// @throw std::out_of_range if the specified index is not valid
+    TargetPtrRange_t at(std::size_t i) const;
+
+    /// Returns all the associated targets, in the order of the source elements.
+    std::vector<TargetPtr_t> const& allTargets() const
+      { return fIndex.targets(); }
+
+    /// Returns the product ID of the source data product.
+    art::ProductID sourceID() const { return fIndex.blocks().front().id; }
+
+      private:
+    Adjacency_t fIndex; ///< The complete index.
+
+  }; // class FindManyInChainIndex<>
+
+
+  /**
+   * @brief Event-scoped cache of association chain indices.
+   * @see `lar::FindManyInChainIndex`
+   *
+   * Indices are identified by their type (that is, by the types of the objects
+   * in the chain), the source data product and the input tags of the
+   * associations, and they are kept for the event they have been created
+   * into.
+   * The cache holds the indices of a limited number of events (by default,
+   * 4): when an index for a new event is requested, the indices of the oldest
+   * event are dropped.
+   * Indices are shared: users keep a shared pointer to them, which remains
+   * valid after they are dropped from the cache.
+   *
+   * All the modules of a job can share the indices through the `global()`
+   * cache:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * auto showers = event.getValidHandle<std::vector<recob::Shower>>(showerTag);
+   * auto const showerToHits = lar::FindManyInChainCache::global()
+   *   .get<recob::Hit, recob::Cluster>(showers, event, showerTag);
+   *
+   * for (art::Ptr<recob::Hit> const& hit: (*showerToHits)[0]) // ...
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * The first module asking for a chain in an event will pay the cost of the
+   * index construction, and the others will reuse it.
+   *
+   * The cache is thread-safe. Two threads asking for the same missing index
+   * at the same time may both build it, in which case only one is kept.
+   *
+   * @note The event is identified by its `art::EventID` and by the address of
+   *       the source data product, so that events with the same ID from
+   *       different input files are still told apart.
+   */
+  class FindManyInChainCache {
+
+      public:
+
+    /// Constructor: keeps indices of up to `maxEvents` events.
+    FindManyInChainCache(std::size_t maxEvents = 4U): fMaxEvents(maxEvents) {}
+
+    /**
+     * @brief Returns the index for the specified chain, building it if needed.
+     * @tparam Target type of objects to be fetched
+     * @tparam Intermediate types of objects connecting to Target
+     * @param source art handle to the source objects
+     * @param event the event to read associations and objects from
+     * @param tags input tags for each one of the required associations
+     * @return a shared pointer to the requested index
+     * @see `lar::FindManyInChainIndex`
+     */
+    template <
+      typename Target, typename... Intermediate,
+      typename Handle, typename Event, typename... InputTags
+      >
+    std::shared_ptr<FindManyInChainIndex<Target, Intermediate...> const> get
+      (Handle const& source, Event const& event, InputTags... tags);
+
+    /// Returns the number of indices currently in the cache.
+    std::size_t size() const;
+
+    /// Drops all the indices from the cache.
+    void clear();
+
+    /// Returns a cache shared by the whole job.
+    static FindManyInChainCache& global()
+      { static FindManyInChainCache cache; return cache; }
+
+
+      private:
+    /// Identifier of an index: event, index type, source product and tags.
+    using Key_t = std::tuple<
+      art::EventID, std::type_index, art::ProductID, void const*, std::string
+      >;
+
+    std::size_t fMaxEvents; ///< Number of events to keep indices for.
+
+    mutable std::mutex fLock; ///< Protects all the data members below.
+
+    std::map<Key_t, std::shared_ptr<void const>> fIndices; ///< Cached indices.
+
+    std::deque<art::EventID> fEvents; ///< Cached events, oldest first.
+
+    /// Returns the cached index with the specified key, null if none.
+    std::shared_ptr<void const> find(Key_t const& key) const;
+
+    /// Stores `index` unless already present; returns the stored index.
+    std::shared_ptr<void const> store
+      (Key_t const& key, std::shared_ptr<void const> index);
+
+    /// Returns a string representation of the tags.
+    template <typename... InputTags>
+    static std::string encodeTags(InputTags const&... tags);
+
+  }; // class FindManyInChainCache
+
+
+} // namespace lar
+
+
+//------------------------------------------------------------------------------
+//---  template implementation
+//---
+#include "FindManyInChainIndex.tcc" // expected in the same directory as this file
+
+//------------------------------------------------------------------------------
+
+
+#endif // LARDATA_UTILITIES_FINDMANYINCHAININDEX_H
@@ -0,0 +1,442 @@
+/**
+ * @file   lardata/Utilities/FindManyInChainIndex.tcc
+ * @brief  Template implementation for `FindManyInChainIndex.h`.
+ * @date   October 19, 2026
+ *
+ */
+
+#ifndef LARDATA_UTILITIES_FINDMANYINCHAININDEX_TCC
+#define LARDATA_UTILITIES_FINDMANYINCHAININDEX_TCC
+
+#ifndef LARDATA_UTILITIES_FINDMANYINCHAININDEX_H
+#error "FindManyInChainIndex.tcc must not be included directly. Include FindManyInChainIndex.h instead."
+#endif // LARDATA_UTILITIES_FINDMANYINCHAININDEX_H
+
+// framework
+#include "canvas/Persistency/Common/Assns.h"
+
+// C/C++ standard library
+#include <algorithm> // std::find()
+#include <iterator> // std::prev()
+#include <stdexcept> // std::out_of_range
+#include <typeinfo>
+#include <utility> // std::move()
+#include <type_traits> // std::is_same_v<>
+#include <cassert>
+
+
+//------------------------------------------------------------------------------
+//---  lar::details::PtrAdjacency
+//---
+template <typename Target>
+std::size_t lar::details::PtrAdjacency<Target>::blockOf
+  (art::ProductID const& id) const
+{
+  // there is usually only one block, rarely more than a handful
+  std::size_t iBlock = 0;
+  for (; iBlock < fBlocks.size(); ++iBlock)
+    if (fBlocks[iBlock].id == id) break;
+  return iBlock;
+} // lar::details::PtrAdjacency<>::blockOf()
+
+
+//------------------------------------------------------------------------------
+template <typename Target>
+std::size_t lar::details::PtrAdjacency<Target>::rowOf
+  (art::ProductID const& id, std::size_t key) const
+{
+  std::size_t const iBlock = blockOf(id);
+  if (iBlock == fBlocks.size()) return NoRow;
+  Block_t const& block = fBlocks[iBlock];
+  return (key < block.nKeys)? block.firstRow + key: NoRow;
+} // lar::details::PtrAdjacency<>::rowOf()
+
+
+//------------------------------------------------------------------------------
+template <typename Target>
+template <typename Assns>
+auto lar::details::PtrAdjacency<Target>::fromAssns(
+  Assns const& assns,
+  art::ProductID const& restrictTo /* = art::ProductID{} */,
+  std::size_t nKeys /* = 0U */
+  ) -> PtrAdjacency
+{
+  static_assert(std::is_same_v<typename Assns::right_t, Target_t>,
+    "PtrAdjacency::fromAssns(): association has the wrong target type.");
+
+  bool const restricted = restrictTo.isValid();
+
+  PtrAdjacency adj;
+
+  //
+  // 1. find the products of the left pointers and their number of keys
+  //
+  if (restricted) adj.fBlocks.push_back({ restrictTo, 0U, nKeys });
+  std::size_t iLastBlock = 0U;
+  for (auto const& assn: assns) {
+    auto const& left = assn.first;
+    if (adj.fBlocks.empty() || (adj.fBlocks[iLastBlock].id != left.id())) {
+      if (restricted) continue;
+      iLastBlock = adj.blockOf(left.id());
+      if (iLastBlock == adj.fBlocks.size())
+        adj.fBlocks.push_back({ left.id(), 0U, 0U });
+    }
+    Block_t& block = adj.fBlocks[iLastBlock];
+    if (left.key() >= block.nKeys) block.nKeys = left.key() + 1U;
+  } // for
+
+  std::size_t nRows = 0U;
+  for (Block_t& block: adj.fBlocks) {
+    block.firstRow = nRows;
+    nRows += block.nKeys;
+  } // for blocks
+
+  //
+  // 2. count the targets of each row, and turn the counts into offsets
+  //
+  adj.fOffsets.assign(nRows + 1U, 0U);
+  for (auto const& assn: assns) {
+    std::size_t const iRow = adj.rowOf(assn.first);
+    if (iRow != NoRow) ++(adj.fOffsets[iRow + 1U]);
+  } // for
+  for (std::size_t iRow = 0; iRow < nRows; ++iRow)
+    adj.fOffsets[iRow + 1U] += adj.fOffsets[iRow];
+
+  //
+  // 3. place the targets, preserving the association order within each row
+  //
+  adj.fTargets.resize(adj.fOffsets.back());
+  std::vector<std::size_t> cursors
+    (adj.fOffsets.begin(), std::prev(adj.fOffsets.end()));
+  for (auto const& assn: assns) {
+    std::size_t const iRow = adj.rowOf(assn.first);
+    if (iRow != NoRow) adj.fTargets[cursors[iRow]++] = assn.second;
+  } // for
+
+  return adj;
+} // lar::details::PtrAdjacency<>::fromAssns()
+
+
+//------------------------------------------------------------------------------
+template <typename Target>
+template <typename Further>
+auto lar::details::PtrAdjacency<Target>::compose
+  (std::vector<PtrAdjacency<Further>> const& next) const
+  -> PtrAdjacency<Further>
+{
+  // pairs (adjacency index, row) for each of our targets
+  std::vector<std::pair<std::size_t, std::size_t>> matches;
+  matches.reserve(fTargets.size());
+  for (TargetPtr_t const& ptr: fTargets) {
+    std::size_t iAdj = 0;
+    std::size_t iRow = NoRow;
+    for (; iAdj < next.size(); ++iAdj) {
+      iRow = next[iAdj].rowOf(ptr);
+      if (iRow != NoRow) break;
+    } // for
+    matches.emplace_back(iAdj, iRow);
+  } // for
+
+  PtrAdjacency<Further> result;
+  result.fBlocks = fBlocks;
+  result.fOffsets.assign(fOffsets.size(), 0U);
+
+  // 1. count
+  for (std::size_t iRow = 0; iRow < nRows(); ++iRow) {
+    std::size_t n = 0U;
+    for (std::size_t i = fOffsets[iRow]; i < fOffsets[iRow + 1]; ++i) {
+      auto const [ iAdj, iNextRow ] = matches[i];
+      if (iNextRow == NoRow) continue; // no further connection
+      auto const& nextOffsets = next[iAdj].fOffsets;
+      n += nextOffsets[iNextRow + 1] - nextOffsets[iNextRow];
+    } // for
+    result.fOffsets[iRow + 1] = result.fOffsets[iRow] + n;
+  } // for
+
+  // 2. fill
+  result.fTargets.reserve(result.fOffsets.back());
+  for (auto const& [ iAdj, iNextRow ]: matches) {
+    if (iNextRow == NoRow) continue;
+    auto const& nextRow = next[iAdj].row(iNextRow);
+    result.fTargets.insert
+      (result.fTargets.end(), nextRow.cbegin(), nextRow.cend());
+  } // for
+  assert(result.fTargets.size() == result.fOffsets.back());
+
+  return result;
+} // lar::details::PtrAdjacency<>::compose()
+
+
+//------------------------------------------------------------------------------
+//---  lar::FindManyInChainIndex
+//---
+namespace lar::details {
+
+  /// Type of the objects at the specified tier of the chain (`0` is `Target`).
+  template <typename Target, unsigned int Tier, typename... Intermediate>
+  struct ChainTierType { using type = get_type_t<(Tier - 1), Intermediate...>; };
+
+  template <typename Target, typename... Intermediate>
+  struct ChainTierType<Target, 0U, Intermediate...> { using type = Target; };
+
+  template <typename Target, unsigned int Tier, typename... Intermediate>
+  using ChainTierType_t
+    = typename ChainTierType<Target, Tier, Intermediate...>::type;
+
+
+  /// Indexes all associations `Left` -> `Right` from the specified tag.
+  template <typename Left, typename Right, typename Event>
+  std::vector<PtrAdjacency<Right>> makeTierAdjacency(
+    std::vector<art::Ptr<Left>> const&, Event const& event,
+    art::InputTag const& tag
+    )
+  {
+    auto const& assns
+      = *(event.template getValidHandle<art::Assns<Left, Right>>(tag));
+    std::vector<PtrAdjacency<Right>> adj;
+    adj.push_back(PtrAdjacency<Right>::fromAssns(assns));
+    return adj;
+  } // makeTierAdjacency(tag)
+
+
+  /// Indexes the associations `Left` -> `Right` of all the products of
+  /// `lefts`, each from the producer of its left product.
+  template <typename Left, typename Right, typename Event>
+  std::vector<PtrAdjacency<Right>> makeTierAdjacency(
+    std::vector<art::Ptr<Left>> const& lefts, Event const& event,
+    lar::SameAsDataTag
+    )
+  {
+    std::vector<art::ProductID> IDs;
+    for (art::Ptr<Left> const& left: lefts) {
+      if (!IDs.empty() && (IDs.back() == left.id())) continue;
+      if (std::find(IDs.begin(), IDs.end(), left.id()) == IDs.end())
+        IDs.push_back(left.id());
+    } // for
+
+    std::vector<PtrAdjacency<Right>> adj;
+    adj.reserve(IDs.size());
+    for (art::ProductID const& ID: IDs) {
+      art::InputTag const tag = tagFromProductID<std::vector<Left>>(ID, event);
+      auto const& assns
+        = *(event.template getValidHandle<art::Assns<Left, Right>>(tag));
+      adj.push_back(PtrAdjacency<Right>::fromAssns(assns, ID));
+    } // for
+    return adj;
+  } // makeTierAdjacency(SameAsData)
+
+
+  /**
+   * @tparam Target type at the end of the chain
+   * @tparam Tier tier reached so far (`0` is `Target`)
+   * @tparam Intermediate intermediate types, leftmost is closest to `Target`
+   */
+  template <typename Target, unsigned int Tier, typename... Intermediate>
+  struct FindManyInChainIndexImpl {
+
+    /// Total number of tiers (original source + all intermediates).
+    static constexpr unsigned int Tiers = sizeof...(Intermediate) + 1;
+
+    using Current_t = ChainTierType_t<Target, Tier, Intermediate...>;
+    using Next_t = ChainTierType_t<Target, (Tier - 1U), Intermediate...>;
+
+    /// Extends the source -> `Current_t` index to `Target`.
+    template <typename Event, typename InputTags>
+    static PtrAdjacency<Target> extend(
+      PtrAdjacency<Current_t> const& sofar,
+      Event const& event, InputTags const& tags
+      )
+    {
+      // the tag for Current_t <==> Next_t
+      constexpr auto nTag = Tiers - Tier;
+      auto const next = makeTierAdjacency<Current_t, Next_t>
+        (sofar.targets(), event, std::get<nTag>(tags));
+
+      return FindManyInChainIndexImpl<Target, (Tier - 1U), Intermediate...>
+        ::extend(sofar.compose(next), event, tags);
+    } // extend()
+
+  }; // FindManyInChainIndexImpl<>
+
+
+  template <typename Target, typename... Intermediate>
+  struct FindManyInChainIndexImpl<Target, 0U, Intermediate...> {
+
+    template <typename Event, typename InputTags>
+    static PtrAdjacency<Target> extend
+      (PtrAdjacency<Target>&& sofar, Event const&, InputTags const&)
+      { return std::move(sofar); }
+
+  }; // FindManyInChainIndexImpl<0>
+
+
+  /// Indexes the associations of the whole source product with `tag`.
+  template <typename Right, typename Handle, typename Event>
+  PtrAdjacency<Right> makeSourceAdjacency
+    (Handle const& source, Event const& event, art::InputTag const& tag)
+  {
+    using Left_t = typename Handle::element_type::value_type;
+    auto const& assns
+      = *(event.template getValidHandle<art::Assns<Left_t, Right>>(tag));
+    return PtrAdjacency<Right>::fromAssns(assns, source.id(), source->size());
+  } // makeSourceAdjacency(tag)
+
+  template <typename Right, typename Handle, typename Event>
+  PtrAdjacency<Right> makeSourceAdjacency
+    (Handle const& source, Event const& event, lar::SameAsDataTag)
+  {
+    return makeSourceAdjacency<Right>
+      (source, event, tagFromHandle(source));
+  } // makeSourceAdjacency(SameAsData)
+
+
+  /// Encodes a tag for the cache key.
+  inline std::string encodeChainTag(art::InputTag const& tag)
+    { return tag.encode(); }
+  inline std::string encodeChainTag(lar::SameAsDataTag)
+    { return "<same as data>"; }
+
+} // namespace lar::details
+
+
+//------------------------------------------------------------------------------
+template <typename Target, typename... Intermediate>
+template <typename Handle, typename Event, typename... InputTags>
+lar::FindManyInChainIndex<Target, Intermediate...>::FindManyInChainIndex
+  (Handle const& source, Event const& event, InputTags... tags)
+{
+  static_assert(details::is_handle_v<Handle>,
+    "FindManyInChainIndex requires an art handle to the source data product");
+
+  constexpr auto Tiers = sizeof...(Intermediate) + 1U;
+
+  // create a parameter pack with one tag per association
+  auto const allTags
+    = details::AssociationFinderBase::makeTagsTuple<Tiers>
+    (SameAsData, std::forward<InputTags>(tags)...);
+
+  using First_t = details::ChainTierType_t<Target, (Tiers - 1U), Intermediate...>;
+
+  fIndex
+    = details::FindManyInChainIndexImpl<Target, (Tiers - 1U), Intermediate...>
+    ::extend(
+      details::makeSourceAdjacency<First_t>(source, event, std::get<0>(allTags)),
+      event, allTags
+      );
+
+} // lar::FindManyInChainIndex<>::FindManyInChainIndex()
+
+
+//------------------------------------------------------------------------------
+template <typename Target, typename... Intermediate>
+auto lar::FindManyInChainIndex<Target, Intermediate...>::at
+  (std::size_t i) const -> TargetPtrRange_t
+{
+  if (i >= size()) {
+    throw std::out_of_range("FindManyInChainIndex::at(" + std::to_string(i)
+      + "): only " + std::to_string(size()) + " elements");
+  }
+  return fIndex.row(i);
+} // lar::FindManyInChainIndex<>::at()
+
+
+//------------------------------------------------------------------------------
+//---  lar::FindManyInChainCache
+//---
+template <
+  typename Target, typename... Intermediate,
+  typename Handle, typename Event, typename... InputTags
+  >
+auto lar::FindManyInChainCache::get
+  (Handle const& source, Event const& event, InputTags... tags)
+  -> std::shared_ptr<FindManyInChainIndex<Target, Intermediate...> const>
+{
+  using Index_t = FindManyInChainIndex<Target, Intermediate...>;
+
+  Key_t const key {
+    event.id(), std::type_index(typeid(Index_t)),
+    source.id(), static_cast<void const*>(source.product()),
+    encodeTags(tags...)
+    };
+
+  auto index = find(key);
+  if (!index) {
+    // index built without holding the lock
+    index = store(key, std::make_shared<Index_t const>(source, event, tags...));
+  }
+  return std::static_pointer_cast<Index_t const>(index);
+
+} // lar::FindManyInChainCache::get()
+
+
+//------------------------------------------------------------------------------
+template <typename... InputTags>
+std::string lar::FindManyInChainCache::encodeTags(InputTags const&... tags) {
+  std::string s;
+  ((s += details::encodeChainTag(tags), s += ';'), ...);
+  return s;
+} // lar::FindManyInChainCache::encodeTags()
+
+
+//------------------------------------------------------------------------------
+inline std::size_t lar::FindManyInChainCache::size() const {
+  std::lock_guard<std::mutex> lock(fLock);
+  return fIndices.size();
+} // lar::FindManyInChainCache::size()
+
+
+//------------------------------------------------------------------------------
+inline void lar::FindManyInChainCache::clear() {
+  std::lock_guard<std::mutex> lock(fLock);
+  fIndices.clear();
+  fEvents.clear();
+} // lar::FindManyInChainCache::clear()
+
+
+//------------------------------------------------------------------------------
+inline std::shared_ptr<void const> lar::FindManyInChainCache::find
+  (Key_t const& key) const
+{
+  std::lock_guard<std::mutex> lock(fLock);
+  auto const iIndex = fIndices.find(key);
+  return (iIndex == fIndices.end())? nullptr: iIndex->second;
+} // lar::FindManyInChainCache::find()
+
+
+//------------------------------------------------------------------------------
+inline std::shared_ptr<void const> lar::FindManyInChainCache::store
+  (Key_t const& key, std::shared_ptr<void const> index)
+{
+  art::EventID const& eventID = std::get<0>(key);
+
+  std::lock_guard<std::mutex> lock(fLock);
+
+  // another thread might have stored the same index in the meanwhile
+  auto const [ iIndex, inserted ] = fIndices.emplace(key, std::move(index));
+  if (!inserted) return iIndex->second;
+
+  if (std::find(fEvents.begin(), fEvents.end(), eventID) == fEvents.end()) {
+    fEvents.push_back(eventID);
+    while (fEvents.size() > std::max(fMaxEvents, std::size_t(1U))) {
+      // drop all the indices of the oldest event
+      art::EventID const& oldest = fEvents.front();
+      for (auto it = fIndices.begin(); it != fIndices.end();) {
+        if (std::get<0>(it->first) == oldest) it = fIndices.erase(it);
+        else ++it;
+      } // for
+      fEvents.pop_front();
+    } // while
+  }
+
+  return iIndex->second;
+} // lar::FindManyInChainCache::store()
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // LARDATA_UTILITIES_FINDMANYINCHAININDEX_TCC
+
+// Local variables:
+// mode: c++
+// End:
@@ -0,0 +1,248 @@
+/**
+ * \file FlatUniqueRangeSet.h
+ *
+ * \ingroup RangeTool
+ *
+ * \brief Class def header for a class FlatUniqueRangeSet
+ *
+ * \date October 19, 2026
+ */
+
+/** \addtogroup RangeTool
+    @{*/
+
+#ifndef FLATUNIQUERANGESET_H
+#define FLATUNIQUERANGESET_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "Range.h"
+
+namespace util {
+
+  /**
+     \class FlatUniqueRangeSet
+     @brief Sorted vector of util::Range, which does not allow any overlap in contained element.
+     It holds the same content as util::UniqueRangeSet: ranges which overlap or touch each   \n
+     other are merged into one. The ranges are kept sorted in a contiguous vector, so that the \n
+     ranges overlapping a new one are found with a binary search, and iteration is cheap.      \n
+
+     Many ranges are best added together with the bulk insert(), which sorts them once and    \n
+     merges them with the existing ones in a single pass.
+  */
+  template <class T>
+  class FlatUniqueRangeSet {
+  public:
+    using value_type = util::Range<T>;
+    using Ranges_t = std::vector<value_type>;
+    using const_iterator = typename Ranges_t::const_iterator;
+    using iterator = const_iterator; ///< Ranges can't be modified in place.
+    using const_reverse_iterator = typename Ranges_t::const_reverse_iterator;
+
+    /// default ctor
+    FlatUniqueRangeSet() = default;
+
+    /// Ranges (sorted, not overlapping) access
+    const_iterator begin() const { return _ranges.begin(); }
+    const_iterator end()   const { return _ranges.end();   }
+    const_reverse_iterator rbegin() const { return _ranges.rbegin(); }
+    const_reverse_iterator rend()   const { return _ranges.rend();   }
+    const value_type& operator[](std::size_t i) const { return _ranges[i]; }
+
+    /// Number of (merged) ranges
+    std::size_t size() const { return _ranges.size(); }
+    /// Whether there is no range
+    bool empty() const { return _ranges.empty(); }
+    /// Removes all the ranges
+    void clear() { _ranges.clear(); }
+    /// Prepares room for n ranges
+    void reserve(std::size_t n) { _ranges.reserve(n); }
+
+    /// Merge two FlatUniqueRangeSet<T>
+    void Merge(const FlatUniqueRangeSet<T>& in) { insert(in.begin(), in.end()); }
+
+    /// Very first "start" of all contained range
+    const T& Start() const
+    {
+      if(empty()) throw std::runtime_error("Nothing in the set!");
+      return _ranges.front().Start();
+    }
+
+    /// Very last "end" of all contained range
+    const T& End() const
+    {
+      if(empty()) throw std::runtime_error("Nothing in the set!");
+      return _ranges.back().End();
+    }
+
+    /// First range overlapping (or touching) [start, end], end() if none
+    const_iterator FindOverlap(const T& start, const T& end) const
+    {
+      auto const first = firstNotBefore(start);
+      return ((first != _ranges.end()) && !(end < first->Start()))? first: _ranges.end();
+    }
+
+    /// Whether any range overlaps (or touches) [start, end]
+    bool Overlaps(const T& start, const T& end) const
+    { return FindOverlap(start, end) != _ranges.end(); }
+
+    /// Whether the value is in any of the ranges (boundaries included)
+    bool Contains(const T& value) const { return Overlaps(value, value); }
+
+    /**
+       Same as util::UniqueRangeSet::Exclusive(): returns the regions between the ranges,  \n
+       from the first range ending after "start" to the first one ending after "end". If no \n
+       range ends after "start", the result is the whole region between "start" and "end".
+    */
+    FlatUniqueRangeSet<T> Exclusive(const T start, const T end) const
+    {
+      FlatUniqueRangeSet<T> res;
+
+      auto const start_iter = firstNotBefore(start);
+      if(start_iter == _ranges.end()) {
+	res.emplace(start,end);
+	return res;
+      }
+      auto const end_iter = firstNotBefore(end);
+
+      // Anything to add to the head?
+      if(start < start_iter->Start()) res.emplace(start,start_iter->Start());
+
+      auto iter = start_iter;
+      T tmp_end = end;
+      while(iter != _ranges.end()) {
+	if(iter != start_iter)
+	  res.emplace(tmp_end,iter->Start());
+	tmp_end = iter->End();
+	if(iter == end_iter) break;
+	++iter;
+      }
+
+      // Anything to add to the tail?
+      if(tmp_end < end)
+	res.emplace(tmp_end,end);
+
+      return res;
+    }
+
+    /// Modified emplace that merges overlapping range. Return = # merged range.
+    std::size_t emplace(const T& start,const T& end)
+    {
+      value_type const range(start,end); // validates the range
+
+      // the ranges to be merged are contiguous: [ first, last )
+      auto const first = firstNotBefore(start);
+      auto last = first;
+      while((last != _ranges.end()) && !(end < last->Start())) ++last;
+
+      std::size_t const nMerged = last - first;
+      if(nMerged == 0) {
+	_ranges.insert(first, range);
+	return 0;
+      }
+
+      auto const target = _ranges.begin() + (first - _ranges.begin());
+      *target = value_type
+	(std::min(start, first->Start()), std::max(end, std::prev(last)->End()));
+      _ranges.erase(target + 1, _ranges.begin() + (last - _ranges.begin()));
+      return nMerged;
+    }
+
+    /// Modified insert that merges overlapping range. Return = # merged range.
+    std::size_t insert(const value_type& a) { return emplace(a.Start(),a.End()); }
+
+    /**
+       Bulk insert of util::Range elements in [begin, end).                               \n
+       The new ranges are sorted and merged with the existing ones in a single pass.       \n
+       Return = # ranges merged away (old size + new ranges - final size).
+    */
+    template <typename Iter>
+    std::size_t insert(Iter begin, Iter end)
+    {
+      std::size_t const nOld = _ranges.size();
+      std::size_t const nNew = std::distance(begin, end);
+      if(nNew == 0) return 0;
+
+      // new ranges sorted by start, then merged with the old ones
+      Ranges_t added(begin, end);
+      std::sort(added.begin(), added.end(), [](value_type const& a, value_type const& b)
+		{ return a.Start() < b.Start(); });
+
+      Ranges_t merged;
+      merged.reserve(nOld + nNew);
+      auto append = [&merged](value_type const& r) {
+	if(merged.empty() || (merged.back().End() < r.Start())) merged.push_back(r);
+	else if(merged.back().End() < r.End())
+	  merged.back() = value_type(merged.back().Start(), r.End());
+      };
+      auto iOld = _ranges.cbegin();
+      auto iNew = added.cbegin();
+      while((iOld != _ranges.cend()) || (iNew != added.cend())) {
+	if((iNew == added.cend())
+	   || ((iOld != _ranges.cend()) && (iOld->Start() < iNew->Start())))
+	  append(*iOld++);
+	else
+	  append(*iNew++);
+      }
+      _ranges = std::move(merged);
+      return nOld + nNew - _ranges.size();
+    }
+
+    /// Bulk insert of all the ranges in the list (see insert(begin, end)).
+    std::size_t insert(const Ranges_t& range_list)
+    { return insert(range_list.begin(), range_list.end()); }
+
+  private:
+    Ranges_t _ranges; ///< sorted, and not overlapping nor touching
+
+    /// First range not ending before value (ends are sorted too)
+    const_iterator firstNotBefore(const T& value) const
+    {
+      return std::partition_point(_ranges.begin(), _ranges.end(),
+				  [&value](value_type const& r){ return r.End() < value; });
+    }
+
+  };
+
+  /**
+     Builds one FlatUniqueRangeSet per entry of range_lists (e.g. one per channel), each from \n
+     the bulk insert of its ranges. The lists are split among up to nThreads threads.
+  */
+  template <class T>
+  std::vector<FlatUniqueRangeSet<T> > BuildUniqueRangeSets
+    (const std::vector<std::vector<util::Range<T> > >& range_lists, unsigned int nThreads = 1U)
+  {
+    std::size_t const N = range_lists.size();
+    std::vector<FlatUniqueRangeSet<T> > sets(N);
+
+    auto build = [&range_lists, &sets](std::size_t first, std::size_t last) {
+      for(std::size_t i = first; i < last; ++i) sets[i].insert(range_lists[i]);
+    };
+
+    // a thread is worth starting only with a few lists to process
+    std::size_t const nChunks = std::max<std::size_t>
+      (1U, std::min<std::size_t>(nThreads, N / 64U));
+    if(nChunks == 1U) {
+      build(0U, N);
+      return sets;
+    }
+
+    std::size_t const chunkSize = (N + nChunks - 1) / nChunks;
+    std::vector<std::thread> workers;
+    workers.reserve(nChunks);
+    for(std::size_t iChunk = 0; iChunk < nChunks; ++iChunk) {
+      std::size_t const first = iChunk * chunkSize;
+      workers.emplace_back(build, first, std::min(N, first + chunkSize));
+    }
+    for(auto& worker: workers) worker.join();
+    return sets;
+  }
+
+}
+
+#endif
+/** @} */ // end of doxygen group
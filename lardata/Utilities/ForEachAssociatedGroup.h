@@ -89,6 +89,9 @@ namespace util {
    *  * on each iteration, the information of which track the hits are
    *    associated to is not available; if that is also needed, use
    *    `util::associated_groups_with_left()` instead.
+   *
+   * For random access to the groups, or for associations not sorted by left
+   * pointer, see `util::AssnsIndex`.
    */
   template <class A>
   auto associated_groups(A const & assns) {
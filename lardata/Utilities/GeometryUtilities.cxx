@@ -8,6 +8,9 @@
 ////////////////////////////////////////////////////////////////////////
 
 #include "lardata/Utilities/GeometryUtilities.h"
+#include "lardata/Utilities/PxHitColumns.h"
+#include "lardata/Utilities/PxHitGridIndex.h"
+#include "lardata/Utilities/PxPolygon.h"
 #include "cetlib/pow.h"
 #include "larcorealg/Geometry/GeometryCore.h"
 #include "larcorealg/Geometry/PlaneGeo.h"
@@ -444,6 +447,61 @@ namespace util {
     return std::hypot(point1->w - point2->w, point1->t - point2->t);
   }
 
+  double
+  GeometryUtilities::Get2Dangle(util::PxHitColumns const& hits,
+                                std::size_t const iend,
+                                std::size_t const istart) const
+  {
+    return Get2Dangle(double(hits.w[iend]) - hits.w[istart],
+                      double(hits.t[iend]) - hits.t[istart]);
+  }
+
+  double
+  GeometryUtilities::Get2Dslope(util::PxHitColumns const& hits,
+                                std::size_t const iend,
+                                std::size_t const istart) const
+  {
+    return Get2Dslope(double(hits.w[iend]) - hits.w[istart],
+                      double(hits.t[iend]) - hits.t[istart]);
+  }
+
+  double
+  GeometryUtilities::Get2DDistance(util::PxHitColumns const& hits,
+                                   std::size_t const i1,
+                                   std::size_t const i2) const
+  {
+    return std::hypot(double(hits.w[i1]) - hits.w[i2], double(hits.t[i1]) - hits.t[i2]);
+  }
+
+  void
+  GeometryUtilities::Get2DDistances(util::PxHitColumns const& hits,
+                                    util::PxPoint const& point,
+                                    std::vector<float>& distances) const
+  {
+    std::size_t const n = hits.size();
+    distances.resize(n);
+    // plain square root rather than std::hypot, so that the loop vectorizes
+    float const w0 = point.w, t0 = point.t;
+    float const* const w = hits.w.data();
+    float const* const t = hits.t.data();
+    float* const d = distances.data();
+    for (std::size_t i = 0; i < n; ++i) {
+      float const dw = w[i] - w0, dt = t[i] - t0;
+      d[i] = std::sqrt(dw * dw + dt * dt);
+    }
+  }
+
+  void
+  GeometryUtilities::Get2Dangles(util::PxHitColumns const& hits,
+                                 util::PxPoint const& startpoint,
+                                 std::vector<float>& angles) const
+  {
+    std::size_t const n = hits.size();
+    angles.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+      angles[i] = Get2Dangle(hits.w[i] - startpoint.w, hits.t[i] - startpoint.t);
+  }
+
   ////////////////////////////
   // Calculate 2D distance, using 2D angle
   // in "cm" "cm" coordinates
@@ -875,6 +933,47 @@ namespace util {
     SelectLocalHitlistIndex(
       hitlist, hitlistlocal_index, startHit, linearlimit, ortlimit, lineslopetest);
 
+    FillLocalHitlist(hitlist, hitlistlocal_index, hitlistlocal, startHit, averageHit);
+  }
+
+  void
+  GeometryUtilities::SelectLocalHitlist(const util::PxHitGridIndex& hitindex,
+                                        std::vector<const util::PxHit*>& hitlistlocal,
+                                        util::PxPoint& startHit,
+                                        Double_t& linearlimit,
+                                        Double_t& ortlimit,
+                                        Double_t& lineslopetest) const
+  {
+    util::PxHit testHit;
+    SelectLocalHitlist(
+      hitindex, hitlistlocal, startHit, linearlimit, ortlimit, lineslopetest, testHit);
+  }
+
+  void
+  GeometryUtilities::SelectLocalHitlist(const util::PxHitGridIndex& hitindex,
+                                        std::vector<const util::PxHit*>& hitlistlocal,
+                                        util::PxPoint& startHit,
+                                        Double_t& linearlimit,
+                                        Double_t& ortlimit,
+                                        Double_t& lineslopetest,
+                                        util::PxHit& averageHit) const
+  {
+    hitlistlocal.clear();
+    std::vector<unsigned int> hitlistlocal_index;
+
+    SelectLocalHitlistIndex(
+      hitindex, hitlistlocal_index, startHit, linearlimit, ortlimit, lineslopetest);
+
+    FillLocalHitlist(hitindex.hits(), hitlistlocal_index, hitlistlocal, startHit, averageHit);
+  }
+
+  void
+  GeometryUtilities::FillLocalHitlist(const std::vector<util::PxHit>& hitlist,
+                                      const std::vector<unsigned int>& hitlistlocal_index,
+                                      std::vector<const util::PxHit*>& hitlistlocal,
+                                      const util::PxPoint& startHit,
+                                      util::PxHit& averageHit) const
+  {
     double timesum = 0;
     double wiresum = 0;
     for (size_t i = 0; i < hitlistlocal_index.size(); ++i) {
@@ -904,20 +1003,53 @@ namespace util {
     double locintercept = startHit.t - startHit.w * lineslopetest;
 
     for (size_t i = 0; i < hitlist.size(); ++i) {
+      if (IsLocalHit(hitlist[i], startHit, locintercept, lineslopetest, linearlimit, ortlimit)) {
+        hitlistlocal_index.push_back(i);
+      }
+    }
+  }
+
+  void
+  GeometryUtilities::SelectLocalHitlistIndex(const util::PxHitGridIndex& hitindex,
+                                             std::vector<unsigned int>& hitlistlocal_index,
+                                             util::PxPoint& startHit,
+                                             Double_t& linearlimit,
+                                             Double_t& ortlimit,
+                                             Double_t& lineslopetest) const
+  {
+    hitlistlocal_index.clear();
+    double locintercept = startHit.t - startHit.w * lineslopetest;
 
-      util::PxPoint hitonline;
+    // a selected hit is closer to the start than the sum of the two limits;
+    // the box is a bit larger to be safe from rounding
+    double const reach = (linearlimit + ortlimit) * (1.0 + 1e-9);
+    std::vector<util::PxHit> const& hitlist = hitindex.hits();
+    for (unsigned int i : hitindex.hitsInBox(
+           startHit.w - reach, startHit.w + reach, startHit.t - reach, startHit.t + reach)) {
+      if (IsLocalHit(hitlist[i], startHit, locintercept, lineslopetest, linearlimit, ortlimit)) {
+        hitlistlocal_index.push_back(i);
+      }
+    }
+  }
 
-      GetPointOnLine(lineslopetest, locintercept, (const util::PxHit*)(&hitlist.at(i)), hitonline);
+  bool
+  GeometryUtilities::IsLocalHit(const util::PxHit& hit,
+                                const util::PxPoint& startHit,
+                                double const locintercept,
+                                double const lineslopetest,
+                                double const linearlimit,
+                                double const ortlimit) const
+  {
+    util::PxPoint hitonline;
 
-      // calculate linear distance from start point and orthogonal distance from
-      // axis
-      Double_t lindist =
-        Get2DDistance((const util::PxPoint*)(&hitonline), (const util::PxPoint*)(&startHit));
-      Double_t ortdist =
-        Get2DDistance((const util::PxPoint*)(&hitlist.at(i)), (const util::PxPoint*)(&hitonline));
+    GetPointOnLine(lineslopetest, locintercept, &hit, hitonline);
 
-      if (lindist < linearlimit && ortdist < ortlimit) { hitlistlocal_index.push_back(i); }
-    }
+    // calculate linear distance from start point and orthogonal distance from
+    // axis
+    Double_t lindist = Get2DDistance(&hitonline, &startHit);
+    Double_t ortdist = Get2DDistance(&hit, &hitonline);
+
+    return lindist < linearlimit && ortdist < ortlimit;
   }
 
   //////////////////////////////////////////////////////////////////
@@ -949,6 +1081,78 @@ namespace util {
       ordered_hits.push_back((*hiter).second);
     }
 
+    SelectPolygonHitList(plane, ordered_hits, hitlistlocal);
+  }
+
+  void
+  GeometryUtilities::SelectPolygonHitList(util::PxHitGridIndex const& hitindex,
+                                          std::vector<util::PxHit const*>& hitlistlocal) const
+  {
+    std::vector<util::PxHit> const& hitlist = hitindex.hits();
+    if (empty(hitlist)) { throw UtilException("Provided empty hit list!"); }
+
+    hitlistlocal.clear();
+    unsigned char plane = hitlist.front().plane;
+
+    // the hits are already sorted by charge in the index
+    double const qtotal = hitindex.totalCharge();
+    double qintegral = 0;
+    std::vector<const util::PxHit*> ordered_hits;
+    ordered_hits.reserve(hitindex.chargeRankedHits().size());
+    for (auto index : hitindex.chargeRankedHits()) {
+      if (!(qintegral < qtotal * 0.95)) break;
+      qintegral += hitlist[index].charge;
+      ordered_hits.push_back(&hitlist[index]);
+    }
+
+    SelectPolygonHitList(plane, ordered_hits, hitlistlocal);
+  }
+
+  void
+  GeometryUtilities::SelectPolygonHitList(util::PxHitColumns const& hits,
+                                          std::vector<unsigned int>& polygon) const
+  {
+    if (hits.empty()) { throw UtilException("Provided empty hit list!"); }
+
+    polygon.clear();
+    unsigned char plane = hits.plane.front();
+
+    // same selection as for a PxHit collection, keeping track of the indices
+    std::map<double, unsigned int> hitmap;
+    double qtotal = 0;
+    for (unsigned int i = 0; i < hits.size(); ++i) {
+      hitmap.try_emplace(hits.charge[i], i);
+      qtotal += hits.charge[i];
+    }
+    double qintegral = 0;
+    std::vector<unsigned int> ordered_index;
+    std::vector<util::PxHit> ordered_pxhits;
+    ordered_pxhits.reserve(hitmap.size());
+    for (auto hiter = hitmap.rbegin(); qintegral < qtotal * 0.95 && hiter != hitmap.rend();
+         ++hiter) {
+
+      qintegral += (*hiter).first;
+      ordered_index.push_back((*hiter).second);
+      ordered_pxhits.push_back(hits.hit((*hiter).second));
+    }
+    std::vector<const util::PxHit*> ordered_hits;
+    ordered_hits.reserve(ordered_pxhits.size());
+    for (auto const& h : ordered_pxhits)
+      ordered_hits.push_back(&h);
+
+    std::vector<const util::PxHit*> hitlistlocal;
+    SelectPolygonHitList(plane, ordered_hits, hitlistlocal);
+
+    polygon.reserve(hitlistlocal.size());
+    for (util::PxHit const* h : hitlistlocal)
+      polygon.push_back(ordered_index[h - ordered_pxhits.data()]);
+  }
+
+  void
+  GeometryUtilities::SelectPolygonHitList(unsigned char plane,
+                                          std::vector<util::PxHit const*> const& ordered_hits,
+                                          std::vector<util::PxHit const*>& hitlistlocal) const
+  {
     // Define container to hold found polygon corner PxHit index & distance
     std::vector<size_t> hit_index(8, 0);
     std::vector<double> hit_distance(8, 1e9);
@@ -1078,38 +1282,11 @@ namespace util {
   GeometryUtilities::PolyOverlap(std::vector<const util::PxHit*> ordered_hits,
                                  std::vector<size_t> candidate_polygon) const
   {
-    // loop over edges
-    for (unsigned int i = 0; i < (candidate_polygon.size() - 1); i++) {
-      double Ax = ordered_hits.at(candidate_polygon.at(i))->w;
-      double Ay = ordered_hits.at(candidate_polygon.at(i))->t;
-      double Bx = ordered_hits.at(candidate_polygon.at(i + 1))->w;
-      double By = ordered_hits.at(candidate_polygon.at(i + 1))->t;
-      // loop over edges that have not been checked yet...
-      // only ones furhter down in polygon
-      for (unsigned int j = i + 2; j < (candidate_polygon.size() - 1); j++) {
-        // avoid consecutive segments:
-        if (candidate_polygon.at(i) == candidate_polygon.at(j + 1))
-          continue;
-        else {
-          double Cx = ordered_hits.at(candidate_polygon.at(j))->w;
-          double Cy = ordered_hits.at(candidate_polygon.at(j))->t;
-          double Dx = ordered_hits.at(candidate_polygon.at(j + 1))->w;
-          double Dy = ordered_hits.at(candidate_polygon.at(j + 1))->t;
-
-          if ((Clockwise(Ax, Ay, Cx, Cy, Dx, Dy) != Clockwise(Bx, By, Cx, Cy, Dx, Dy)) and
-              (Clockwise(Ax, Ay, Bx, By, Cx, Cy) != Clockwise(Ax, Ay, Bx, By, Dx, Dy))) {
-            size_t tmp = candidate_polygon.at(i + 1);
-            candidate_polygon.at(i + 1) = candidate_polygon.at(j);
-            candidate_polygon.at(j) = tmp;
-            // check that last element is still first (to close circle...)
-            candidate_polygon.at(candidate_polygon.size() - 1) = candidate_polygon.at(0);
-            // swapped polygon...now do recursion to make sure
-            return PolyOverlap(ordered_hits, candidate_polygon);
-          } // if crossing
-        }
-      } // second loop
-    }   // first loop
-    return candidate_polygon;
+    // swaps the vertices of crossing edges until there is no crossing left
+    return PxPolygon::Untangle(std::move(candidate_polygon),
+                               [&ordered_hits](size_t index) -> util::PxPoint const& {
+                                 return *ordered_hits.at(index);
+                               });
   }
 
   bool
@@ -1151,4 +1328,23 @@ namespace util {
     return ret_ind;
   }
 
+  util::PxHit
+  GeometryUtilities::FindClosestHit(util::PxHitGridIndex const& hitindex,
+                                    unsigned int const wirein,
+                                    double const timein) const
+  {
+    return hitindex.hits()[FindClosestHitIndex(hitindex, wirein, timein)];
+  }
+
+  unsigned int
+  GeometryUtilities::FindClosestHitIndex(util::PxHitGridIndex const& hitindex,
+                                         unsigned int const wirein,
+                                         double const timein) const
+  {
+    // same metric and distance limit as the linear search
+    unsigned int const ret_ind =
+      hitindex.closestHitIndex(wirein, timein, fWiretoCm, fTimetoCm, 99999);
+    return (ret_ind < hitindex.size()) ? ret_ind : 0;
+  }
+
 } // namespace
@@ -30,6 +30,9 @@ namespace geo {
 /// General LArSoft Utilities
 namespace util {
 
+  class PxHitColumns;
+  class PxHitGridIndex;
+
   constexpr double kINVALID_DOUBLE = std::numeric_limits<Double_t>::max();
 
   class GeometryUtilities {
@@ -77,6 +80,24 @@ namespace util {
 
     double Get2DDistance(const util::PxPoint* point1, const util::PxPoint* point2) const;
 
+    // interfaces on hit columns (see PxHitColumns.h), with hits specified by
+    // their index; coordinates are in cm, as for PxPoint
+    double Get2Dangle(const util::PxHitColumns& hits, std::size_t iend, std::size_t istart) const;
+
+    double Get2Dslope(const util::PxHitColumns& hits, std::size_t iend, std::size_t istart) const;
+
+    double Get2DDistance(const util::PxHitColumns& hits, std::size_t i1, std::size_t i2) const;
+
+    // distance of each of the hits from point, in cm
+    void Get2DDistances(const util::PxHitColumns& hits,
+                        const util::PxPoint& point,
+                        std::vector<float>& distances) const;
+
+    // angle of the direction from startpoint to each of the hits
+    void Get2Dangles(const util::PxHitColumns& hits,
+                     const util::PxPoint& startpoint,
+                     std::vector<float>& angles) const;
+
     Double_t Get2DPitchDistance(Double_t angle, Double_t inwire, Double_t wire) const;
 
     Double_t Get2DPitchDistanceWSlope(Double_t slope, Double_t inwire, Double_t wire) const;
@@ -137,6 +158,16 @@ namespace util {
                                      unsigned int wirein,
                                      double timein) const;
 
+    // interfaces using a spatial index of the hits (see PxHitGridIndex.h);
+    // the results are the same as the ones of the versions taking a hit list
+    util::PxHit FindClosestHit(util::PxHitGridIndex const& hitindex,
+                               unsigned int wirein,
+                               double timein) const;
+
+    unsigned int FindClosestHitIndex(util::PxHitGridIndex const& hitindex,
+                                     unsigned int wirein,
+                                     double timein) const;
+
     Int_t GetYZ(const PxPoint* p0, const PxPoint* p1, Double_t* yz) const;
 
     Int_t GetXYZ(const PxPoint* p0, const PxPoint* p1, Double_t* xyz) const;
@@ -171,6 +202,37 @@ namespace util {
     void SelectPolygonHitList(const std::vector<util::PxHit>& hitlist,
                               std::vector<const util::PxHit*>& hitlistlocal) const;
 
+    // interfaces using a spatial index of the hits (see PxHitGridIndex.h);
+    // the results are the same as the ones of the versions taking a hit list
+    void SelectLocalHitlist(const util::PxHitGridIndex& hitindex,
+                            std::vector<const util::PxHit*>& hitlistlocal,
+                            util::PxPoint& startHit,
+                            Double_t& linearlimit,
+                            Double_t& ortlimit,
+                            Double_t& lineslopetest) const;
+
+    void SelectLocalHitlist(const util::PxHitGridIndex& hitindex,
+                            std::vector<const util::PxHit*>& hitlistlocal,
+                            util::PxPoint& startHit,
+                            Double_t& linearlimit,
+                            Double_t& ortlimit,
+                            Double_t& lineslopetest,
+                            util::PxHit& averageHit) const;
+
+    void SelectLocalHitlistIndex(const util::PxHitGridIndex& hitindex,
+                                 std::vector<unsigned int>& hitlistlocal_index,
+                                 util::PxPoint& startHit,
+                                 Double_t& linearlimit,
+                                 Double_t& ortlimit,
+                                 Double_t& lineslopetest) const;
+
+    void SelectPolygonHitList(const util::PxHitGridIndex& hitindex,
+                              std::vector<const util::PxHit*>& hitlistlocal) const;
+
+    // polygon of hit columns, as indices of the hits in the columns
+    void SelectPolygonHitList(const util::PxHitColumns& hits,
+                              std::vector<unsigned int>& polygon) const;
+
     std::vector<size_t> PolyOverlap(std::vector<const util::PxHit*> ordered_hits,
                                     std::vector<size_t> candidate_polygon) const;
 
@@ -198,6 +260,26 @@ namespace util {
     }
 
   private:
+    // whether the hit is within the limits of the line through startHit
+    bool IsLocalHit(const util::PxHit& hit,
+                    const util::PxPoint& startHit,
+                    double locintercept,
+                    double lineslopetest,
+                    double linearlimit,
+                    double ortlimit) const;
+
+    // fills the averages of the selected local hits
+    void FillLocalHitlist(const std::vector<util::PxHit>& hitlist,
+                          const std::vector<unsigned int>& hitlistlocal_index,
+                          std::vector<const util::PxHit*>& hitlistlocal,
+                          const util::PxPoint& startHit,
+                          util::PxHit& averageHit) const;
+
+    // polygon from the hits with most charge, ordered by decreasing charge
+    void SelectPolygonHitList(unsigned char plane,
+                              std::vector<const util::PxHit*> const& ordered_hits,
+                              std::vector<const util::PxHit*>& hitlistlocal) const;
+
     geo::GeometryCore const& fGeom;
     detinfo::DetectorClocksData const& fClocks;
     detinfo::DetectorPropertiesData const& fDetProp;
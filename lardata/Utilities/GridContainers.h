@@ -8,7 +8,11 @@
  *
  * * GridContainer2D: container on data in 2D space
  * * GridContainer3D: container of data in 3D space
+ * * CompactGridContainer2D, CompactGridContainer3D: the same, with all the
+ *   data in a single contiguous array (filled in two passes)
  * * GridContainerBase: base class for containers in a N-dimension space
+ * * CompactGridContainerBase: base class for contiguous containers in a
+ *   N-dimension space
  *
  * This is a pure header that contains only template classes.
  */
@@ -18,10 +22,15 @@
 
 // LArSoft libraries
 #include "lardata/Utilities/GridContainerIndices.h"
+#include "lardata/Utilities/ParallelCountingSort.h"
 
 // C/C++ standard libraries
 #include <vector>
 #include <array>
+#include <algorithm> // std::max(), std::min()
+#include <iterator> // std::distance()
+#include <utility> // std::move()
+#include <cstddef> // std::size_t
 
 
 namespace util {
@@ -153,6 +162,380 @@ namespace util {
 
     }; // GridContainerBase<>
 
+
+    /**
+     * @brief A range of data from a contiguous container
+     * @tparam Iter type of iterator to the data
+     *
+     * This is the cell type of the compact grid containers: it behaves like a
+     * constant `std::vector` of the data in the cell.
+     */
+    template <typename Iter>
+    class GridCellRange {
+        public:
+      using const_iterator = Iter; ///< type of iterator to the data
+      using value_type = typename std::iterator_traits<Iter>::value_type;
+
+      /// Constructor: range between the specified iterators
+      GridCellRange(Iter b, Iter e): b(b), e(e) {}
+
+      Iter begin() const { return b; }
+      Iter end() const { return e; }
+
+      /// Returns the number of data in the range
+      std::size_t size() const { return std::distance(b, e); }
+
+      /// Returns whether the range has no data
+      bool empty() const { return b == e; }
+
+      /// Returns the specified datum (no check!)
+      decltype(auto) operator[] (std::size_t index) const { return b[index]; }
+
+        private:
+      Iter b; ///< iterator to the first datum
+      Iter e; ///< iterator past the last datum
+
+    }; // GridCellRange<>
+
+
+    /**
+     * @brief Base class for a container of data arranged on a grid, stored in
+     *        a single contiguous array
+     * @tparam DATUM type of datum to be contained
+     * @tparam IXMAN type of the grid index manager
+     *
+     * This container offers the same indexing and reading interface as
+     * `GridContainerBase`, but all the data is stored in a single array,
+     * with the data of each cell contiguous and the cells in index order,
+     * and the cell boundaries in a separate array of offsets
+     * ("compressed sparse row" layout).
+     * Cells are returned as `Cell_t` ranges, which can be read like a
+     * constant `std::vector` but not modified.
+     *
+     * Since the size of each cell must be known before filling, the container
+     * is filled in two passes:
+     *
+     *     util::CompactGridContainer3D<int> grid({{{ NX, NY, NZ }}});
+     *     for (auto const& point: points) grid.count(cellOf(point));
+     *     grid.allocate();
+     *     for (auto const& point: points) grid.insert(cellOf(point), point.ID);
+     *
+     * The same can be done in one call with `assign()`. Insertion order is
+     * preserved within each cell. Inserting into a cell more elements than
+     * it was counted has undefined behaviour.
+     *
+     * Because cells along the last dimension are contiguous in index, and
+     * their data is contiguous in memory, scanning the data in a window of
+     * cells around a given one (`forEachInNeighbourhood()`) visits only one
+     * contiguous block of data for each row of the window.
+     */
+    template <typename DATUM, typename IXMAN>
+    class CompactGridContainerBase {
+
+        public:
+      using Datum_t = DATUM; ///< type of contained datum
+      using Indexer_t = IXMAN; /// type of index manager
+
+      using Grid_t = CompactGridContainerBase<Datum_t, Indexer_t>; ///< this type
+
+
+      static constexpr unsigned int dims() { return IXMAN::dims(); }
+
+      /// type of index for direct access to the cell
+      using CellIndex_t = typename Indexer_t::CellIndex_t;
+
+      /// type of difference between indices
+      using CellIndexOffset_t = typename Indexer_t::CellIndexOffset_t;
+
+      /// type of difference between indices
+      using CellDimIndex_t = typename Indexer_t::CellDimIndex_t;
+
+      /// type of cell coordinate (x, y, z)
+      using CellID_t = typename Indexer_t::CellID_t;
+
+      /// type of container holding all data
+      using Data_t = std::vector<Datum_t>;
+
+      /// type of a single cell (constant range of data)
+      using Cell_t = GridCellRange<typename Data_t::const_iterator>;
+
+      /// type of the offsets of the cells in the data
+      using Offsets_t = std::vector<std::size_t>;
+
+      /// Constructor: specifies the size of the container and allocates it
+      CompactGridContainerBase(std::array<size_t, dims()> const& dims)
+        : indices(dims)
+        , dimSizes(dims)
+        , offsets(indices.size() + 1, 0U)
+        , strides(computeStrides(indices))
+        {}
+
+      /// @{
+      /// @name Data structure
+
+      /// Returns the total size of the container
+      size_t size() const { return indices.size(); }
+
+      /// Returns whether the specified index is valid
+      bool has(CellIndexOffset_t index) const { return indices.has(index); }
+
+      /// Returns the total number of data in the container
+      size_t nData() const { return data.size(); }
+
+      /// @}
+
+      /// @{
+      /// @name Data access
+
+      /// Return the index of the element from its cell coordinates (no check!)
+      CellIndex_t index(CellID_t const& id) const { return indices[id]; }
+
+      /// Returns the difference in index from two cells
+      CellIndexOffset_t indexOffset
+        (CellID_t const& origin, CellID_t const& cellID) const
+        { return indices.offset(origin, cellID); }
+
+      /// Returns the specified cell
+      Cell_t operator[] (CellID_t const& id) const { return cell(index(id)); }
+
+      /// Returns the cell with specified index
+      Cell_t operator[] (CellIndex_t index) const { return cell(index); }
+
+      /// Returns all the data, sorted by cell index
+      Data_t const& allData() const { return data; }
+
+      /// Returns the position in `allData()` of the first datum of each cell
+      /// (plus the total number of data)
+      Offsets_t const& cellOffsets() const { return offsets; }
+
+      ///@}
+
+      /// @{
+      /// @name Data insertion
+
+      /// Removes all data and counts.
+      void clear()
+        {
+          data.clear();
+          fillPos.clear();
+          std::fill(offsets.begin(), offsets.end(), 0U);
+        }
+
+      /// First pass: adds one element to the size of the specified cell
+      void count(CellID_t const& cellID) { count(index(cellID)); }
+
+      /// First pass: adds one element to the size of the cell with given index
+      void count(CellIndex_t index) { ++offsets[index + 1]; }
+
+      /// First pass: adds `n` elements to the size of the cell with given index
+      void count(CellIndex_t index, std::size_t n) { offsets[index + 1] += n; }
+
+      /// Ends the first pass: allocates the memory for all the counted data
+      void allocate()
+        {
+          for (std::size_t i = 1; i < offsets.size(); ++i)
+            offsets[i] += offsets[i - 1];
+          data.resize(offsets.back());
+          fillPos.assign(offsets.begin(), std::prev(offsets.end()));
+        } // allocate()
+
+      /// Second pass: copies an element into the specified cell
+      void insert(CellID_t const& cellID, Datum_t const& elem)
+        { insert(index(cellID), elem); }
+
+      /// Second pass: moves an element into the specified cell
+      void insert(CellID_t const& cellID, Datum_t&& elem)
+        { insert(index(cellID), std::move(elem)); }
+
+      /// Second pass: copies an element into the cell with the specified index
+      void insert(CellIndex_t index, Datum_t const& elem)
+        { data[fillPos[index]++] = elem; }
+
+      /// Second pass: moves an element into the cell with the specified index
+      void insert(CellIndex_t index, Datum_t&& elem)
+        { data[fillPos[index]++] = std::move(elem); }
+
+      /**
+       * @brief Fills the container with the specified data
+       * @tparam Iter type of forward iterator to the input elements
+       * @tparam CellIndexOf type of functor returning the cell of an element
+       * @tparam DatumOf type of functor converting an element into a datum
+       * @param begin iterator to the first input element
+       * @param end iterator past the last input element
+       * @param cellIndexOf returns the index of the cell of an input element
+       * @param datumOf returns the datum to be stored for an input element
+       *
+       * Existing content is removed. The input is traversed twice.
+       */
+      template <typename Iter, typename CellIndexOf, typename DatumOf>
+      void assign
+        (Iter begin, Iter end, CellIndexOf cellIndexOf, DatumOf datumOf)
+        {
+          clear();
+          for (auto it = begin; it != end; ++it) count(cellIndexOf(*it));
+          allocate();
+          for (auto it = begin; it != end; ++it)
+            insert(CellIndex_t(cellIndexOf(*it)), datumOf(*it));
+        } // assign()
+
+      /**
+       * @brief Fills the container with the specified data, using threads
+       * @tparam Iter type of random access iterator to the input elements
+       * @tparam CellIndexOf type of functor returning the cell of an element
+       * @tparam DatumOf type of functor converting an element into a datum
+       * @param begin iterator to the first input element
+       * @param end iterator past the last input element
+       * @param cellIndexOf returns the index of the cell of an input element
+       * @param datumOf returns the datum to be stored for an input element
+       * @param nThreads number of threads to use
+       *
+       * The result is the same as the one of the serial `assign()`.
+       * The elements are sorted into the cells by `util::parallelCountingSort()`,
+       * which splits the input in up to `nThreads` contiguous chunks and
+       * preserves the order of the input in each cell.
+       * `cellIndexOf` and `datumOf` are called concurrently.
+       */
+      template <typename Iter, typename CellIndexOf, typename DatumOf>
+      void assign(
+        Iter begin, Iter end, CellIndexOf cellIndexOf, DatumOf datumOf,
+        unsigned int nThreads
+        );
+
+      /// @}
+
+      /// @{
+      /// @name Neighbourhood
+
+      /**
+       * @brief Calls `op` on each range of cells in a window around a cell
+       * @tparam Op type of operation: `void(Cell_t)`
+       * @param center the cell at the center of the window
+       * @param halfWidth number of cells on each side of the center
+       * @param op the operation to be called
+       *
+       * The window includes all the cells at most `halfWidth` cells away
+       * from `center` on each coordinate, and is clipped at the borders of
+       * the grid.
+       * Each call of `op` receives all the data of a row of consecutive cells
+       * along the last dimension, as a single `Cell_t` range.
+       */
+      template <typename Op>
+      void forEachRangeInNeighbourhood
+        (CellID_t const& center, CellDimIndex_t halfWidth, Op&& op) const
+        {
+          CellID_t lower, upper;
+          for (unsigned int d = 0; d < dims(); ++d) {
+            lower[d] = std::max<CellDimIndex_t>(center[d] - halfWidth, 0);
+            upper[d] = std::min<CellDimIndex_t>
+              (center[d] + halfWidth, CellDimIndex_t(dimSizes[d]) - 1);
+            if (lower[d] > upper[d]) return; // window outside the grid
+          } // for
+          constexpr unsigned int last = dims() - 1;
+          CellIndexOffset_t const rowLength = upper[last] - lower[last] + 1;
+
+          CellID_t rowStart = lower;
+          CellIndexOffset_t rowIndex = index(rowStart);
+          while (true) {
+            op(Cell_t(
+              data.begin() + offsets[rowIndex],
+              data.begin() + offsets[rowIndex + rowLength]
+              ));
+            // move to the next row: increment the leading coordinates
+            unsigned int d = last;
+            while (d-- > 0) {
+              if (rowStart[d] < upper[d]) {
+                ++rowStart[d];
+                rowIndex += strides[d];
+                break;
+              }
+              rowIndex -= (rowStart[d] - lower[d]) * strides[d];
+              rowStart[d] = lower[d];
+            } // while
+            if (d == (unsigned int) -1) break; // all leading coordinates wrapped
+          } // while
+        } // forEachRangeInNeighbourhood()
+
+      /**
+       * @brief Calls `op` on each datum in a window of cells around a cell
+       * @tparam Op type of operation: `void(Datum_t const&)`
+       * @param center the cell at the center of the window
+       * @param halfWidth number of cells on each side of the center
+       * @param op the operation to be called
+       * @see `forEachRangeInNeighbourhood()`
+       */
+      template <typename Op>
+      void forEachInNeighbourhood
+        (CellID_t const& center, CellDimIndex_t halfWidth, Op&& op) const
+        {
+          forEachRangeInNeighbourhood(center, halfWidth,
+            [&op](Cell_t const& range)
+              { for (Datum_t const& datum: range) op(datum); }
+            );
+        } // forEachInNeighbourhood()
+
+      /// @}
+
+      /// Returns the index manager of the grid
+      Indexer_t const& indexManager() const { return indices; }
+
+
+        protected:
+      Indexer_t indices; ///< manager of the indices of the container
+
+      std::array<size_t, dims()> dimSizes; ///< size of each dimension
+
+      Offsets_t offsets; ///< position in data of the first datum of each cell
+
+      std::array<CellIndexOffset_t, dims()> strides; ///< index step in each dim
+
+      Data_t data; ///< all data, sorted by cell
+
+      Offsets_t fillPos; ///< next free position in each cell while filling
+
+      /// Returns the cell with the specified index
+      Cell_t cell(CellIndex_t index) const
+        {
+          return
+            { data.begin() + offsets[index], data.begin() + offsets[index + 1] };
+        }
+
+      /// Returns the index offset of a step in each of the dimensions
+      static std::array<CellIndexOffset_t, dims()> computeStrides
+        (Indexer_t const& indices)
+        {
+          std::array<CellIndexOffset_t, dims()> strides;
+          CellID_t const origin {}; // all 0
+          for (unsigned int d = 0; d < dims(); ++d) {
+            CellID_t step = origin;
+            step[d] = 1;
+            strides[d] = indices.offset(origin, step);
+          } // for
+          return strides;
+        } // computeStrides()
+
+    }; // CompactGridContainerBase<>
+
+
+    //--------------------------------------------------------------------------
+    template <typename DATUM, typename IXMAN>
+    template <typename Iter, typename CellIndexOf, typename DatumOf>
+    void CompactGridContainerBase<DATUM, IXMAN>::assign(
+      Iter begin, Iter end, CellIndexOf cellIndexOf, DatumOf datumOf,
+      unsigned int nThreads
+    ) {
+      std::size_t const N = std::distance(begin, end);
+      fillPos.clear();
+      data.clear();
+      data.resize(N);
+      offsets = parallelCountingSort(
+        N, size(),
+        [&](std::size_t i){ return cellIndexOf(begin[i]); },
+        [&](std::size_t i, std::size_t slot){ data[slot] = datumOf(begin[i]); },
+        nThreads
+        );
+
+    } // CompactGridContainerBase<>::assign(nThreads)
+
   } // namespace details
 
 
@@ -160,18 +543,22 @@ namespace util {
    * @brief Base class for a container of data arranged on a 1D-grid
    * @tparam DATUM type of datum to be contained
    * @tparam IXMAN type of the grid index manager
+   * @tparam BASE implementation of the container
    *
    *
    */
-  template <typename DATUM, typename IXMAN>
-  class GridContainerBase1D: public details::GridContainerBase<DATUM, IXMAN> {
-    using Base_t = details::GridContainerBase<DATUM, IXMAN>;
+  template <
+    typename DATUM, typename IXMAN,
+    typename BASE = details::GridContainerBase<DATUM, IXMAN>
+    >
+  class GridContainerBase1D: public BASE {
+    using Base_t = BASE;
     static_assert(Base_t::dims() >= 1,
       "GridContainerBase1D must have dimensions 1 or larger.");
 
       public:
 
-    using Base_t::GridContainerBase;
+    using Base_t::Base_t;
 
     /// @{
     /// @name Data structure
@@ -193,12 +580,16 @@ namespace util {
    * @brief Base class for a container of data arranged on a 2D-grid
    * @tparam DATUM type of datum to be contained
    * @tparam IXMAN type of the grid index manager
+   * @tparam BASE implementation of the container
    *
    *
    */
-  template <typename DATUM, typename IXMAN>
-  class GridContainerBase2D: public GridContainerBase1D<DATUM, IXMAN> {
-    using Base_t = GridContainerBase1D<DATUM, IXMAN>;
+  template <
+    typename DATUM, typename IXMAN,
+    typename BASE = details::GridContainerBase<DATUM, IXMAN>
+    >
+  class GridContainerBase2D: public GridContainerBase1D<DATUM, IXMAN, BASE> {
+    using Base_t = GridContainerBase1D<DATUM, IXMAN, BASE>;
     static_assert(Base_t::dims() >= 2,
       "GridContainerBase2D must have dimensions 2 or larger.");
 
@@ -226,12 +617,16 @@ namespace util {
    * @brief Base class for a container of data arranged on a 3D-grid
    * @tparam DATUM type of datum to be contained
    * @tparam IXMAN type of the grid index manager
+   * @tparam BASE implementation of the container
    *
    *
    */
-  template <typename DATUM, typename IXMAN>
-  class GridContainerBase3D: public GridContainerBase2D<DATUM, IXMAN> {
-    using Base_t = GridContainerBase2D<DATUM, IXMAN>;
+  template <
+    typename DATUM, typename IXMAN,
+    typename BASE = details::GridContainerBase<DATUM, IXMAN>
+    >
+  class GridContainerBase3D: public GridContainerBase2D<DATUM, IXMAN, BASE> {
+    using Base_t = GridContainerBase2D<DATUM, IXMAN, BASE>;
     static_assert(Base_t::dims() >= 3,
       "GridContainerBase3D must have dimensions 3 or larger.");
 
@@ -278,6 +673,40 @@ namespace util {
   template <typename DATUM>
   using GridContainer3D = GridContainerBase3D<DATUM, GridContainer3DIndices>;
 
+
+  /**
+   * @brief Container allowing 2D indexing, with contiguous storage
+   * @tparam DATUM type of contained data
+   * @see GridContainer2D, details::CompactGridContainerBase
+   *
+   * This container has the same indexing interface as `GridContainer2D`,
+   * but it stores all its data in a single contiguous array and it must be
+   * filled in two passes. See the documentation of
+   * `details::CompactGridContainerBase`.
+   */
+  template <typename DATUM>
+  using CompactGridContainer2D = GridContainerBase2D<
+    DATUM, GridContainer2DIndices,
+    details::CompactGridContainerBase<DATUM, GridContainer2DIndices>
+    >;
+
+
+  /**
+   * @brief Container allowing 3D indexing, with contiguous storage
+   * @tparam DATUM type of contained data
+   * @see GridContainer3D, details::CompactGridContainerBase
+   *
+   * This container has the same indexing interface as `GridContainer3D`,
+   * but it stores all its data in a single contiguous array and it must be
+   * filled in two passes. See the documentation of
+   * `details::CompactGridContainerBase`.
+   */
+  template <typename DATUM>
+  using CompactGridContainer3D = GridContainerBase3D<
+    DATUM, GridContainer3DIndices,
+    details::CompactGridContainerBase<DATUM, GridContainer3DIndices>
+    >;
+
 } // namespace util
 
 
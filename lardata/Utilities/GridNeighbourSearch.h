@@ -0,0 +1,434 @@
+/**
+ * @file   GridNeighbourSearch.h
+ * @brief  Search of neighbouring points in 3D space, using a grid
+ * @date   October 19, 2026
+ * @see    GridContainers.h
+ *
+ * This header provides:
+ *
+ * * GridNeighbourSearch3D: finds all the pairs of points closer than a given
+ *   distance
+ *
+ * This library is header-only.
+ */
+
+#ifndef LARDATA_UTILITIES_GRIDNEIGHBOURSEARCH_H
+#define LARDATA_UTILITIES_GRIDNEIGHBOURSEARCH_H
+
+// LArSoft libraries
+#include "lardata/Utilities/GridContainers.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <array>
+#include <thread>
+#include <algorithm> // std::min(), std::max()
+#include <iterator> // std::distance()
+#include <stdexcept> // std::invalid_argument
+#include <string>
+#include <cmath> // std::floor()
+#include <cstddef> // std::size_t
+
+
+namespace util {
+
+  /**
+   * @brief Finds the points within a given distance from each other
+   *
+   * The points are binned into a `CompactGridContainer3D` with cells as large
+   * as the search radius, so that all the neighbours of a point within that
+   * radius are in the cell of the point or in one of the adjacent ones.
+   * Instead of comparing all the pairs of points, each point is compared
+   * only with the points in those 27 cells, which scales almost linearly with
+   * the number of points, as long as the density is not too high.
+   * The cells are made larger than the radius when needed to keep their
+   * number within `MaxCellsPerPoint` times the number of points, so that
+   * sparse points in a large volume do not need a huge grid.
+   *
+   * Both the binning and the query can be split across threads:
+   *
+   *     std::vector<util::GridNeighbourSearch3D::Position_t> positions;
+   *     // ... fill the positions
+   *     util::GridNeighbourSearch3D search(positions, 0.5, 8U);
+   *     auto const nNeighbours = search.countNeighbours(8U);
+   *
+   * The points are stored in the grid in cell order, together with their
+   * position, so that the query reads contiguous memory.
+   * The points are identified by their index in the input sequence.
+   */
+  class GridNeighbourSearch3D {
+      public:
+
+    using Position_t = std::array<double, 3U>; ///< Type of point position.
+
+    /// Type of the data stored for each point.
+    struct PointEntry_t {
+      std::size_t index; ///< Index of the point in the input.
+      Position_t pos; ///< Position of the point.
+    }; // PointEntry_t
+
+    /// Type of the grid holding the points.
+    using Grid_t = util::CompactGridContainer3D<PointEntry_t>;
+
+    using CellID_t = Grid_t::CellID_t; ///< Type of cell coordinates.
+
+    /// Maximum number of grid cells for each point.
+    static constexpr std::size_t MaxCellsPerPoint = 8U;
+
+    /**
+     * @brief Bins the specified points
+     * @tparam Iter type of forward iterator to the points
+     * @tparam PosOf type of functor returning the position of a point
+     * @param begin iterator to the first point
+     * @param end iterator past the last point
+     * @param radius maximum distance of two neighbouring points
+     * @param posOf returns the position of a point as a `Position_t`
+     * @param nThreads number of threads to use for the binning
+     * @throw std::invalid_argument if `radius` is not positive
+     */
+    template <typename Iter, typename PosOf>
+    GridNeighbourSearch3D(
+      Iter begin, Iter end, double radius, PosOf posOf,
+      unsigned int nThreads = 1U
+      );
+
+    /// Bins the specified positions.
+    GridNeighbourSearch3D(
+      std::vector<Position_t> const& positions, double radius,
+      unsigned int nThreads = 1U
+      )
+      : GridNeighbourSearch3D(
+        positions.begin(), positions.end(), radius,
+        [](Position_t const& pos){ return pos; }, nThreads
+        )
+      {}
+
+    /// Returns the search radius.
+    double radius() const { return fRadius; }
+
+    /// Returns the side of the grid cells (not smaller than the radius).
+    double cellSize() const { return fCellSize; }
+
+    /// Returns the number of points.
+    std::size_t nPoints() const { return fGrid.nData(); }
+
+    /// Returns the grid used for the search.
+    Grid_t const& grid() const { return fGrid; }
+
+    /**
+     * @brief Returns the cell containing the specified position
+     *
+     * Positions outside the grid are assigned a cell just outside of it.
+     */
+    CellID_t cellOf(Position_t const& pos) const;
+
+    /**
+     * @brief Calls `op` for each point within the radius from a position
+     * @tparam Op type of the operation: `void(std::size_t, double)`
+     * @param pos the position to search around
+     * @param op operation, called with the index of the point and the square
+     *           of its distance from `pos`
+     *
+     * The order of the calls is not specified.
+     */
+    template <typename Op>
+    void forEachNeighbourOf(Position_t const& pos, Op&& op) const;
+
+    /**
+     * @brief Calls `op` for each pair of points within the radius
+     * @tparam Op type of the operation: `void(std::size_t, std::size_t, double)`
+     * @param op operation, called with the index of a point, the one of its
+     *           neighbour and the square of their distance
+     * @param nThreads number of threads to use
+     *
+     * Each pair of neighbours is visited twice, once for each of the two
+     * points; a point is never reported as neighbour of itself.
+     * Points are processed in grid order, split in `nThreads` chunks; all the
+     * calls for a given first point come from the same thread, one after the
+     * other. `op` is called concurrently from different threads.
+     */
+    template <typename Op>
+    void forEachNeighbourPair(Op&& op, unsigned int nThreads = 1U) const;
+
+    /// Returns the number of neighbours of each point.
+    std::vector<std::size_t> countNeighbours(unsigned int nThreads = 1U) const;
+
+
+      private:
+    /// Bins the specified entries, which are already in the right format.
+    GridNeighbourSearch3D(
+      std::vector<PointEntry_t> const& entries, double radius,
+      unsigned int nThreads
+      )
+      : GridNeighbourSearch3D
+        (entries, boundingBox(entries), radius, nThreads)
+      {}
+
+    /// Bins the specified entries, within the specified bounding box.
+    GridNeighbourSearch3D(
+      std::vector<PointEntry_t> const& entries,
+      std::array<Position_t, 2U> const& box, double radius,
+      unsigned int nThreads
+      );
+
+    double fRadius; ///< Search radius.
+    double fRadius2; ///< Square of the search radius.
+    double fCellSize; ///< Side of the grid cells.
+    Position_t fOrigin; ///< Lower corner of the grid.
+    Grid_t fGrid; ///< Grid with the points.
+
+    /// Returns the square of the distance between two positions.
+    static double distance2(Position_t const& a, Position_t const& b)
+      {
+        double const dx = a[0] - b[0], dy = a[1] - b[1], dz = a[2] - b[2];
+        return dx*dx + dy*dy + dz*dz;
+      }
+
+    /// Visits the neighbours of the points in the specified range of `data`.
+    template <typename Op>
+    void visitRange(std::size_t first, std::size_t last, Op& op) const;
+
+    /// Returns the entries of the specified points.
+    template <typename Iter, typename PosOf>
+    static std::vector<PointEntry_t> makeEntries
+      (Iter begin, Iter end, PosOf& posOf);
+
+    /// Bounding box (lower and upper corners) of the points.
+    static std::array<Position_t, 2U> boundingBox
+      (std::vector<PointEntry_t> const& entries);
+
+    /// Returns the side of the cells for the bounding box and points.
+    static double cellSizeFor(
+      std::array<Position_t, 2U> const& box, double radius,
+      std::size_t nPoints
+      );
+
+    /// Returns the grid dimensions for the specified bounding box.
+    static std::array<std::size_t, 3U> gridDims
+      (std::array<Position_t, 2U> const& box, double cellSize);
+
+  }; // class GridNeighbourSearch3D
+
+
+} // namespace util
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//
+template <typename Iter, typename PosOf>
+util::GridNeighbourSearch3D::GridNeighbourSearch3D(
+  Iter begin, Iter end, double radius, PosOf posOf,
+  unsigned int nThreads /* = 1U */
+)
+  : GridNeighbourSearch3D(makeEntries(begin, end, posOf), radius, nThreads)
+  {}
+
+
+inline util::GridNeighbourSearch3D::GridNeighbourSearch3D(
+  std::vector<PointEntry_t> const& entries,
+  std::array<Position_t, 2U> const& box, double radius,
+  unsigned int nThreads
+)
+  : fRadius(radius)
+  , fRadius2(radius * radius)
+  , fCellSize(cellSizeFor(box, radius, entries.size()))
+  , fOrigin(box[0])
+  , fGrid(gridDims(box, fCellSize))
+{
+  if (!(radius > 0.0)) {
+    throw std::invalid_argument
+      ("GridNeighbourSearch3D: invalid radius " + std::to_string(radius));
+  }
+
+  fGrid.assign(
+    entries.begin(), entries.end(),
+    [this](PointEntry_t const& entry)
+      { return fGrid.index(cellOf(entry.pos)); },
+    [](PointEntry_t const& entry){ return entry; },
+    nThreads
+    );
+
+} // util::GridNeighbourSearch3D::GridNeighbourSearch3D()
+
+
+//------------------------------------------------------------------------------
+inline auto util::GridNeighbourSearch3D::cellOf(Position_t const& pos) const
+  -> CellID_t
+{
+  std::array<std::size_t, 3U> const dims
+    {{ fGrid.sizeX(), fGrid.sizeY(), fGrid.sizeZ() }};
+  CellID_t cellID;
+  for (unsigned int d = 0; d < 3U; ++d) {
+    double const cell = std::floor((pos[d] - fOrigin[d]) / fCellSize);
+    cellID[d] = (cell < 0.0)
+      ? -1: static_cast<Grid_t::CellDimIndex_t>(std::min(cell, double(dims[d])));
+  }
+  return cellID;
+} // util::GridNeighbourSearch3D::cellOf()
+
+
+//------------------------------------------------------------------------------
+template <typename Op>
+void util::GridNeighbourSearch3D::forEachNeighbourOf
+  (Position_t const& pos, Op&& op) const
+{
+  fGrid.forEachInNeighbourhood(cellOf(pos), 1,
+    [this, &pos, &op](PointEntry_t const& entry)
+      {
+        double const d2 = distance2(pos, entry.pos);
+        if (d2 <= fRadius2) op(entry.index, d2);
+      }
+    );
+} // util::GridNeighbourSearch3D::forEachNeighbourOf()
+
+
+//------------------------------------------------------------------------------
+template <typename Op>
+void util::GridNeighbourSearch3D::forEachNeighbourPair
+  (Op&& op, unsigned int nThreads /* = 1U */) const
+{
+  std::size_t const N = nPoints();
+  std::size_t const nChunks = std::max(1U, std::min<unsigned int>(
+    nThreads, static_cast<unsigned int>(N / 1024U)
+    ));
+  if (nChunks == 1U) {
+    visitRange(0U, N, op);
+    return;
+  }
+
+  std::size_t const chunkSize = (N + nChunks - 1) / nChunks;
+  std::vector<std::thread> workers;
+  workers.reserve(nChunks);
+  for (std::size_t iChunk = 0; iChunk < nChunks; ++iChunk) {
+    std::size_t const first = iChunk * chunkSize;
+    std::size_t const last = std::min(N, first + chunkSize);
+    workers.emplace_back
+      ([this, first, last, &op](){ visitRange(first, last, op); });
+  } // for
+  for (auto& worker: workers) worker.join();
+
+} // util::GridNeighbourSearch3D::forEachNeighbourPair()
+
+
+//------------------------------------------------------------------------------
+inline std::vector<std::size_t> util::GridNeighbourSearch3D::countNeighbours
+  (unsigned int nThreads /* = 1U */) const
+{
+  // each point is handled by a single thread: no race on its counter
+  std::vector<std::size_t> counts(nPoints(), 0U);
+  forEachNeighbourPair(
+    [&counts](std::size_t i, std::size_t, double){ ++counts[i]; },
+    nThreads
+    );
+  return counts;
+} // util::GridNeighbourSearch3D::countNeighbours()
+
+
+//------------------------------------------------------------------------------
+template <typename Op>
+void util::GridNeighbourSearch3D::visitRange
+  (std::size_t first, std::size_t last, Op& op) const
+{
+  auto const& data = fGrid.allData();
+  auto const& offsets = fGrid.cellOffsets();
+
+  // find the cell of the first point, then follow the cells in order
+  std::size_t cellIndex = std::distance(offsets.begin(),
+    std::upper_bound(offsets.begin(), offsets.end(), first)) - 1;
+
+  // the indices of the cells are turned back into cell coordinates,
+  // by subtracting the index offsets of the dimensions
+  std::size_t const strideY = fGrid.indexOffset({{ 0, 0, 0 }}, {{ 0, 1, 0 }});
+  std::size_t const strideX = fGrid.indexOffset({{ 0, 0, 0 }}, {{ 1, 0, 0 }});
+
+  for (std::size_t i = first; i < last; ++i) {
+    while (offsets[cellIndex + 1] <= i) ++cellIndex;
+    PointEntry_t const& entry = data[i];
+    CellID_t const cellID {{
+      Grid_t::CellDimIndex_t(cellIndex / strideX),
+      Grid_t::CellDimIndex_t((cellIndex % strideX) / strideY),
+      Grid_t::CellDimIndex_t(cellIndex % strideY)
+      }};
+    fGrid.forEachInNeighbourhood(cellID, 1,
+      [this, &entry, &op](PointEntry_t const& other)
+        {
+          if (other.index == entry.index) return;
+          double const d2 = distance2(entry.pos, other.pos);
+          if (d2 <= fRadius2) op(entry.index, other.index, d2);
+        }
+      );
+  } // for
+
+} // util::GridNeighbourSearch3D::visitRange()
+
+
+//------------------------------------------------------------------------------
+template <typename Iter, typename PosOf>
+auto util::GridNeighbourSearch3D::makeEntries
+  (Iter begin, Iter end, PosOf& posOf) -> std::vector<PointEntry_t>
+{
+  std::vector<PointEntry_t> entries;
+  entries.reserve(std::distance(begin, end));
+  std::size_t index = 0U;
+  for (Iter it = begin; it != end; ++it)
+    entries.push_back({ index++, Position_t(posOf(*it)) });
+  return entries;
+} // util::GridNeighbourSearch3D::makeEntries()
+
+
+//------------------------------------------------------------------------------
+inline auto util::GridNeighbourSearch3D::boundingBox
+  (std::vector<PointEntry_t> const& entries) -> std::array<Position_t, 2U>
+{
+  if (entries.empty()) return {{ {{ 0., 0., 0. }}, {{ 0., 0., 0. }} }};
+  std::array<Position_t, 2U> box {{ entries.front().pos, entries.front().pos }};
+  for (PointEntry_t const& entry: entries) {
+    for (unsigned int d = 0; d < 3U; ++d) {
+      box[0][d] = std::min(box[0][d], entry.pos[d]);
+      box[1][d] = std::max(box[1][d], entry.pos[d]);
+    } // for
+  } // for
+  return box;
+} // util::GridNeighbourSearch3D::boundingBox()
+
+
+//------------------------------------------------------------------------------
+inline double util::GridNeighbourSearch3D::cellSizeFor(
+  std::array<Position_t, 2U> const& box, double radius, std::size_t nPoints
+) {
+  if (!(radius > 0.0)) return radius; // the constructor will complain
+
+  // cells must not be smaller than the radius; they are doubled in size
+  // until their number is linear with the number of points
+  double const maxCells
+    = double(MaxCellsPerPoint) * double(std::max<std::size_t>(nPoints, 1U));
+  double cellSize = radius;
+  while (true) {
+    double nCells = 1.0;
+    for (unsigned int d = 0; d < 3U; ++d)
+      nCells *= std::floor((box[1][d] - box[0][d]) / cellSize) + 1.0;
+    if (nCells <= maxCells) break;
+    cellSize *= 2.0;
+  } // while
+  return cellSize;
+} // util::GridNeighbourSearch3D::cellSizeFor()
+
+
+//------------------------------------------------------------------------------
+inline std::array<std::size_t, 3U> util::GridNeighbourSearch3D::gridDims
+  (std::array<Position_t, 2U> const& box, double cellSize)
+{
+  std::array<std::size_t, 3U> dims;
+  for (unsigned int d = 0; d < 3U; ++d) {
+    dims[d] = (cellSize > 0.0)
+      ? std::size_t(std::floor((box[1][d] - box[0][d]) / cellSize)) + 1U: 1U;
+  }
+  return dims;
+} // util::GridNeighbourSearch3D::gridDims()
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // LARDATA_UTILITIES_GRIDNEIGHBOURSEARCH_H
@@ -0,0 +1,126 @@
+/**
+ * @file   ParallelCountingSort.h
+ * @brief  Stable counting sort of elements by an integral key, using threads
+ * @date   October 19, 2026
+ * @see    GridContainers.h, AssnsIndex.h
+ *
+ * This header provides:
+ *
+ * * parallelCountingSort(): groups elements by key, preserving their order
+ *   within each group
+ *
+ * This library is header-only.
+ */
+
+#ifndef LARDATA_UTILITIES_PARALLELCOUNTINGSORT_H
+#define LARDATA_UTILITIES_PARALLELCOUNTINGSORT_H
+
+// C/C++ standard libraries
+#include <vector>
+#include <thread>
+#include <algorithm> // std::min(), std::max()
+#include <cstddef> // std::size_t
+
+
+namespace util {
+
+  /**
+   * @brief Sorts elements by key with a stable counting sort, using threads
+   * @tparam KeyOf type of functor returning the key of an element
+   * @tparam Place type of functor placing an element into a slot
+   * @param n number of elements
+   * @param nKeys number of keys; all keys are in [ 0, `nKeys` [
+   * @param keyOf `keyOf(i)` returns the key of the element `i`
+   * @param place `place(i, slot)` stores the element `i` into `slot`
+   * @param nThreads number of threads to use
+   * @return the first slot of each key, plus the total number of elements
+   *
+   * Elements are identified by their index in [ 0, `n` [, and they are
+   * assigned the slots [ 0, `n` [ grouped by key, in increasing key order.
+   * Within each key, the slots follow the order of the elements.
+   *
+   * The elements are split in up to `nThreads` contiguous chunks. Each thread
+   * counts the elements of its chunk in its own histogram of the keys, then a
+   * prefix sum assigns to each chunk its own slots in each key, after the ones
+   * of the previous chunks, so that each thread can place its elements
+   * independently. Since each thread needs a full histogram of the keys, the
+   * elements are not split in chunks smaller than the number of keys.
+   * With a single chunk, no thread is started.
+   * `keyOf` is called twice per element and `place` once, concurrently.
+   */
+  template <typename KeyOf, typename Place>
+  std::vector<std::size_t> parallelCountingSort(
+    std::size_t n, std::size_t nKeys, KeyOf keyOf, Place place,
+    unsigned int nThreads = 1U
+    );
+
+} // namespace util
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//
+template <typename KeyOf, typename Place>
+std::vector<std::size_t> util::parallelCountingSort(
+  std::size_t n, std::size_t nKeys, KeyOf keyOf, Place place,
+  unsigned int nThreads /* = 1U */
+) {
+
+  // each thread needs a histogram of all keys: do not split too finely
+  std::size_t const nChunks = std::max<std::size_t>(1U,
+    std::min<std::size_t>(nThreads, n / std::max<std::size_t>(nKeys, 1024U))
+    );
+  std::size_t const chunkSize = (n + nChunks - 1) / nChunks;
+
+  auto const runOnChunks = [nChunks](auto&& work)
+    {
+      if (nChunks == 1U) { work(0U); return; }
+      std::vector<std::thread> workers;
+      workers.reserve(nChunks);
+      for (std::size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+        workers.emplace_back(work, iChunk);
+      for (auto& worker: workers) worker.join();
+    };
+
+  // 1. per-chunk histograms of the keys
+  std::vector<std::vector<std::size_t>> counts
+    (nChunks, std::vector<std::size_t>(nKeys, 0U));
+  runOnChunks([&](std::size_t iChunk)
+    {
+      auto& count = counts[iChunk];
+      std::size_t const end = std::min(n, (iChunk + 1) * chunkSize);
+      for (std::size_t i = iChunk * chunkSize; i < end; ++i)
+        ++count[keyOf(i)];
+    });
+
+  // 2. prefix sum, key-major and chunk-minor: each chunk gets its own slots
+  //    within each key, after the ones of the previous chunks
+  std::vector<std::size_t> offsets(nKeys + 1U);
+  std::size_t total = 0U;
+  for (std::size_t key = 0; key < nKeys; ++key) {
+    offsets[key] = total;
+    for (auto& count: counts) {
+      std::size_t const nInKey = count[key];
+      count[key] = total; // now it's the next free slot
+      total += nInKey;
+    } // for chunks
+  } // for keys
+  offsets[nKeys] = total;
+
+  // 3. each chunk places its elements (stable)
+  runOnChunks([&](std::size_t iChunk)
+    {
+      auto& next = counts[iChunk];
+      std::size_t const end = std::min(n, (iChunk + 1) * chunkSize);
+      for (std::size_t i = iChunk * chunkSize; i < end; ++i)
+        place(i, next[keyOf(i)]++);
+    });
+
+  return offsets;
+} // util::parallelCountingSort()
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // LARDATA_UTILITIES_PARALLELCOUNTINGSORT_H
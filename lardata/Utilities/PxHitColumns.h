@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////
+// \file PxHitColumns.h
+//
+// \brief Structure-of-arrays collection of PxHit
+//
+// \date October 19, 2026
+//
+////////////////////////////////////////////////////////////////////////
+
+#ifndef UTIL_PXHITCOLUMNS_H
+#define UTIL_PXHITCOLUMNS_H
+
+#include "lardata/Utilities/PxUtils.h"
+
+#include <cstddef>
+#include <vector>
+
+/// General LArSoft Utilities
+namespace util {
+
+  /**
+   * @brief Collection of hits in the (wire, time) plane, one column per field.
+   *
+   * This is the same information as a `std::vector<PxHit>`, stored as one
+   * array per data member: the algorithms which only need the coordinates
+   * (most of the ones in `GeometryUtilities`) read only the `w` and `t`
+   * columns, and loops over them can be vectorized by the compiler.
+   *
+   * The columns are single precision, which is the precision `recob::Hit`
+   * stores its information with. Coordinates are in centimeters, as in
+   * `PxHit`.
+   *
+   * All the columns are expected to have the same size; the member functions
+   * keep them in sync, while direct changes to the columns are in charge of
+   * the caller.
+   */
+  class PxHitColumns {
+  public:
+    std::vector<float> w;            ///< Wire coordinate [cm].
+    std::vector<float> t;            ///< Time coordinate [cm].
+    std::vector<float> charge;       ///< Area charge.
+    std::vector<float> sumADC;       ///< Sum of ADCs.
+    std::vector<float> peak;         ///< Peak amplitude.
+    std::vector<unsigned int> plane; ///< Plane number.
+
+    PxHitColumns() = default;
+
+    /// Creates the columns from a collection of `PxHit`.
+    explicit PxHitColumns(std::vector<PxHit> const& hits)
+    {
+      reserve(hits.size());
+      for (PxHit const& hit : hits)
+        push_back(hit);
+    }
+
+    /// Returns the number of hits.
+    std::size_t
+    size() const
+    {
+      return w.size();
+    }
+
+    /// Returns whether there is no hit.
+    bool
+    empty() const
+    {
+      return w.empty();
+    }
+
+    /// Prepares room for `n` hits in all the columns.
+    void
+    reserve(std::size_t n)
+    {
+      w.reserve(n);
+      t.reserve(n);
+      charge.reserve(n);
+      sumADC.reserve(n);
+      peak.reserve(n);
+      plane.reserve(n);
+    }
+
+    /// Resizes all the columns to `n` hits.
+    void
+    resize(std::size_t n)
+    {
+      w.resize(n);
+      t.resize(n);
+      charge.resize(n);
+      sumADC.resize(n);
+      peak.resize(n);
+      plane.resize(n);
+    }
+
+    /// Removes all the hits.
+    void
+    clear()
+    {
+      w.clear();
+      t.clear();
+      charge.clear();
+      sumADC.clear();
+      peak.clear();
+      plane.clear();
+    }
+
+    /// Adds a hit at the end of the collection.
+    void
+    push_back(PxHit const& hit)
+    {
+      w.push_back(hit.w);
+      t.push_back(hit.t);
+      charge.push_back(hit.charge);
+      sumADC.push_back(hit.sumADC);
+      peak.push_back(hit.peak);
+      plane.push_back(hit.plane);
+    }
+
+    /// Returns a copy of the hit `i` (no range check).
+    PxHit
+    hit(std::size_t i) const
+    {
+      return {plane[i], w[i], t[i], charge[i], sumADC[i], peak[i]};
+    }
+
+    /// Returns the position of the hit `i` (no range check).
+    PxPoint
+    point(std::size_t i) const
+    {
+      return {plane[i], w[i], t[i]};
+    }
+
+    /// Returns a copy of all the hits as `PxHit` objects.
+    std::vector<PxHit>
+    toPxHits() const
+    {
+      std::vector<PxHit> hits;
+      hits.reserve(size());
+      for (std::size_t i = 0; i < size(); ++i)
+        hits.push_back(hit(i));
+      return hits;
+    }
+
+  }; // class PxHitColumns
+
+} // namespace util
+
+#endif // UTIL_PXHITCOLUMNS_H
@@ -75,4 +75,27 @@ namespace util {
     }
   }
 
+  void
+  PxHitConverter::GeneratePxHitColumns(std::vector<recob::Hit> const& hits,
+                                       PxHitColumns& pxhits) const
+  {
+    if (empty(hits)) throw UtilException(Form("Hit list empty! (%s)", __FUNCTION__));
+
+    pxhits = ToPxHitColumns(hits);
+  }
+
+  void
+  PxHitConverter::ScaleToCm(PxHitColumns& pxhits) const
+  {
+    float const wireToCm = fGeomUtils.WireToCm();
+    float const timeToCm = fGeomUtils.TimeToCm();
+    float* const w = pxhits.w.data();
+    float* const t = pxhits.t.data();
+    std::size_t const n = pxhits.size();
+    for (std::size_t i = 0; i < n; ++i)
+      w[i] *= wireToCm;
+    for (std::size_t i = 0; i < n; ++i)
+      t[i] *= timeToCm;
+  }
+
 } // end namespace util
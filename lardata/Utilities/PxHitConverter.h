@@ -11,6 +11,7 @@
 #define UTIL_PXHITCONVERTER_H
 
 #include "PxUtils.h"
+#include "lardata/Utilities/PxHitColumns.h"
 #include "lardata/Utilities/Dereference.h"
 #include "lardataobj/RecoBase/Hit.h"
 
@@ -51,8 +52,27 @@ namespace util {
     template <typename Cont, typename Hit = typename Cont::value_type>
     std::vector<PxHit> ToPxHitVector(Cont const& hits) const;
 
+    /// Generate: from 1 set of hits => 1 set of PxHit columns using all hits
+    /// (like `GeneratePxHit()`, throws `UtilException` if there are no hits)
+    void GeneratePxHitColumns(std::vector<recob::Hit> const& hits, PxHitColumns& pxhits) const;
+
+    /**
+     * @brief Returns the PxHit columns out of a collection of hits.
+     * @tparam Cont type of collection of hits or of pointers to hits
+     *
+     * The hit information is copied column by column, and the conversion of
+     * wire and time to centimeters is then applied to whole columns at once.
+     * Since the columns are in single precision, the coordinates may differ
+     * from the ones from `ToPxHitVector()` by the rounding to `float`.
+     */
+    template <typename Cont, typename Hit = typename Cont::value_type>
+    PxHitColumns ToPxHitColumns(Cont const& hits) const;
+
   private:
     GeometryUtilities const& fGeomUtils;
+
+    /// Converts the wire and time columns from wire and tick units into cm.
+    void ScaleToCm(PxHitColumns& pxhits) const;
   }; // class PxHitConverter
 
 } //namespace util
@@ -84,4 +104,29 @@ util::PxHitConverter::ToPxHitVector(Cont const& hits) const
   return pxhits;
 } // util::PxHitConverter::ToPxHitVector()
 
+template <typename Cont, typename Hit /* = typename Cont::value_type */>
+util::PxHitColumns
+util::PxHitConverter::ToPxHitColumns(Cont const& hits) const
+{
+  static_assert(
+    std::is_convertible<typename lar::util::dereferenced_type<Hit>::type, recob::Hit>::value,
+    "The argument to PxHitConverter::ToPxHitColumns() does not contain recob::Hit");
+
+  PxHitColumns pxhits;
+  pxhits.resize(hits.size());
+  std::size_t i = 0;
+  for (Hit const& hitObj : hits) {
+    recob::Hit const& hit = lar::util::dereference(hitObj);
+    pxhits.w[i] = hit.WireID().Wire;
+    pxhits.t[i] = hit.PeakTime();
+    pxhits.charge[i] = hit.Integral();
+    pxhits.sumADC[i] = hit.SummedADC();
+    pxhits.peak[i] = hit.PeakAmplitude();
+    pxhits.plane[i] = hit.WireID().Plane;
+    ++i;
+  }
+  ScaleToCm(pxhits);
+  return pxhits;
+} // util::PxHitConverter::ToPxHitColumns()
+
 #endif // UTIL_PXHITCONVERTER_H
@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////
+// \file PxHitGridIndex.cxx
+//
+// \brief Spatial index of PxHit on a (wire, time) grid
+//
+// \date October 19, 2026
+//
+////////////////////////////////////////////////////////////////////////
+
+#include "lardata/Utilities/PxHitGridIndex.h"
+#include "lardata/Utilities/UtilException.h"
+
+#include "TString.h"
+
+#include <array>
+#include <map>
+
+namespace {
+
+  /// Returns the range of the coordinate `coord` of the hits.
+  std::pair<double, double>
+  hitRange(std::vector<util::PxHit> const& hits, double util::PxPoint::*coord)
+  {
+    if (hits.empty()) return {0.0, 0.0};
+    auto const [minHit, maxHit] = std::minmax_element(
+      hits.begin(), hits.end(), [coord](util::PxHit const& a, util::PxHit const& b) {
+        return a.*coord < b.*coord;
+      });
+    return {(*minHit).*coord, (*maxHit).*coord};
+  }
+
+  /// Returns `cellSize`, throwing if it is not a valid cell size.
+  double
+  checkedCellSize(double cellSize)
+  {
+    if (!(cellSize > 0.0) || !std::isfinite(cellSize)) {
+      throw util::UtilException(Form("PxHitGridIndex: invalid cell size %g", cellSize));
+    }
+    return cellSize;
+  }
+
+  /// Returns the number of cells of side `cellSize` covering a range.
+  std::size_t
+  nCells(std::pair<double, double> const& range, double cellSize)
+  {
+    return static_cast<std::size_t>(std::floor((range.second - range.first) / cellSize)) + 1;
+  }
+
+  /// Returns `cellSize`, doubled until there are at most `MaxCellsPerHit` cells per hit.
+  double
+  cappedCellSize(std::vector<util::PxHit> const& hits, double cellSize)
+  {
+    auto const wRange = hitRange(hits, &util::PxPoint::w);
+    auto const tRange = hitRange(hits, &util::PxPoint::t);
+    double const maxCells = double(util::PxHitGridIndex::MaxCellsPerHit) *
+                            double(std::max<std::size_t>(hits.size(), 1U));
+    while (true) {
+      // counted in floating point, since the cell numbers may overflow
+      double const nCellsW = std::floor((wRange.second - wRange.first) / cellSize) + 1.0;
+      double const nCellsT = std::floor((tRange.second - tRange.first) / cellSize) + 1.0;
+      if (nCellsW * nCellsT <= maxCells) break;
+      cellSize *= 2.0;
+    } // while
+    return cellSize;
+  }
+
+} // local namespace
+
+namespace util {
+
+  PxHitGridIndex::PxHitGridIndex(std::vector<PxHit> const& hits)
+    : PxHitGridIndex(hits, autoCellSize(hits))
+  {}
+
+  PxHitGridIndex::PxHitGridIndex(std::vector<PxHit> const& hits, double cellSize)
+    : fHits(&hits)
+    , fCellSize(cappedCellSize(hits, checkedCellSize(cellSize)))
+    , fMinW(hitRange(hits, &PxPoint::w).first)
+    , fMinT(hitRange(hits, &PxPoint::t).first)
+    , fGrid(std::array<std::size_t, 2U>{{nCells(hitRange(hits, &PxPoint::w), fCellSize),
+                                          nCells(hitRange(hits, &PxPoint::t), fCellSize)}})
+  {
+    fill();
+  }
+
+  std::vector<PxHitGridIndex::HitIndex_t>
+  PxHitGridIndex::hitsInBox(double wmin, double wmax, double tmin, double tmax) const
+  {
+    std::vector<HitIndex_t> indices;
+    forEachInBox(wmin, wmax, tmin, tmax, [&indices](HitIndex_t i) { indices.push_back(i); });
+    std::sort(indices.begin(), indices.end());
+    return indices;
+  }
+
+  PxHitGridIndex::HitIndex_t
+  PxHitGridIndex::closestHitIndex(double const w,
+                                  double const t,
+                                  double const wScale,
+                                  double const tScale,
+                                  double const maxDistance) const
+  {
+    HitIndex_t best = size();
+    double bestDistance = maxDistance;
+    if (fHits->empty()) return best;
+
+    auto checkHit = [&](HitIndex_t i) {
+      PxHit const& hit = (*fHits)[i];
+      double const dist = std::hypot((w - hit.w) * wScale, (t - hit.t) * tScale);
+      if ((dist < bestDistance) || ((dist == bestDistance) && (i < best))) {
+        bestDistance = dist;
+        best = i;
+      }
+    };
+
+    if (!std::isfinite(w) || !std::isfinite(t)) { // no geometry to exploit
+      for (HitIndex_t i = 0; i < size(); ++i)
+        checkHit(i);
+      return best;
+    }
+
+    // search in square rings of cells of increasing size around the point,
+    // starting from the first one reaching the grid
+    long const nW = nCellsW(), nT = nCellsT();
+    long const cw = cellCoord(w, fMinW), ct = cellCoord(t, fMinT);
+    long const r0 = std::max({0L, -cw, cw - (nW - 1), -ct, ct - (nT - 1)});
+    for (long r = r0;; ++r) {
+      long const wlow = cw - r, whigh = cw + r, tlow = ct - r, thigh = ct + r;
+
+      // visit the cells on the border of the square which are in the grid
+      long const cwmin = std::max(wlow, 0L), cwmax = std::min(whigh, nW - 1);
+      long const ctmin = std::max(tlow, 0L), ctmax = std::min(thigh, nT - 1);
+      if (cwmin <= cwmax && ctmin <= ctmax) {
+        if (r == r0)
+          forEachInCells(cwmin, cwmax, ctmin, ctmax, checkHit);
+        else {
+          if (tlow >= 0) forEachInCells(cwmin, cwmax, tlow, tlow, checkHit);
+          if (thigh < nT) forEachInCells(cwmin, cwmax, thigh, thigh, checkHit);
+          long const ctinmin = std::max(tlow + 1, 0L), ctinmax = std::min(thigh - 1, nT - 1);
+          if (ctinmin <= ctinmax) {
+            if (wlow >= 0) forEachInCells(wlow, wlow, ctinmin, ctinmax, checkHit);
+            if (whigh < nW) forEachInCells(whigh, whigh, ctinmin, ctinmax, checkHit);
+          }
+        }
+      }
+
+      // stop when the square covers the whole grid...
+      if (wlow <= 0 && tlow <= 0 && whigh >= nW - 1 && thigh >= nT - 1) break;
+
+      // ... or when all the hits out of the square are farther than the best
+      // (with some margin for the rounding of the cell boundaries)
+      double const gapW = std::min(w - (fMinW + wlow * fCellSize),
+                                   (fMinW + (whigh + 1) * fCellSize) - w);
+      double const gapT = std::min(t - (fMinT + tlow * fCellSize),
+                                   (fMinT + (thigh + 1) * fCellSize) - t);
+      double const minOutside = std::min(gapW * std::abs(wScale), gapT * std::abs(tScale));
+      if (minOutside - bestDistance > 1e-9 * bestDistance) break;
+    }
+    return best;
+  }
+
+  void
+  PxHitGridIndex::fill()
+  {
+    std::vector<PxHit> const& hits = *fHits;
+    long const nW = nCellsW(), nT = nCellsT();
+    auto cellIndexOf = [this, nW, nT](PxHit const& hit) {
+      return fGrid.index(Grid_t::CellID_t{{clampCoord(cellCoord(hit.w, fMinW), nW),
+                                           clampCoord(cellCoord(hit.t, fMinT), nT)}});
+    };
+    for (auto const& hit : hits)
+      fGrid.count(cellIndexOf(hit));
+    fGrid.allocate();
+    for (HitIndex_t i = 0; i < hits.size(); ++i)
+      fGrid.insert(cellIndexOf(hits[i]), i);
+
+    // charge ranking, as done by GeometryUtilities::SelectPolygonHitList()
+    std::map<double, HitIndex_t> hitmap;
+    fTotalCharge = 0.0;
+    for (HitIndex_t i = 0; i < hits.size(); ++i) {
+      hitmap.try_emplace(hits[i].charge, i);
+      fTotalCharge += hits[i].charge;
+    }
+    fByCharge.clear();
+    fByCharge.reserve(hitmap.size());
+    for (auto hiter = hitmap.rbegin(); hiter != hitmap.rend(); ++hiter)
+      fByCharge.push_back(hiter->second);
+  }
+
+  double
+  PxHitGridIndex::autoCellSize(std::vector<PxHit> const& hits)
+  {
+    if (hits.empty()) return 1.0;
+    auto const wRange = hitRange(hits, &PxPoint::w);
+    auto const tRange = hitRange(hits, &PxPoint::t);
+    double const extentW = wRange.second - wRange.first;
+    double const extentT = tRange.second - tRange.first;
+    double const hitsPerCell = std::min(DefaultHitsPerCell, double(hits.size()));
+    double const area = extentW * extentT;
+    if (area > 0.0) return std::sqrt(area * hitsPerCell / hits.size());
+    // all hits on a line (or on a point)
+    double const extent = std::max(extentW, extentT);
+    return (extent > 0.0) ? extent * hitsPerCell / hits.size() : 1.0;
+  }
+
+} // namespace util
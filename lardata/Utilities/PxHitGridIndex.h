@@ -0,0 +1,240 @@
+////////////////////////////////////////////////////////////////////////
+// \file PxHitGridIndex.h
+//
+// \brief Spatial index of PxHit on a (wire, time) grid
+//
+// \date October 19, 2026
+//
+////////////////////////////////////////////////////////////////////////
+
+#ifndef UTIL_PXHITGRIDINDEX_H
+#define UTIL_PXHITGRIDINDEX_H
+
+#include "lardata/Utilities/GridContainers.h"
+#include "lardata/Utilities/PxUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/// General LArSoft Utilities
+namespace util {
+
+  /**
+   * @brief Spatial index of a collection of `PxHit` in the (wire, time) plane.
+   *
+   * The hits are sorted on a uniform grid of square cells covering their
+   * bounding box, so that the hits in a region can be found looking only at
+   * the cells overlapping it, instead of scanning the whole collection.
+   * The index is meant to be built once per plane and then used for many
+   * queries, e.g. by the overloads of `GeometryUtilities` hit selection
+   * functions accepting it.
+   *
+   * The index refers to the hit collection it was built from, which must not
+   * be changed or destroyed while the index is in use.
+   * Hits are identified by their index in that collection.
+   *
+   * If not specified, the cell size is chosen to have about
+   * `DefaultHitsPerCell` hits in each cell on average.
+   * In any case, the cell size is doubled until the number of cells is within
+   * `MaxCellsPerHit` times the number of hits, so that sparse hits do not
+   * need a huge grid.
+   */
+  class PxHitGridIndex {
+  public:
+    using HitIndex_t = unsigned int; ///< Type of index of hit in the collection.
+
+    /// Average hits in a cell when choosing the cell size automatically.
+    static constexpr double DefaultHitsPerCell = 2.0;
+
+    /// Maximum number of grid cells per hit.
+    static constexpr std::size_t MaxCellsPerHit = 8U;
+
+    /// Builds the index, choosing the cell size automatically.
+    explicit PxHitGridIndex(std::vector<PxHit> const& hits);
+
+    /// Builds the index, with cells of side at least `cellSize` (same units as hits).
+    PxHitGridIndex(std::vector<PxHit> const& hits, double cellSize);
+
+    /// The index keeps a pointer to the hits: a temporary collection is not accepted.
+    explicit PxHitGridIndex(std::vector<PxHit>&& hits) = delete;
+    PxHitGridIndex(std::vector<PxHit>&& hits, double cellSize) = delete;
+
+    /// Returns the indexed hit collection.
+    std::vector<PxHit> const&
+    hits() const
+    {
+      return *fHits;
+    }
+
+    /// Returns the number of indexed hits.
+    std::size_t
+    size() const
+    {
+      return fHits->size();
+    }
+
+    /// Returns the side of the grid cells.
+    double
+    cellSize() const
+    {
+      return fCellSize;
+    }
+
+    /// Returns the number of cells in wire and time directions.
+    std::size_t
+    nCellsW() const
+    {
+      return fGrid.sizeX();
+    }
+    std::size_t
+    nCellsT() const
+    {
+      return fGrid.sizeY();
+    }
+
+    /**
+     * @brief Calls `op(hitIndex)` for each hit in the cells touching a box.
+     * @param wmin lower wire coordinate of the box
+     * @param wmax upper wire coordinate of the box
+     * @param tmin lower time coordinate of the box
+     * @param tmax upper time coordinate of the box
+     * @param op operation to be called with the index of each candidate hit
+     *
+     * All the hits inside the box are visited, together with some of the hits
+     * just outside it (the ones in the same cells): the caller is in charge of
+     * the exact selection. Hits are not visited in index order.
+     */
+    template <typename Op>
+    void forEachInBox(double wmin, double wmax, double tmin, double tmax, Op&& op) const;
+
+    /// Returns the sorted indices of the candidate hits in a box
+    /// (see `forEachInBox()`).
+    std::vector<HitIndex_t> hitsInBox(double wmin, double wmax, double tmin, double tmax) const;
+
+    /**
+     * @brief Returns the index of the hit closest to the specified point.
+     * @param w wire coordinate of the point
+     * @param t time coordinate of the point
+     * @param wScale scale factor of the wire coordinate difference
+     * @param tScale scale factor of the time coordinate difference
+     * @param maxDistance only hits closer than this are considered
+     * @return index of the closest hit, `size()` if none is close enough
+     *
+     * The distance is `std::hypot((w - hit.w) * wScale, (t - hit.t) * tScale)`.
+     * Among hits at the same distance, the one with the lowest index is chosen,
+     * so that the result is the same as the one of a linear scan of the hits.
+     */
+    HitIndex_t closestHitIndex(double w,
+                               double t,
+                               double wScale = 1.0,
+                               double tScale = 1.0,
+                               double maxDistance = std::numeric_limits<double>::max()) const;
+
+    /**
+     * @brief Returns the hits sorted by decreasing charge.
+     *
+     * When more hits have the same charge, only the first one in the
+     * collection is included.
+     */
+    std::vector<HitIndex_t> const&
+    chargeRankedHits() const
+    {
+      return fByCharge;
+    }
+
+    /// Returns the total charge of all the hits.
+    double
+    totalCharge() const
+    {
+      return fTotalCharge;
+    }
+
+  private:
+    using Grid_t = util::CompactGridContainer2D<HitIndex_t>;
+
+    std::vector<PxHit> const* fHits; ///< Indexed hits.
+    double fCellSize;                ///< Side of the cells.
+    double fMinW = 0.0;              ///< Lower wire coordinate of the grid.
+    double fMinT = 0.0;              ///< Lower time coordinate of the grid.
+    Grid_t fGrid;                    ///< Hit indices, sorted by cell.
+
+    std::vector<HitIndex_t> fByCharge; ///< Hits sorted by decreasing charge.
+    double fTotalCharge = 0.0;         ///< Sum of all hit charges.
+
+    /// Returns the cell coordinate (not clamped) of the specified position.
+    long
+    cellCoord(double x, double min) const
+    {
+      constexpr double Limit = 1e15; // keeps the conversion defined
+      double const c = std::floor((x - min) / fCellSize);
+      return static_cast<long>((c > Limit) ? Limit : (c > -Limit) ? c : -Limit);
+    }
+
+    /// Clamps a cell coordinate to [ 0, n - 1 ].
+    static long
+    clampCoord(long c, std::size_t n)
+    {
+      return std::clamp(c, 0L, static_cast<long>(n) - 1L);
+    }
+
+    /// Calls `op` on the hits of the cells in a rectangle (no bound check).
+    template <typename Op>
+    void forEachInCells(long cwmin, long cwmax, long ctmin, long ctmax, Op&& op) const;
+
+    /// Builds the grid and the charge ranking.
+    void fill();
+
+    /// Computes the default cell size for the hits.
+    static double autoCellSize(std::vector<PxHit> const& hits);
+
+  }; // class PxHitGridIndex
+
+} // namespace util
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//---
+template <typename Op>
+void
+util::PxHitGridIndex::forEachInCells(long cwmin,
+                                     long cwmax,
+                                     long ctmin,
+                                     long ctmax,
+                                     Op&& op) const
+{
+  // cells along time are contiguous in the grid, and so are their hits
+  auto const& offsets = fGrid.cellOffsets();
+  auto const& data = fGrid.allData();
+  for (long cw = cwmin; cw <= cwmax; ++cw) {
+    std::size_t const begin = offsets[fGrid.index(Grid_t::CellID_t{{cw, ctmin}})];
+    std::size_t const end = offsets[fGrid.index(Grid_t::CellID_t{{cw, ctmax}}) + 1];
+    for (std::size_t i = begin; i < end; ++i)
+      op(data[i]);
+  }
+}
+
+template <typename Op>
+void
+util::PxHitGridIndex::forEachInBox(double wmin,
+                                   double wmax,
+                                   double tmin,
+                                   double tmax,
+                                   Op&& op) const
+{
+  if (fHits->empty() || !(wmin <= wmax) || !(tmin <= tmax)) return;
+  long const cwmin = cellCoord(wmin, fMinW), cwmax = cellCoord(wmax, fMinW);
+  long const ctmin = cellCoord(tmin, fMinT), ctmax = cellCoord(tmax, fMinT);
+  long const nW = nCellsW(), nT = nCellsT();
+  if (cwmax < 0 || ctmax < 0 || cwmin >= nW || ctmin >= nT) return;
+  forEachInCells(clampCoord(cwmin, nW),
+                 clampCoord(cwmax, nW),
+                 clampCoord(ctmin, nT),
+                 clampCoord(ctmax, nT),
+                 std::forward<Op>(op));
+}
+
+#endif // UTIL_PXHITGRIDINDEX_H
@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////////////////
+// \file PxPolygon.cxx
+//
+// \brief Polygon in the (wire, time) plane, with fast overlap and
+//        containment tests
+//
+// \date October 19, 2026
+//
+////////////////////////////////////////////////////////////////////////
+
+#include "lardata/Utilities/PxPolygon.h"
+#include "lardata/Utilities/PxHitColumns.h"
+#include "lardata/Utilities/UtilException.h"
+
+#include "TString.h"
+
+#include <cmath>
+#include <limits>
+
+namespace {
+
+  /// Even-odd rule test of a point against one edge (ray towards larger wire).
+  bool
+  crossesRay(util::PxPoint const& a, util::PxPoint const& b, double w, double t)
+  {
+    return ((a.t > t) != (b.t > t)) && (w < (b.w - a.w) * (t - a.t) / (b.t - a.t) + a.w);
+  }
+
+} // local namespace
+
+namespace util {
+
+  PxPolygon::PxPolygon(std::vector<PxPoint> vertices) : fVertices(std::move(vertices))
+  {
+    Prepare();
+  }
+
+  PxPolygon::PxPolygon(std::vector<PxHit const*> const& hits)
+  {
+    fVertices.reserve(hits.size());
+    for (PxHit const* hit : hits)
+      fVertices.push_back(*hit);
+    Prepare();
+  }
+
+  bool
+  PxPolygon::Contains(double const w, double const t) const
+  {
+    if (fEdges.empty() || !fBox.Contains(w, t)) return false;
+
+    std::size_t const band = BandOf(t);
+    bool inside = false;
+    for (std::size_t i = fBandOffsets[band]; i < fBandOffsets[band + 1]; ++i) {
+      Edge_t const& edge = fEdges[fBandEdges[i]];
+      if (crossesRay(edge.a, edge.b, w, t)) inside = !inside;
+    }
+    return inside;
+  }
+
+  void
+  PxPolygon::Contains(std::vector<PxHit> const& hits, std::vector<bool>& inside) const
+  {
+    inside.assign(hits.size(), false);
+    for (std::size_t i = 0; i < hits.size(); ++i)
+      inside[i] = Contains(hits[i].w, hits[i].t);
+  }
+
+  void
+  PxPolygon::Contains(PxHitColumns const& hits, std::vector<bool>& inside) const
+  {
+    inside.assign(hits.size(), false);
+    for (std::size_t i = 0; i < hits.size(); ++i)
+      inside[i] = Contains(hits.w[i], hits.t[i]);
+  }
+
+  std::vector<unsigned int>
+  PxPolygon::ContainedHits(std::vector<PxHit> const& hits) const
+  {
+    std::vector<unsigned int> indices;
+    for (unsigned int i = 0; i < hits.size(); ++i) {
+      if (Contains(hits[i].w, hits[i].t)) indices.push_back(i);
+    }
+    return indices;
+  }
+
+  std::vector<unsigned int>
+  PxPolygon::ContainedHits(PxHitColumns const& hits) const
+  {
+    std::vector<unsigned int> indices;
+    for (unsigned int i = 0; i < hits.size(); ++i) {
+      if (Contains(hits.w[i], hits.t[i])) indices.push_back(i);
+    }
+    return indices;
+  }
+
+  bool
+  PxPolygon::IsSelfIntersecting() const
+  {
+    std::size_t const n = fEdges.size();
+    if (n < 4) return false;
+    bool found = false;
+    ForEachOverlappingBoxPair(EdgeBoxes(), [this, n, &found](std::size_t i, std::size_t j) {
+      // consecutive edges share a vertex
+      if (found || (j == i + 1) || ((i == 0) && (j == n - 1))) return;
+      found = SegmentsCross(fEdges[i].a, fEdges[i].b, fEdges[j].a, fEdges[j].b);
+    });
+    return found;
+  }
+
+  bool
+  PxPolygon::EdgesCross(PxPolygon const& other) const
+  {
+    if (fEdges.empty() || other.fEdges.empty() || !fBox.Overlaps(other.fBox)) return false;
+
+    // sweep the edges of both polygons together, testing only mixed pairs
+    std::vector<PxBox> boxes = EdgeBoxes();
+    std::vector<PxBox> const otherBoxes = other.EdgeBoxes();
+    boxes.insert(boxes.end(), otherBoxes.begin(), otherBoxes.end());
+    std::size_t const n = fEdges.size();
+    bool found = false;
+    ForEachOverlappingBoxPair(boxes, [this, &other, n, &found](std::size_t i, std::size_t j) {
+      if (found || (i >= n) || (j < n)) return;
+      Edge_t const& edge = fEdges[i];
+      Edge_t const& otherEdge = other.fEdges[j - n];
+      found = SegmentsCross(edge.a, edge.b, otherEdge.a, otherEdge.b);
+    });
+    return found;
+  }
+
+  bool
+  PxPolygon::Overlaps(PxPolygon const& other) const
+  {
+    if (fVertices.empty() || other.fVertices.empty() || !fBox.Overlaps(other.fBox)) return false;
+    if (EdgesCross(other)) return true;
+    // no crossing: either one polygon is inside the other, or they are apart
+    return Contains(other.fVertices.front().w, other.fVertices.front().t) ||
+           other.Contains(fVertices.front().w, fVertices.front().t);
+  }
+
+  std::size_t
+  PxPolygon::BandOf(double const t) const
+  {
+    double const band = std::floor((t - fBox.minT) / fBandHeight);
+    std::size_t const nBands = fBandOffsets.size() - 1;
+    if (!(band > 0.0)) return 0;
+    if (band >= nBands) return nBands - 1;
+    return static_cast<std::size_t>(band);
+  }
+
+  void
+  PxPolygon::Prepare()
+  {
+    fEdges.clear();
+    fBandOffsets.assign(1U, 0U);
+    fBandEdges.clear();
+    if (fVertices.empty()) {
+      fBox = PxBox{};
+      return;
+    }
+
+    fBox = {std::numeric_limits<double>::max(),
+            std::numeric_limits<double>::lowest(),
+            std::numeric_limits<double>::max(),
+            std::numeric_limits<double>::lowest()};
+    std::size_t const n = fVertices.size();
+    fEdges.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      PxPoint const& a = fVertices[i];
+      fEdges.push_back({a, fVertices[(i + 1) % n]});
+      fBox.minW = std::min(fBox.minW, a.w);
+      fBox.maxW = std::max(fBox.maxW, a.w);
+      fBox.minT = std::min(fBox.minT, a.t);
+      fBox.maxT = std::max(fBox.maxT, a.t);
+    }
+
+    // assign the edges to bands of time, with about one edge per band;
+    // horizontal edges never cross the test ray and are left out
+    constexpr std::size_t MaxBands = 256;
+    std::size_t const nBands = std::clamp<std::size_t>(n, 1U, MaxBands);
+    double const height = fBox.maxT - fBox.minT;
+    fBandHeight = (height > 0.0) ? height / nBands : 1.0;
+    fBandOffsets.assign(nBands + 1, 0U);
+
+    auto bandRange = [this](Edge_t const& edge) {
+      return std::make_pair(BandOf(std::min(edge.a.t, edge.b.t)),
+                            BandOf(std::max(edge.a.t, edge.b.t)));
+    };
+    for (Edge_t const& edge : fEdges) {
+      if (edge.a.t == edge.b.t) continue;
+      auto const [first, last] = bandRange(edge);
+      for (std::size_t band = first; band <= last; ++band)
+        ++fBandOffsets[band + 1];
+    }
+    for (std::size_t band = 0; band < nBands; ++band)
+      fBandOffsets[band + 1] += fBandOffsets[band];
+    fBandEdges.resize(fBandOffsets.back());
+    std::vector<std::size_t> fill(fBandOffsets.begin(), fBandOffsets.end() - 1);
+    for (unsigned int i = 0; i < fEdges.size(); ++i) {
+      Edge_t const& edge = fEdges[i];
+      if (edge.a.t == edge.b.t) continue;
+      auto const [first, last] = bandRange(edge);
+      for (std::size_t band = first; band <= last; ++band)
+        fBandEdges[fill[band]++] = i;
+    }
+  }
+
+  std::vector<PxBox>
+  PxPolygon::EdgeBoxes() const
+  {
+    std::vector<PxBox> boxes;
+    boxes.reserve(fEdges.size());
+    for (Edge_t const& edge : fEdges)
+      boxes.push_back(PxBox::OfSegment(edge.a, edge.b));
+    return boxes;
+  }
+
+  void
+  PxPolygon::ThrowUntangleFailure(std::size_t chainSize)
+  {
+    throw UtilException(Form("Polygon of %zu points could not be untangled", chainSize));
+  }
+
+} // namespace util
@@ -0,0 +1,298 @@
+////////////////////////////////////////////////////////////////////////
+// \file PxPolygon.h
+//
+// \brief Polygon in the (wire, time) plane, with fast overlap and
+//        containment tests
+//
+// \date October 19, 2026
+//
+////////////////////////////////////////////////////////////////////////
+
+#ifndef UTIL_PXPOLYGON_H
+#define UTIL_PXPOLYGON_H
+
+#include "lardata/Utilities/PxUtils.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/// General LArSoft Utilities
+namespace util {
+
+  class PxHitColumns;
+
+  /// Axis-aligned box in the (wire, time) plane; boundaries are included.
+  struct PxBox {
+    double minW = 0.0;
+    double maxW = 0.0;
+    double minT = 0.0;
+    double maxT = 0.0;
+
+    /// Returns the box of the segment between two points.
+    static PxBox
+    OfSegment(PxPoint const& a, PxPoint const& b)
+    {
+      return {std::min(a.w, b.w), std::max(a.w, b.w), std::min(a.t, b.t), std::max(a.t, b.t)};
+    }
+
+    /// Returns whether the two boxes share any point.
+    bool
+    Overlaps(PxBox const& other) const
+    {
+      return (minW <= other.maxW) && (other.minW <= maxW) && (minT <= other.maxT) &&
+             (other.minT <= maxT);
+    }
+
+    /// Returns whether the point is in the box.
+    bool
+    Contains(double w, double t) const
+    {
+      return (w >= minW) && (w <= maxW) && (t >= minT) && (t <= maxT);
+    }
+  }; // struct PxBox
+
+  /**
+   * @brief Calls `op(a, b)` for each pair of overlapping boxes, with `a < b`.
+   * @param boxes the boxes to be tested
+   * @param op operation called with the indices of the overlapping boxes
+   *
+   * The boxes are swept along the wire direction, so that only the boxes
+   * overlapping in that direction are compared. Pairs are not visited in any
+   * specific order.
+   */
+  template <typename Op>
+  void ForEachOverlappingBoxPair(std::vector<PxBox> const& boxes, Op&& op);
+
+  /**
+   * @brief Closed polygon in the (wire, time) plane.
+   *
+   * The polygon is defined by its vertices, in order; the last vertex is
+   * connected to the first one, and it should not repeat it.
+   * The polygon caches its bounding box, which is used to reject quickly
+   * the tests far from it, and the assignment of its edges to bands in the
+   * time direction, so that the containment test of a point looks only at
+   * the edges in its band.
+   *
+   * Edges are considered crossing with the same criterion as
+   * `GeometryUtilities::PolyOverlap()`, based on `Clockwise()`.
+   * Containment follows the even-odd rule; points on the boundary may be
+   * considered either inside or outside.
+   */
+  class PxPolygon {
+  public:
+    PxPolygon() = default;
+
+    /// Creates the polygon with the specified vertices.
+    explicit PxPolygon(std::vector<PxPoint> vertices);
+
+    /// Creates the polygon with vertices on the specified hits
+    /// (like the ones from `GeometryUtilities::SelectPolygonHitList()`).
+    explicit PxPolygon(std::vector<PxHit const*> const& hits);
+
+    /// Returns the vertices of the polygon.
+    std::vector<PxPoint> const&
+    Vertices() const
+    {
+      return fVertices;
+    }
+
+    /// Returns the number of vertices.
+    std::size_t
+    Size() const
+    {
+      return fVertices.size();
+    }
+
+    /// Returns the bounding box of the polygon.
+    PxBox const&
+    Box() const
+    {
+      return fBox;
+    }
+
+    /// Returns whether the point is inside the polygon.
+    bool Contains(double w, double t) const;
+
+    /// Fills `inside` with whether each of the hits is inside the polygon.
+    void Contains(std::vector<PxHit> const& hits, std::vector<bool>& inside) const;
+    void Contains(PxHitColumns const& hits, std::vector<bool>& inside) const;
+
+    /// Returns the indices of the hits inside the polygon.
+    std::vector<unsigned int> ContainedHits(std::vector<PxHit> const& hits) const;
+    std::vector<unsigned int> ContainedHits(PxHitColumns const& hits) const;
+
+    /// Returns whether two edges which are not consecutive cross each other.
+    bool IsSelfIntersecting() const;
+
+    /// Returns whether any edge of this polygon crosses one of `other`.
+    bool EdgesCross(PxPolygon const& other) const;
+
+    /// Returns whether the two polygons share any area (or cross).
+    bool Overlaps(PxPolygon const& other) const;
+
+    /// Same as `GeometryUtilities::Clockwise()`.
+    static bool
+    Clockwise(double Ax, double Ay, double Bx, double By, double Cx, double Cy)
+    {
+      return (Cy - Ay) * (Bx - Ax) > (By - Ay) * (Cx - Ax);
+    }
+
+    /// Returns whether segment AB crosses segment CD (`Clockwise()` test).
+    static bool
+    SegmentsCross(PxPoint const& A, PxPoint const& B, PxPoint const& C, PxPoint const& D)
+    {
+      return (Clockwise(A.w, A.t, C.w, C.t, D.w, D.t) != Clockwise(B.w, B.t, C.w, C.t, D.w, D.t)) &&
+             (Clockwise(A.w, A.t, B.w, B.t, C.w, C.t) != Clockwise(A.w, A.t, B.w, B.t, D.w, D.t));
+    }
+
+    /**
+     * @brief Removes crossings from a closed chain of points.
+     * @param chain indices of the points; the last one must equal the first
+     * @param pos function returning the `PxPoint` for an index in the chain
+     * @return the untangled chain
+     *
+     * This is the algorithm of `GeometryUtilities::PolyOverlap()`: as long as
+     * there are crossing edges, the end of the first edge is swapped with the
+     * start of the second one, where "first" follows the order of the edges
+     * in the chain. The result is the same, but the crossing edges are looked
+     * for among the ones with overlapping bounding boxes only.
+     *
+     * A `UtilException` is thrown if the chain can't be untangled.
+     */
+    template <typename Pos>
+    static std::vector<std::size_t> Untangle(std::vector<std::size_t> chain, Pos&& pos);
+
+  private:
+    /// Edge from a vertex (`a`) to the next one (`b`).
+    struct Edge_t {
+      PxPoint a, b;
+    };
+
+    std::vector<PxPoint> fVertices;
+    PxBox fBox;
+
+    std::vector<Edge_t> fEdges;            ///< Edges, one per vertex.
+    double fBandHeight = 1.0;              ///< Time extent of each band.
+    std::vector<std::size_t> fBandOffsets; ///< Start of each band in `fBandEdges`.
+    std::vector<unsigned int> fBandEdges;  ///< Edges spanning each band.
+
+    /// Returns the band of the time `t`.
+    std::size_t BandOf(double t) const;
+
+    /// Prepares the cached data (box, edges and bands).
+    void Prepare();
+
+    /// Returns the bounding boxes of all the edges.
+    std::vector<PxBox> EdgeBoxes() const;
+
+    /// Looks for the first pair of crossing edges in the chain.
+    template <typename Pos>
+    static bool FirstCrossing(std::vector<std::size_t> const& chain,
+                              Pos& pos,
+                              std::size_t& first,
+                              std::size_t& second);
+
+    /// Throws the exception for chains which can't be untangled.
+    [[noreturn]] static void ThrowUntangleFailure(std::size_t chainSize);
+
+  }; // class PxPolygon
+
+} // namespace util
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//---
+template <typename Op>
+void
+util::ForEachOverlappingBoxPair(std::vector<PxBox> const& boxes, Op&& op)
+{
+  std::vector<std::size_t> order(boxes.size());
+  for (std::size_t i = 0; i < order.size(); ++i)
+    order[i] = i;
+  std::sort(order.begin(), order.end(), [&boxes](std::size_t a, std::size_t b) {
+    return boxes[a].minW < boxes[b].minW;
+  });
+
+  // boxes which may still overlap the next ones along the wire direction
+  std::vector<std::size_t> active;
+  for (std::size_t const i : order) {
+    PxBox const& box = boxes[i];
+    active.erase(std::remove_if(active.begin(),
+                                active.end(),
+                                [&boxes, &box](std::size_t j) { return boxes[j].maxW < box.minW; }),
+                 active.end());
+    for (std::size_t const j : active) {
+      if (box.Overlaps(boxes[j])) op(std::min(i, j), std::max(i, j));
+    }
+    active.push_back(i);
+  }
+}
+
+template <typename Pos>
+bool
+util::PxPolygon::FirstCrossing(std::vector<std::size_t> const& chain,
+                               Pos& pos,
+                               std::size_t& first,
+                               std::size_t& second)
+{
+  // edge i goes from chain[i] to chain[i + 1]
+  if (chain.size() < 4) return false;
+  std::size_t const nEdges = chain.size() - 1;
+
+  // the pairs of edges tested in the original algorithm
+  auto crossing = [&chain, &pos](std::size_t i, std::size_t j) {
+    if ((j < i + 2) || (chain[i] == chain[j + 1])) return false;
+    return SegmentsCross(pos(chain[i]), pos(chain[i + 1]), pos(chain[j]), pos(chain[j + 1]));
+  };
+
+  std::vector<PxBox> boxes;
+  boxes.reserve(nEdges);
+  for (std::size_t i = 0; i < nEdges; ++i)
+    boxes.push_back(PxBox::OfSegment(pos(chain[i]), pos(chain[i + 1])));
+
+  // few edges: test them in order, stopping at the first crossing
+  constexpr std::size_t MaxEdgesForScan = 16;
+  if (nEdges <= MaxEdgesForScan) {
+    for (std::size_t i = 0; i < nEdges; ++i) {
+      for (std::size_t j = i + 2; j < nEdges; ++j) {
+        if (!boxes[i].Overlaps(boxes[j]) || !crossing(i, j)) continue;
+        first = i;
+        second = j;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // many edges: test only the overlapping ones, and keep the first crossing
+  bool found = false;
+  ForEachOverlappingBoxPair(boxes, [&](std::size_t i, std::size_t j) {
+    if (found && (std::make_pair(i, j) > std::make_pair(first, second))) return;
+    if (!crossing(i, j)) return;
+    first = i;
+    second = j;
+    found = true;
+  });
+  return found;
+}
+
+template <typename Pos>
+std::vector<std::size_t>
+util::PxPolygon::Untangle(std::vector<std::size_t> chain, Pos&& pos)
+{
+  // each swap removes a crossing, but may add others: stop eventually
+  std::size_t const maxSwaps = chain.size() * chain.size() * chain.size() + 100;
+  std::size_t first = 0, second = 0;
+  std::size_t nSwaps = 0;
+  while (FirstCrossing(chain, pos, first, second)) {
+    if (++nSwaps > maxSwaps) ThrowUntangleFailure(chain.size());
+    std::swap(chain[first + 1], chain[second]);
+    // check that last element is still first (to close circle...)
+    chain.back() = chain.front();
+  }
+  return chain;
+}
+
+#endif // UTIL_PXPOLYGON_H
@@ -0,0 +1,369 @@
+/**
+ * @file   RunConditionsCache.h
+ * @brief  Run conditions read from the database, kept in memory and on disk
+ * @date   October 19, 2026
+ *
+ * This is a header-only library.
+ */
+
+#ifndef RUNCONDITIONSCACHE_H
+#define RUNCONDITIONSCACHE_H
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::find()
+#include <array>
+#include <cstdlib> // std::strtod(), std::strtold(), std::atoi()
+#include <fstream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits> // std::is_same_v
+#include <vector>
+
+
+namespace util {
+
+  /// Conditions of a single run, as stored in the database.
+  struct RunConditions {
+    int run = 0;
+    /// Whether all the conditions were read at once (missing ones are absent).
+    bool complete = false;
+    std::optional<double>      lifetime;      ///< Electron lifetime ("tau").
+    std::optional<double>      triggerOffset; ///< Trigger offset ("T0").
+    std::optional<double>      temperature;   ///< Temperature ("temp").
+    std::optional<long double> pot;           ///< Protons on target ("pot").
+    std::vector<double>        efield;        ///< Field by plane gap (empty if unknown).
+  }; // RunConditions
+
+
+  /**
+   * @brief Run conditions keyed by run number, with a snapshot file format.
+   *
+   * The cache is filled by `util::DatabaseUtil` as queries are answered, or
+   * in bulk for a list of runs. It can be saved into a text file and loaded
+   * back, so that a job can find all its conditions without connecting to
+   * the database.
+   *
+   * The snapshot file has a version line, then one line per run:
+   *
+   *     run <run> complete <0|1> tau <v> T0 <v> temp <v> pot <v> efield <n> <v1> ... <vn>
+   *
+   * where each missing value is written as `-`. Values are written with
+   * enough digits to be read back identical.
+   */
+  class RunConditionsCache {
+  public:
+    /// First line of the snapshot files.
+    static constexpr char const* SnapshotHeader = "# util::RunConditionsCache snapshot, version 1";
+
+    /// Text of a row of the run table: run, tau, T0, temp and pot.
+    using ConditionsRow_t = std::array<std::string, 5U>;
+
+    /// Text of a row of the electric field query: run and field.
+    using EfieldRow_t = std::array<std::string, 2U>;
+
+    /// Returns the conditions of the run, or `nullptr` if not cached.
+    RunConditions const* find(int run) const
+    {
+      auto const iRun = fRuns.find(run);
+      return (iRun == fRuns.end()) ? nullptr : &(iRun->second);
+    }
+
+    /// Returns the conditions of the run, adding an empty entry if needed.
+    RunConditions& get(int run)
+    {
+      RunConditions& cond = fRuns[run];
+      cond.run = run;
+      return cond;
+    }
+
+    /// Returns whether the conditions of the run were all read already.
+    bool isComplete(int run) const
+    {
+      RunConditions const* cond = find(run);
+      return cond && cond->complete;
+    }
+
+    /**
+     * @brief Answers a query of a single condition from the cache.
+     * @param run the run number
+     * @param member the condition to be looked up
+     * @param value (output) the value of the condition, if found
+     * @return `0` if found, `-1` if known to be absent, empty if not cached
+     *
+     * The return codes are the ones of the `util::DatabaseUtil` queries.
+     * A condition is known to be absent from the database when all the
+     * conditions of the run were read at once and that one was not there.
+     */
+    template <typename T>
+    std::optional<int> lookup
+      (int run, std::optional<T> RunConditions::*member, T& value) const;
+
+    /// Answers a query of the field values (`lookup()` for the others).
+    std::optional<int> lookupEfield(int run, std::vector<double>& efield) const;
+
+    /// Returns the runs among the specified ones which are not complete yet.
+    std::vector<int> missingRuns(std::vector<int> const& runs) const;
+
+    /**
+     * @brief Adds the conditions of runs from the rows of the bulk queries.
+     * @param runs the runs which were queried
+     * @param rows the rows of the run table for those runs
+     * @param efieldRows rows of the field query (`nullptr` if it failed)
+     * @return the number of runs added
+     *
+     * The conditions of all the `runs` are replaced, even if they have no row.
+     * Like in the single run queries, a run with more than one row in the run
+     * table gets no value. The runs are marked complete only if `efieldRows`
+     * are available, since otherwise the field still needs to be queried.
+     */
+    std::size_t addPrefetched(
+      std::vector<int> const& runs,
+      std::vector<ConditionsRow_t> const& rows,
+      std::vector<EfieldRow_t> const* efieldRows
+      );
+
+    std::size_t size() const { return fRuns.size(); }
+    bool empty() const { return fRuns.empty(); }
+    void clear() { fRuns.clear(); }
+
+    /// Writes all the cached conditions into a snapshot file.
+    void writeSnapshot(std::string const& path) const;
+
+    /// Adds the conditions from a snapshot file; returns the number of runs.
+    std::size_t readSnapshot(std::string const& path);
+
+  private:
+    std::map<int, RunConditions> fRuns;
+
+    template <typename T>
+    static void writeValue(std::ostream& out, char const* key, std::optional<T> const& value);
+
+    template <typename T>
+    static std::optional<T> parseValue(std::string const& s, std::string const& path, int line);
+
+  }; // class RunConditionsCache
+
+} // namespace util
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//
+template <typename T>
+std::optional<int> util::RunConditionsCache::lookup
+  (int run, std::optional<T> RunConditions::*member, T& value) const
+{
+  RunConditions const* cond = find(run);
+  if (!cond) return std::nullopt;
+  if (std::optional<T> const& cached = cond->*member) {
+    value = *cached;
+    return 0;
+  }
+  if (cond->complete) return -1; // not in the database
+  return std::nullopt;
+}
+
+
+template <typename T>
+void util::RunConditionsCache::writeValue(std::ostream& out,
+                                          char const* key,
+                                          std::optional<T> const& value)
+{
+  out << ' ' << key << ' ';
+  if (value) out << *value; else out << '-';
+}
+
+
+template <typename T>
+std::optional<T> util::RunConditionsCache::parseValue(std::string const& s,
+                                                      std::string const& path,
+                                                      int line)
+{
+  if (s == "-") return std::nullopt;
+  char* end = nullptr;
+  T value;
+  if constexpr (std::is_same_v<T, long double>) value = std::strtold(s.c_str(), &end);
+  else value = std::strtod(s.c_str(), &end);
+  if (s.empty() || (*end != '\0')) {
+    throw cet::exception("RunConditionsCache")
+      << "Invalid value '" << s << "' at line " << line << " of '" << path << "'\n";
+  }
+  return value;
+}
+
+
+//------------------------------------------------------------------------------
+inline std::optional<int> util::RunConditionsCache::lookupEfield
+  (int run, std::vector<double>& efield) const
+{
+  RunConditions const* cond = find(run);
+  if (!cond) return std::nullopt;
+  if (!cond->efield.empty()) {
+    efield = cond->efield;
+    return 0;
+  }
+  if (cond->complete) return -1; // not in the database
+  return std::nullopt;
+}
+
+
+inline std::vector<int> util::RunConditionsCache::missingRuns
+  (std::vector<int> const& runs) const
+{
+  std::vector<int> missing;
+  for (int run: runs) {
+    if (isComplete(run)) continue;
+    if (std::find(missing.begin(), missing.end(), run) != missing.end()) continue;
+    missing.push_back(run);
+  }
+  return missing;
+}
+
+
+inline std::size_t util::RunConditionsCache::addPrefetched(
+  std::vector<int> const& runs,
+  std::vector<ConditionsRow_t> const& rows,
+  std::vector<EfieldRow_t> const* efieldRows
+) {
+  std::map<int, RunConditions> fetched;
+  for (int run: runs) fetched[run].run = run;
+
+  std::map<int, int> nRows;
+  for (ConditionsRow_t const& row: rows) {
+    auto const iRun = fetched.find(std::atoi(row[0].c_str()));
+    if (iRun == fetched.end()) continue;
+    RunConditions& cond = iRun->second;
+    cond.lifetime      = std::strtod(row[1].c_str(), nullptr);
+    cond.triggerOffset = std::strtod(row[2].c_str(), nullptr);
+    cond.temperature   = std::strtod(row[3].c_str(), nullptr);
+    cond.pot           = std::strtold(row[4].c_str(), nullptr);
+    ++nRows[cond.run];
+  }
+
+  // like the single run queries, a run with more than one row has no value
+  for (auto const& [run, n]: nRows) {
+    if (n == 1) continue;
+    RunConditions& cond = fetched[run];
+    cond.lifetime.reset();
+    cond.triggerOffset.reset();
+    cond.temperature.reset();
+    cond.pot.reset();
+  }
+
+  if (efieldRows) {
+    for (EfieldRow_t const& row: *efieldRows) {
+      auto const iRun = fetched.find(std::atoi(row[0].c_str()));
+      if (iRun == fetched.end()) continue;
+      iRun->second.efield.push_back(std::strtod(row[1].c_str(), nullptr));
+    }
+  }
+
+  for (auto& [run, cond]: fetched) {
+    cond.complete = (efieldRows != nullptr); // otherwise the field is still asked run by run
+    get(run) = std::move(cond);
+  }
+  return fetched.size();
+}
+
+
+//------------------------------------------------------------------------------
+inline void util::RunConditionsCache::writeSnapshot(std::string const& path) const
+{
+  std::ofstream out(path);
+  if (!out) {
+    throw cet::exception("RunConditionsCache")
+      << "Can't write run conditions snapshot '" << path << "'\n";
+  }
+  out << SnapshotHeader << '\n';
+  for (auto const& [run, cond]: fRuns) {
+    out.precision(std::numeric_limits<double>::max_digits10);
+    out << "run " << run << " complete " << (cond.complete? 1: 0);
+    writeValue(out, "tau", cond.lifetime);
+    writeValue(out, "T0", cond.triggerOffset);
+    writeValue(out, "temp", cond.temperature);
+    out.precision(std::numeric_limits<long double>::max_digits10);
+    writeValue(out, "pot", cond.pot);
+    out.precision(std::numeric_limits<double>::max_digits10);
+    out << " efield " << cond.efield.size();
+    for (double value: cond.efield) out << ' ' << value;
+    out << '\n';
+  }
+  if (!out) {
+    throw cet::exception("RunConditionsCache")
+      << "Error while writing run conditions snapshot '" << path << "'\n";
+  }
+}
+
+
+inline std::size_t util::RunConditionsCache::readSnapshot(std::string const& path)
+{
+  std::ifstream in(path);
+  if (!in) {
+    throw cet::exception("RunConditionsCache")
+      << "Can't open run conditions snapshot '" << path << "'\n";
+  }
+
+  std::string line;
+  if (!std::getline(in, line) || (line != SnapshotHeader)) {
+    throw cet::exception("RunConditionsCache")
+      << "'" << path << "' is not a run conditions snapshot\n";
+  }
+
+  // each run is parsed completely before being added
+  std::size_t nRuns = 0;
+  int iLine = 1;
+  while (std::getline(in, line)) {
+    ++iLine;
+    if (line.empty()) continue;
+    std::istringstream sline(line);
+    auto expect = [&sline, &path, iLine](char const* key) {
+      std::string word;
+      if ((sline >> word) && (word == key)) return;
+      throw cet::exception("RunConditionsCache")
+        << "Expected '" << key << "' at line " << iLine << " of '" << path << "'\n";
+    };
+    auto word = [&sline, &path, iLine]() {
+      std::string w;
+      if (sline >> w) return w;
+      throw cet::exception("RunConditionsCache")
+        << "Truncated line " << iLine << " of '" << path << "'\n";
+    };
+
+    RunConditions cond;
+    expect("run");
+    cond.run = std::stoi(word());
+    expect("complete");
+    cond.complete = (word() == "1");
+    expect("tau");
+    cond.lifetime = parseValue<double>(word(), path, iLine);
+    expect("T0");
+    cond.triggerOffset = parseValue<double>(word(), path, iLine);
+    expect("temp");
+    cond.temperature = parseValue<double>(word(), path, iLine);
+    expect("pot");
+    cond.pot = parseValue<long double>(word(), path, iLine);
+    expect("efield");
+    std::size_t const nGaps = std::stoul(word());
+    for (std::size_t i = 0; i < nGaps; ++i) {
+      std::optional<double> const value = parseValue<double>(word(), path, iLine);
+      if (!value) {
+        throw cet::exception("RunConditionsCache")
+          << "Missing field value at line " << iLine << " of '" << path << "'\n";
+      }
+      cond.efield.push_back(*value);
+    }
+
+    fRuns[cond.run] = std::move(cond);
+    ++nRuns;
+  }
+  return nRuns;
+}
+
+
+#endif // RUNCONDITIONSCACHE_H
@@ -6,7 +6,11 @@
  *
  * Currently includes:
  *  - LinearFit
- *  -
+ *  - QuadraticFit
+ *  - GaussianFit
+ *  - PolyFitBatch (LinearFitBatch, QuadraticFitBatch), GaussianFitBatch:
+ *    many independent fits at once
+ *  - SlidingWindowFit: one of the fits above on a window moving on data
  *
  */
 
@@ -17,10 +21,12 @@
 #include <cmath> // std::sqrt()
 #include <tuple>
 #include <array>
+#include <vector>
+#include <cstddef> // std::size_t
 #include <iterator> // std::begin(), std::end()
-#include <algorithm> // std::for_each()
+#include <algorithm> // std::for_each(), std::min()
 #include <type_traits> // std::enable_if<>, std::is_const<>
-#include <stdexcept> // std::range_error
+#include <stdexcept> // std::range_error, std::invalid_argument
 #include <ostream> // std::endl
 
 
@@ -38,41 +44,20 @@ namespace lar {
 
         /**
          * @details
-         * The "extractor" is just a C++ trick to replace a statement like:
-         *
-         *     (N == 0)? weight.Weights(): sums.template SumN<N>()
-         *
-         * where N is a constexpr number. The problem is that SumN<0> is not
-         * valid (in our case, it raises a static assertion). The analysis of
-         * the full statement shows that it would not be a problem, since the
-         * compiler could remove the ternary operator since it always knows
-         * whether N is 0 or not. Matter of fact, the compiler can also choose
-         * to be dumb and compile the whole thing, including a SumN<0>.
-         *
-         * The trick is in the form of a class that gets specialized for N = 0.
-         * A long list of limitations in C++ (up to 2014 at least) forces the
-         * implementation in a struct.
+         * The collector keeps the weighted power sums of x and y needed by the
+         * polynomial fits (the weight being @f$ s^{-2} @f$), in the same way
+         * as `lar::util::DataTracker` would, but with direct access so that
+         * they can be filled in bulk (`add_batch()`).
          */
-        template <unsigned int Power, unsigned int N>
-        struct SumExtractor {
-          static T Sum
-            (WeightTracker<T> const&, DataTracker<Power, T> const& sums)
-            { return sums.template SumN<N>(); }
-        }; // SumExtractor
-
-        // specialization
-        template <unsigned int Power>
-        struct SumExtractor<Power, 0U> {
-          static T Sum
-            (WeightTracker<T> const& weight, DataTracker<Power, T> const&)
-            { return weight.Weights(); }
-        }; // SumExtractor<>
 
           public:
         /// Degree of the fit
         static constexpr unsigned int Degree = D;
         static constexpr unsigned int NParams = Degree + 1;
 
+        /// Number of interleaved partial sums used by `add_batch()`
+        static constexpr unsigned int BatchLanes = 4;
+
         using Data_t = T; ///< type of the data
 
         /// type of measurement without uncertainty
@@ -254,6 +239,68 @@ namespace lar {
         unsigned int add_with_uncertainty(Cont cont)
           { return add_with_uncertainty(std::begin(cont), std::end(cont)); }
 
+
+        /**
+         * @brief Adds measurements from contiguous arrays
+         * @param xs array of the x values
+         * @param ys array of the y values
+         * @param sys array of the uncertainties on y (`nullptr`: all 1)
+         * @param n number of points in the arrays
+         * @return number of points added
+         *
+         * The points are processed in blocks of `BatchLanes`, each point of a
+         * block accumulating into its own set of partial sums, with no
+         * branches; the partial sums are added together at the end.
+         * This allows the compiler to vectorize the accumulation.
+         * The results are the same as adding each point with `add()`, but for
+         * the rounding from the different summation order: the relative
+         * difference on each sum is of the order of `n` times the machine
+         * epsilon of `Data_t`, and usually much smaller.
+         *
+         * Points with zero or infinite uncertainty are ignored and not added.
+         */
+        unsigned int add_batch(
+          Data_t const* xs, Data_t const* ys, Data_t const* sys, std::size_t n
+          );
+
+        /// Adds measurements from contiguous arrays, with no uncertainty
+        unsigned int add_batch(Data_t const* xs, Data_t const* ys, std::size_t n)
+          { return add_batch(xs, ys, nullptr, n); }
+
+        ///@}
+
+
+        /// @{
+        /// @name Remove elements
+
+        /**
+         * @brief Removes one entry with specified x, y and uncertainty
+         * @param x value of x
+         * @param y value of y
+         * @param sy value of uncertainty on y (1 by default)
+         * @return whether the point was removed
+         *
+         * The entry must have been previously added with the very same values,
+         * otherwise the statistics are corrupted.
+         * Entries that `add()` would ignore are ignored here too.
+         *
+         * Removal subtracts the contribution of the entry from the sums, which
+         * accumulates rounding errors when many entries are added and removed;
+         * the sums are reset to exactly zero when the last entry is removed.
+         */
+        bool remove(Data_t x, Data_t y, Data_t sy = Data_t(1.0));
+
+        /// Removes one entry (see `remove(Data_t, Data_t, Data_t)`)
+        bool remove(Measurement_t value, Data_t sy = Data_t(1.0))
+          { return remove(std::get<0>(value), std::get<1>(value), sy); }
+
+        /// Removes one entry (see `remove(Data_t, Data_t, Data_t)`)
+        bool remove(MeasurementAndUncertainty_t value)
+          {
+            return
+              remove(std::get<0>(value), std::get<1>(value), std::get<2>(value));
+          }
+
         ///@}
 
         /// Clears all the statistics
@@ -263,7 +310,7 @@ namespace lar {
         /// @name Statistic retrieval
 
         /// Returns the number of entries added
-        int N() const { return s2.N(); }
+        int N() const { return n; }
 
         /**
          * @brief Returns an average of the uncertainties
@@ -275,7 +322,13 @@ namespace lar {
          * @f$ \bar{s}^{-2} = \frac{1}{N} \sum_{i=1}^{N} s_{y}^{-2} @f$
          */
         Data_t AverageUncertainty() const
-          { return WeightToUncertainty(s2.AverageWeight()); }
+          {
+            if (n == 0) {
+              throw std::range_error
+                ("FitDataCollector::AverageUncertainty(): no entries");
+            }
+            return WeightToUncertainty(s2 / n);
+          }
 
 
         /// Returns the square of the specified value
@@ -285,26 +338,32 @@ namespace lar {
 
         /// Returns the weighted sum of x^n
         Data_t XN(unsigned int n) const
-          { return (n == 0)? s2.Weights(): x.Sum(n); }
+          { return (n == 0)? s2: ((n <= NXSums)? x[n - 1]: Data_t(0)); }
 
         /// Returns the weighted sum of x^n y
         Data_t XNY(unsigned int n) const
-          { return (n == 0)? y.Weights(): xy.Sum(n); }
+          { return (n == 0)? y: ((n <= Degree)? xy[n - 1]: Data_t(0)); }
 
 
         /// Returns the weighted sum of x^N
         template <unsigned int N>
         Data_t XN() const
-          { return SumExtractor<decltype(x)::Power, N>::Sum(s2, x); }
+          {
+            static_assert(N <= NXSums, "XN<N>(): N is too large");
+            if constexpr (N == 0) return s2; else return x[N - 1];
+          }
 
         /// Returns the weighted sum of x^N y
         template <unsigned int N>
         Data_t XNY() const
-          { return SumExtractor<decltype(xy)::Power, N>::Sum(y, xy); }
+          {
+            static_assert(N <= Degree, "XNY<N>(): N is too large");
+            if constexpr (N == 0) return y; else return xy[N - 1];
+          }
 
 
         /// Returns the weighted sum of y^2
-        Data_t Y2() const { return y2.template SumN<1>(); }
+        Data_t Y2() const { return y2; }
 
 
         /// @}
@@ -324,11 +383,15 @@ namespace lar {
 
           protected:
 
-        WeightTracker<Data_t> s2;        ///< accumulator for uncertainty
-        DataTracker<Degree*2, Data_t> x; ///< accumulator for variable x^k
-        WeightTracker<Data_t> y;         ///< accumulator for y
-        DataTracker<1, Data_t> y2;       ///< accumulator for y2
-        DataTracker<Degree, Data_t> xy;  ///< accumulator for variable xy
+        /// Number of sums of powers of x (x^1 to x^(2 Degree))
+        static constexpr unsigned int NXSums = Degree * 2;
+
+        int n = 0;                           ///< number of entries
+        Data_t s2 = Data_t(0);               ///< sum of 1/s^2
+        std::array<Data_t, NXSums> x {};     ///< sums of x^k/s^2 (k from 1)
+        Data_t y = Data_t(0);                ///< sum of y/s^2
+        Data_t y2 = Data_t(0);               ///< sum of y^2/s^2
+        std::array<Data_t, Degree> xy {};    ///< sums of x^k y/s^2 (k from 1)
 
       }; // class FitDataCollector<>
 
@@ -415,6 +478,31 @@ namespace lar {
         unsigned int add_with_uncertainty(Cont cont)
           { return stats.add_with_uncertainty(cont); }
 
+
+        unsigned int add_batch(
+          Data_t const* xs, Data_t const* ys, Data_t const* sys, std::size_t n
+          )
+          { return stats.add_batch(xs, ys, sys, n); }
+
+        unsigned int add_batch(Data_t const* xs, Data_t const* ys, std::size_t n)
+          { return stats.add_batch(xs, ys, n); }
+
+        ///@}
+
+
+        /// @{
+        /// @name Remove elements
+        /// @see FitDataCollector
+
+        bool remove(Data_t x, Data_t y, Data_t sy = Data_t(1.0))
+          { return stats.remove(x, y, sy); }
+
+        bool remove(Measurement_t value, Data_t sy = Data_t(1.0))
+          { return stats.remove(value, sy); }
+
+        bool remove(MeasurementAndUncertainty_t value)
+          { return stats.remove(value); }
+
         ///@}
 
         /// Clears all the statistics
@@ -822,6 +910,52 @@ namespace lar {
       }; // class SimplePolyFitterBase<>
 
 
+      /**
+       * @brief Computes the @f$ \chi^{2} @f$ of a polynomial fit from its sums
+       * @tparam T type of the data
+       * @tparam D degree of the polynomial
+       *
+       * The sums are read from an object `sums` with the same `XN<N>()`,
+       * `XNY<N>()` and `Y2()` interface as `FitDataCollector`, so that the
+       * single fitters and the batch fitters share the same expression.
+       * Only degrees 1 and 2 are supported.
+       */
+      template <typename T, unsigned int D>
+      struct PolyChiSquare;
+
+      template <typename T>
+      struct PolyChiSquare<T, 1U> {
+        template <typename Sums>
+        static T compute(std::array<T, 2U> const& fit_params, Sums const& sums)
+          {
+            const T b = fit_params[0];
+            const T a = fit_params[1];
+            return sums.Y2() + a*a * sums.template XN<2>()
+              + b*b * sums.template XN<0>()
+              + T(2) * (
+                a * b * sums.template XN<1>()
+                - a * sums.template XNY<1>() - b * sums.template XNY<0>()
+              );
+          } // compute()
+      }; // PolyChiSquare<T, 1>
+
+      template <typename T>
+      struct PolyChiSquare<T, 2U> {
+        template <typename Sums>
+        static T compute(std::array<T, 3U> const& a, Sums const& sums)
+          {
+            auto const& s = sums;
+            return s.Y2() - T(2) * (a[0]*s.template XNY<0>()
+                + a[1]*s.template XNY<1>() + a[2]*s.template XNY<2>())
+              + a[0]*a[0]*s.template XN<0>() + T(2) * a[0] * (
+                a[1]*s.template XN<1>() + a[2]*s.template XN<2>())
+              + a[1]*a[1]*s.template XN<2>() + T(2) * a[1] * (
+                a[2]*s.template XN<3>())
+              + a[2]*a[2]*s.template XN<4>();
+          } // compute()
+      }; // PolyChiSquare<T, 2>
+
+
     } // namespace details
 
 
@@ -1014,6 +1148,9 @@ namespace lar {
      * not documented here -- see the base class(es) documentation
      * (mostly SimplePolyFitterBase).
      */
+    template <typename T>
+    class GaussianFitBatch;
+
     template <typename T>
     class GaussianFit: public details::SimpleFitterInterface<T, 3> {
       using Base_t = details::SimpleFitterInterface<T, 3>; ///< base class
@@ -1093,6 +1230,45 @@ namespace lar {
         { return add_with_uncertainty(std::begin(cont), std::end(cont)); }
 
 
+      /**
+       * @brief Adds measurements from contiguous arrays
+       * @param xs array of the x values
+       * @param ys array of the y values
+       * @param sys array of the uncertainties on y (`nullptr`: all 1)
+       * @param n number of points in the arrays
+       * @return number of points added
+       * @see `details::FitDataCollector::add_batch()`
+       *
+       * The values are converted in blocks and added to the quadratic fit
+       * with its `add_batch()`. Non-positive values are ignored.
+       */
+      unsigned int add_batch(
+        Data_t const* xs, Data_t const* ys, Data_t const* sys, std::size_t n
+        );
+
+      unsigned int add_batch(Data_t const* xs, Data_t const* ys, std::size_t n)
+        { return add_batch(xs, ys, nullptr, n); }
+
+
+      /**
+       * @brief Removes a previously added entry
+       * @return whether the point was removed
+       * @see `details::FitDataCollector::remove()`
+       *
+       * Non-positive values are ignored, as they are by `add()`.
+       */
+      bool remove(Data_t x, Data_t y, Data_t sy = Data_t(1.0));
+
+      bool remove(Measurement_t value, Data_t sy = Data_t(1.0))
+        { return remove(std::get<0>(value), std::get<1>(value), sy); }
+
+      bool remove(MeasurementAndUncertainty_t value)
+        {
+          return
+            remove(std::get<0>(value), std::get<1>(value), std::get<2>(value));
+        }
+
+
       /// Clears all the input statistics
       void clear() { fitter.clear(); }
 
@@ -1239,6 +1415,8 @@ namespace lar {
       static Data_t Evaluate(Data_t x, Data_t const* params);
 
         protected:
+      friend class GaussianFitBatch<T>;
+
       Fitter_t fitter; ///< the actual fitter and data holder
 
       /// @{
@@ -1428,6 +1606,399 @@ namespace lar {
     }; // class GaussianFit<>
 
 
+    /** ************************************************************************
+     * @brief Performs many independent polynomial fits at once
+     * @tparam T type of the quantities
+     * @tparam D degree of the polynomial
+     * @see LinearFitBatch, QuadraticFitBatch
+     *
+     * This class is meant for the case where many small fits are needed,
+     * like one for each hit cluster or waveform in an event.
+     * Each fit is identified by its index. The sums of all the fits are kept
+     * in "structure of arrays" layout (one array for each sum, with an entry
+     * per fit), and all the fits are solved together by `Fit()`, with no
+     * virtual calls and computing each matrix determinant only once.
+     * The results are then available for each fit, and for all the fits at
+     * once as arrays (`Parameters()`, `ChiSquares()`).
+     *
+     *     lar::util::LinearFitBatch<double> fits(clusters.size());
+     *     fits.add_groups(offsets.data(), x.data(), y.data(), sy.data());
+     *     fits.Fit();
+     *     for (std::size_t i = 0; i < fits.size(); ++i)
+     *       if (fits.isValid(i)) slopes[i] = fits.FitParameters(i)[1];
+     *
+     * The results match exactly (same operations in the same order) the ones
+     * of `LinearFit` and `QuadraticFit` with the same points added with
+     * `add()` in the same order; when points are added with `add_batch()`
+     * the sums carry a rounding difference as described in
+     * `details::FitDataCollector::add_batch()`.
+     *
+     * Contrary to the single fitters, invalid fits do not throw: `isValid()`
+     * is `false` for them and their results are set to 0.
+     */
+    template <typename T, unsigned int D>
+    class PolyFitBatch {
+      using Collector_t = details::FitDataCollector<T, D>;
+      using SimpleFitter_t = details::SimplePolyFitterBase<T, D>;
+
+        public:
+      /// Degree of the fit
+      static constexpr unsigned int Degree = D;
+
+      /// Number of parameters in each fit
+      static constexpr unsigned int NParams = Degree + 1;
+
+      using Data_t = T; ///< type of the data
+
+      using MatrixOps = details::FastMatrixOperations<Data_t, NParams>;
+
+      /// type of set of fit parameters
+      using FitParameters_t = std::array<Data_t, NParams>;
+
+      /// type of matrix for covariance (a std::array)
+      using FitMatrix_t = typename MatrixOps::Matrix_t;
+
+      /// Constructor: prepares the specified number of (empty) fits
+      explicit PolyFitBatch(std::size_t nFits = 0U) { resize(nFits); }
+
+      /// Sets the number of fits, and removes all their data and results
+      void resize(std::size_t nFits);
+
+      /// Removes all the data and results, keeping the number of fits
+      void clear() { resize(size()); }
+
+      /// Returns the number of fits
+      std::size_t size() const { return n.size(); }
+
+
+      /// @{
+      /// @name Add elements
+
+      /**
+       * @brief Adds one entry to the specified fit
+       * @param iFit index of the fit
+       * @param x value of x
+       * @param y value of y
+       * @param sy value of uncertainty on y (1 by default)
+       * @return whether the point was added
+       * @see `details::FitDataCollector::add()`
+       */
+      bool add(std::size_t iFit, Data_t x, Data_t y, Data_t sy = Data_t(1.0));
+
+      /**
+       * @brief Adds entries from contiguous arrays to the specified fit
+       * @return number of points added
+       * @see `details::FitDataCollector::add_batch()`
+       */
+      unsigned int add_batch(
+        std::size_t iFit,
+        Data_t const* xs, Data_t const* ys, Data_t const* sys, std::size_t nPoints
+        );
+
+      /**
+       * @brief Adds entries to all the fits from contiguous arrays
+       * @tparam Offset type of the offsets (an integral type)
+       * @param offsets (`size() + 1` elements) first point of each fit
+       * @param xs array of the x values
+       * @param ys array of the y values
+       * @param sys array of the uncertainties on y (`nullptr`: all 1)
+       * @return number of points added
+       *
+       * The points of the fit `i` are the ones from `offsets[i]` to
+       * `offsets[i + 1]` (excluded). They are added one by one as with
+       * `add()`.
+       */
+      template <typename Offset>
+      std::size_t add_groups(
+        Offset const* offsets,
+        Data_t const* xs, Data_t const* ys, Data_t const* sys = nullptr
+        );
+
+      /// @}
+
+
+      /// @{
+      /// @name Fitting
+
+      /// Solves all the fits
+      void Fit();
+
+      /// Returns whether the fit has valid results (after `Fit()`)
+      bool isValid(std::size_t iFit) const { return valid[iFit]; }
+
+      /// Returns the number of points in the fit
+      int N(std::size_t iFit) const { return n[iFit]; }
+
+      /// Returns the degrees of freedom of the fit
+      int NDF(std::size_t iFit) const { return N(iFit) - NParams; }
+
+      /// Returns the parameters of the fit (after `Fit()`)
+      FitParameters_t FitParameters(std::size_t iFit) const;
+
+      /// Returns the errors on the parameters of the fit (after `Fit()`)
+      FitParameters_t FitParameterErrors(std::size_t iFit) const;
+
+      /// Returns the covariance matrix of the fit (after `Fit()`)
+      FitMatrix_t FitParameterCovariance(std::size_t iFit) const;
+
+      /// Returns the @f$ \chi^{2} @f$ of the fit (after `Fit()`)
+      Data_t ChiSquare(std::size_t iFit) const { return chi2[iFit]; }
+
+      /// Returns the parameter `iParam` of all the fits (after `Fit()`)
+      std::vector<Data_t> const& Parameters(unsigned int iParam) const
+        { return params[iParam]; }
+
+      /// Returns the @f$ \chi^{2} @f$ of all the fits (after `Fit()`)
+      std::vector<Data_t> const& ChiSquares() const { return chi2; }
+
+      /// @}
+
+
+      /// Returns the weighted sum of x^k of the fit
+      Data_t XN(std::size_t iFit, unsigned int k) const
+        { return (k == 0)? s2[iFit]: x[k - 1][iFit]; }
+
+      /// Returns the weighted sum of x^k y of the fit
+      Data_t XNY(std::size_t iFit, unsigned int k) const
+        { return (k == 0)? y[iFit]: xy[k - 1][iFit]; }
+
+      /// Returns the weighted sum of y^2 of the fit
+      Data_t Y2(std::size_t iFit) const { return y2[iFit]; }
+
+
+        protected:
+
+      /// Number of sums of powers of x (x^1 to x^(2 Degree))
+      static constexpr unsigned int NXSums = Degree * 2;
+
+      /// Access to the sums of a single fit, with collector interface
+      struct SumsView {
+        PolyFitBatch const& batch;
+        std::size_t iFit;
+
+        template <unsigned int K>
+        Data_t XN() const { return batch.XN(iFit, K); }
+        template <unsigned int K>
+        Data_t XNY() const { return batch.XNY(iFit, K); }
+        Data_t Y2() const { return batch.Y2(iFit); }
+      }; // SumsView
+
+      // sums, one entry per fit
+      std::vector<int> n;                          ///< number of entries
+      std::vector<Data_t> s2;                      ///< sum of 1/s^2
+      std::array<std::vector<Data_t>, NXSums> x;   ///< sums of x^k/s^2
+      std::vector<Data_t> y;                       ///< sum of y/s^2
+      std::vector<Data_t> y2;                      ///< sum of y^2/s^2
+      std::array<std::vector<Data_t>, Degree> xy;  ///< sums of x^k y/s^2
+
+      // results, one entry per fit
+      std::vector<char> valid;                     ///< whether fit is valid
+      std::array<std::vector<Data_t>, NParams> params; ///< fit parameters
+      std::array<std::vector<Data_t>, NParams * NParams> cov; ///< covariance
+      std::vector<Data_t> chi2;                    ///< chi^2 of the fit
+
+      /// Fills the matrix of x^n sum coefficients of the fit
+      FitMatrix_t MakeMatrixX(std::size_t iFit) const;
+
+    }; // class PolyFitBatch<>
+
+
+    /// Many independent linear fits at once (see `PolyFitBatch`)
+    template <typename T>
+    using LinearFitBatch = PolyFitBatch<T, 1U>;
+
+    /// Many independent quadratic fits at once (see `PolyFitBatch`)
+    template <typename T>
+    using QuadraticFitBatch = PolyFitBatch<T, 2U>;
+
+
+    /** ************************************************************************
+     * @brief Performs many independent "fast" Gaussian fits at once
+     * @tparam T type of the quantities
+     * @see GaussianFit, PolyFitBatch
+     *
+     * This is the batch version of `GaussianFit`, based on a
+     * `QuadraticFitBatch`. The values are encoded as in `GaussianFit`
+     * (non-positive values are ignored) and the parameters are converted in
+     * the same way after `Fit()`.
+     * `FitParameters()` and `FitParameterErrors()` match the ones of
+     * `GaussianFit`, `ChiSquare()` is the one of the internal quadratic fit.
+     */
+    template <typename T>
+    class GaussianFitBatch {
+      using Fitter_t = QuadraticFitBatch<T>; ///< type of internal fitter
+      using SingleFit_t = GaussianFit<T>; ///< corresponding single fit
+
+        public:
+      /// Number of parameters in the fit
+      static constexpr unsigned int NParams = Fitter_t::NParams;
+
+      using Data_t = T; ///< type of the data
+      using FitParameters_t = typename Fitter_t::FitParameters_t;
+
+      /// Constructor: prepares the specified number of (empty) fits
+      explicit GaussianFitBatch(std::size_t nFits = 0U) { resize(nFits); }
+
+      /// Sets the number of fits, and removes all their data and results
+      void resize(std::size_t nFits);
+
+      /// Removes all the data and results, keeping the number of fits
+      void clear() { resize(size()); }
+
+      /// Returns the number of fits
+      std::size_t size() const { return fitter.size(); }
+
+      /// Adds one entry to the specified fit (see `GaussianFit::add()`)
+      bool add(std::size_t iFit, Data_t x, Data_t y, Data_t sy = Data_t(1.0));
+
+      /// Adds entries to all the fits (see `PolyFitBatch::add_groups()`)
+      template <typename Offset>
+      std::size_t add_groups(
+        Offset const* offsets,
+        Data_t const* xs, Data_t const* ys, Data_t const* sys = nullptr
+        );
+
+      /// Solves all the fits
+      void Fit();
+
+      /// Returns whether the fit has valid results (after `Fit()`)
+      bool isValid(std::size_t iFit) const { return fitter.isValid(iFit); }
+
+      /// Returns the number of points in the fit
+      int N(std::size_t iFit) const { return fitter.N(iFit); }
+
+      /// Returns the degrees of freedom of the fit
+      int NDF(std::size_t iFit) const { return fitter.NDF(iFit); }
+
+      /// Returns the Gaussian parameters (amplitude, mean, sigma)
+      FitParameters_t FitParameters(std::size_t iFit) const;
+
+      /// Returns the errors on the Gaussian parameters
+      FitParameters_t FitParameterErrors(std::size_t iFit) const;
+
+      /// Returns the @f$ \chi^{2} @f$ of the internal quadratic fit
+      Data_t ChiSquare(std::size_t iFit) const
+        { return fitter.ChiSquare(iFit); }
+
+      /// Returns the internal fitter
+      Fitter_t const& Fitter() const { return fitter; }
+
+        protected:
+      Fitter_t fitter; ///< the actual fitter and data holder
+
+      std::array<std::vector<Data_t>, NParams> params; ///< Gaussian parameters
+      std::array<std::vector<Data_t>, NParams> errors; ///< parameter errors
+
+    }; // class GaussianFitBatch<>
+
+
+    /** ************************************************************************
+     * @brief Performs a fit on each position of a window sliding on data
+     * @tparam Fitter type of fitter (`LinearFit`, `QuadraticFit`, ...)
+     *
+     * The data is a sequence of points, and a window of `windowSize()`
+     * consecutive points is moved along it by one point at a time.
+     * For each position of the window, a fit of the points in the window is
+     * performed.
+     * Instead of filling a new fitter for each position, the fitter is updated
+     * by removing the point leaving the window and adding the one entering it
+     * (the fitter needs to support `remove()`): each step takes a constant
+     * time, independent of the size of the window.
+     *
+     * Removing points accumulates rounding errors in the statistics of the
+     * fitter. To keep them under control, the fitter is refilled from scratch
+     * every `refreshPeriod()` steps (`0` disables the refill). In addition,
+     * the fitter is filled with x values relative to an origin, which is the
+     * x of the first point of the window at the last refill: this keeps the
+     * power sums small, which greatly reduces the loss of precision from the
+     * subtractions when the window is far from x = 0.
+     * The fit parameters are therefore relative to that origin (for example,
+     * a linear fit describes `y = a + b (x - origin)`).
+     *
+     * Example:
+     *
+     *     lar::util::SlidingWindowFit<lar::util::LinearFit<double>> scanner(8);
+     *     for (auto const& result: scanner.fit(x.data(), y.data(), x.size()))
+     *       if (result.valid) slopes.push_back(result.params[1]);
+     *
+     */
+    template <typename Fitter>
+    class SlidingWindowFit {
+        public:
+      using Fitter_t = Fitter; ///< type of fitter
+      using Data_t = typename Fitter_t::Data_t; ///< type of the data
+
+      /// type of set of fit parameters
+      using FitParameters_t = typename Fitter_t::FitParameters_t;
+
+      /// Default number of steps between refills of the fitter
+      static constexpr std::size_t DefaultRefreshPeriod = 1024U;
+
+      /// Result of the fit in one position of the window
+      struct Result_t {
+        std::size_t first = 0U; ///< index of the first point in the window
+        Data_t origin = Data_t(0); ///< x origin of the fit parameters
+        bool valid = false; ///< whether the fit succeeded
+        FitParameters_t params {}; ///< fit parameters (if `valid`)
+        Data_t chi2 = Data_t(0); ///< fit @f$ \chi^{2} @f$ (if `valid`)
+        int NDF = 0; ///< degrees of freedom of the fit
+      }; // Result_t
+
+      /**
+       * @brief Constructor: sets the window size
+       * @param windowSize number of points in each window
+       * @param refreshPeriod steps between refills of the fitter (0: never)
+       * @throws std::invalid_argument if `windowSize` is 0
+       */
+      explicit SlidingWindowFit(
+        std::size_t windowSize,
+        std::size_t refreshPeriod = DefaultRefreshPeriod
+        );
+
+      /// Returns the number of points in each window
+      std::size_t windowSize() const { return fWindowSize; }
+
+      /// Returns the number of steps between refills of the fitter
+      std::size_t refreshPeriod() const { return fRefreshPeriod; }
+
+      /**
+       * @brief Calls `op` with the fitter for each position of the window
+       * @tparam Op type of the operation
+       * @param xs array of the x values
+       * @param ys array of the y values
+       * @param sys array of the uncertainties on y (`nullptr`: all 1)
+       * @param n number of points in the arrays
+       * @param op operation to be called
+       * @return the number of window positions
+       *
+       * The operation is called as `op(first, fitter, origin)`, with `first`
+       * the index of the first point in the window and `fitter` (constant)
+       * filled with the points of the window, with x relative to `origin`.
+       * If there are fewer than `windowSize()` points, `op` is never called.
+       */
+      template <typename Op>
+      std::size_t scan(
+        Data_t const* xs, Data_t const* ys, Data_t const* sys, std::size_t n,
+        Op&& op
+        ) const;
+
+      /// Fits each position of the window, and returns all the results
+      std::vector<Result_t> fit
+        (Data_t const* xs, Data_t const* ys, Data_t const* sys, std::size_t n)
+        const;
+
+      /// Fits each position of the window, with no uncertainty on y
+      std::vector<Result_t> fit
+        (Data_t const* xs, Data_t const* ys, std::size_t n) const
+        { return fit(xs, ys, nullptr, n); }
+
+        private:
+      std::size_t fWindowSize; ///< number of points in the window
+      std::size_t fRefreshPeriod; ///< steps between refills of the fitter
+
+    }; // class SlidingWindowFit<>
+
+
   } // namespace util
 } // namespace lar
 
@@ -1448,19 +2019,95 @@ bool lar::util::details::FitDataCollector<T, D>::add
   Data_t w = UncertaintyToWeight(sy);
   if (!std::isnormal(w)) return false;
   // the x section has a 1/s^2 weight; we track that weight separately
-  s2.add(w);
-  x.add(x_value, w);
+  ++n;
+  s2 += w;
+  Data_t xw = w;
+  for (Data_t& sum: x) sum += (xw *= x_value);
   // we treat the y section as if it were a x section with a y/s^2 weight;
   // we track that weight separately
   Data_t yw = y_value * w;
-  y.add(yw);
-  y2.add(sqr(y_value), w); // used only for chi^2
-  xy.add(x_value, yw);
+  y += yw;
+  y2 += w * sqr(y_value); // used only for chi^2
+  for (Data_t& sum: xy) sum += (yw *= x_value);
 
   return true; // we did add the value
 } // FitDataCollector<>::add()
 
 
+template <typename T, unsigned int D>
+bool lar::util::details::FitDataCollector<T, D>::remove
+  (Data_t x_value, Data_t y_value, Data_t sy /* = Data_t(1.0) */)
+{
+  Data_t w = UncertaintyToWeight(sy);
+  if (!std::isnormal(w)) return false;
+  if (--n <= 0) { // no entries left: start again from an exact 0
+    clear();
+    return true;
+  }
+  // the same operations as add(), with subtraction
+  s2 -= w;
+  Data_t xw = w;
+  for (Data_t& sum: x) sum -= (xw *= x_value);
+  Data_t yw = y_value * w;
+  y -= yw;
+  y2 -= w * sqr(y_value);
+  for (Data_t& sum: xy) sum -= (yw *= x_value);
+
+  return true; // we did remove the value
+} // FitDataCollector<>::remove()
+
+
+template <typename T, unsigned int D>
+unsigned int lar::util::details::FitDataCollector<T, D>::add_batch
+  (Data_t const* xs, Data_t const* ys, Data_t const* sys, std::size_t nPoints)
+{
+  constexpr unsigned int L = BatchLanes;
+
+  // partial sums, one per lane
+  std::array<int, L> laneN {};
+  std::array<Data_t, L> laneS2 {}, laneY {}, laneY2 {};
+  std::array<std::array<Data_t, L>, NXSums> laneX {};
+  std::array<std::array<Data_t, L>, Degree> laneXY {};
+
+  // adds the point i to the lane l; points which add() would skip
+  // contribute exactly 0 (values are masked too, in case they are not finite)
+  auto accumulate = [&](std::size_t i, unsigned int l)
+    {
+      Data_t const w0 = sys? UncertaintyToWeight(sys[i]): Data_t(1);
+      bool const good = std::isnormal(w0);
+      Data_t const w = good? w0: Data_t(0);
+      Data_t const xv = good? xs[i]: Data_t(0);
+      Data_t const yv = good? ys[i]: Data_t(0);
+      laneN[l] += good;
+      laneS2[l] += w;
+      Data_t xw = w;
+      for (unsigned int k = 0; k < NXSums; ++k) laneX[k][l] += (xw *= xv);
+      Data_t yw = yv * w;
+      laneY[l] += yw;
+      laneY2[l] += w * sqr(yv);
+      for (unsigned int k = 0; k < Degree; ++k) laneXY[k][l] += (yw *= xv);
+    };
+
+  std::size_t i = 0;
+  for (; i + L <= nPoints; i += L)
+    for (unsigned int l = 0; l < L; ++l) accumulate(i + l, l);
+  for (; i < nPoints; ++i) accumulate(i, 0);
+
+  // reduction
+  int added = 0;
+  for (unsigned int l = 0; l < L; ++l) {
+    added += laneN[l];
+    s2 += laneS2[l];
+    y += laneY[l];
+    y2 += laneY2[l];
+    for (unsigned int k = 0; k < NXSums; ++k) x[k] += laneX[k][l];
+    for (unsigned int k = 0; k < Degree; ++k) xy[k] += laneXY[k][l];
+  } // for
+  n += added;
+  return added;
+} // FitDataCollector<>::add_batch()
+
+
 template <typename T, unsigned int D>
 template <typename Iter, typename Pred>
 void lar::util::details::FitDataCollector<T, D>::add_without_uncertainty
@@ -1507,28 +2154,29 @@ unsigned int lar::util::details::FitDataCollector<T, D>::add_with_uncertainty
 
 template <typename T, unsigned int D>
 inline void lar::util::details::FitDataCollector<T, D>::clear() {
-  s2.clear();
-  x.clear();
-  y.clear();
-  y2.clear();
-  xy.clear();
+  n = 0;
+  s2 = Data_t(0);
+  x.fill(Data_t(0));
+  y = Data_t(0);
+  y2 = Data_t(0);
+  xy.fill(Data_t(0));
 } // FitDataCollector<>::clear()
 
 
 template <typename T, unsigned int D> template <typename Stream>
 void lar::util::details::FitDataCollector<T, D>::Print(Stream& out) const {
 
-  out << "Sums  1/s^2=" << s2.Weights()
-    << "\n      x/s^2=" << x.template SumN<1>();
-  for (unsigned int degree = 2; degree <= x.Power; ++degree)
-    out << "\n    x^" << degree << "/s^2=" << x.Sum(degree);
+  out << "Sums  1/s^2=" << s2
+    << "\n      x/s^2=" << XN(1);
+  for (unsigned int degree = 2; degree <= NXSums; ++degree)
+    out << "\n    x^" << degree << "/s^2=" << XN(degree);
   out
-    << "\n      y/s^2=" << y.Weights()
-    << "\n    y^2/s^2=" << y2.Sum();
-  if (xy.Power >= 1)
-    out << "\n     xy/s^2=" << xy.template SumN<1>();
-  for (unsigned int degree = 2; degree <= xy.Power; ++degree)
-    out << "\n   x^" << degree << "y/s^2=" << xy.Sum(degree);
+    << "\n      y/s^2=" << y
+    << "\n    y^2/s^2=" << y2;
+  if (Degree >= 1)
+    out << "\n     xy/s^2=" << XNY(1);
+  for (unsigned int degree = 2; degree <= Degree; ++degree)
+    out << "\n   x^" << degree << "y/s^2=" << XNY(degree);
   out << std::endl;
 } // FitDataCollector<>::Print()
 
@@ -1755,11 +2403,8 @@ auto lar::util::details::SimplePolyFitterBase<T, D>::ChiSquare() const -> Data_t
 template <typename T>
 auto lar::util::LinearFit<T>::ChiSquare() const -> Data_t
 {
-  FitParameters_t fit_params = this->FitParameters();
-  const Data_t b = fit_params[0];
-  const Data_t a = fit_params[1];
-  return Y2() + sqr(a) * X2() + sqr(b) * I()
-    + Data_t(2) * (a * b * X2() - a * XY() - b * Y());
+  return details::PolyChiSquare<T, 1U>::compute
+    (this->FitParameters(), Base_t::stats);
 } // LinearFit<T>::ChiSquare()
 
 
@@ -1770,11 +2415,8 @@ auto lar::util::LinearFit<T>::ChiSquare() const -> Data_t
 template <typename T>
 auto lar::util::QuadraticFit<T>::ChiSquare() const -> Data_t
 {
-  FitParameters_t a = this->FitParameters();
-  return Y2()           - Data_t(2) *        (a[0]*Y() + a[1]*XY() + a[2]*X2Y())
-       + sqr(a[0])*I()  + Data_t(2) * a[0] * (           a[1]*X()  + a[2]*X2() )
-       + sqr(a[1])*X2() + Data_t(2) * a[1] * (                       a[2]*X3() )
-       + sqr(a[2])*X4();
+  return details::PolyChiSquare<T, 2U>::compute
+    (this->FitParameters(), Base_t::stats);
 } // QuadraticFit<T>::ChiSquare()
 
 
@@ -1795,6 +2437,16 @@ bool lar::util::GaussianFit<T>::add
 } // GaussianFit<T>::add(Data_t, Data_t, Data_t)
 
 
+template <typename T>
+bool lar::util::GaussianFit<T>::remove
+  (Data_t x, Data_t y, Data_t sy /* = Data_t(1.0) */)
+{
+  if (y <= Data_t(0)) return false; // non-positive values were not added
+  Value_t value = EncodeValue(Value_t(y, sy));
+  return fitter.remove(x, value.value(), value.error());
+} // GaussianFit<T>::remove(Data_t, Data_t, Data_t)
+
+
 template <typename T>
 template <typename Iter, typename Pred>
 void lar::util::GaussianFit<T>::add_without_uncertainty
@@ -1834,6 +2486,36 @@ unsigned int lar::util::GaussianFit<T>::add_with_uncertainty
 } // GaussianFit<T>::add_with_uncertainty()
 
 
+template <typename T>
+unsigned int lar::util::GaussianFit<T>::add_batch
+  (Data_t const* xs, Data_t const* ys, Data_t const* sys, std::size_t n)
+{
+  // values are encoded in blocks; non-positive values get a 0 uncertainty,
+  // which makes the quadratic fit skip them
+  constexpr std::size_t BlockSize = 256U;
+  std::array<Data_t, BlockSize> ey, esy;
+  unsigned int added = 0;
+  for (std::size_t start = 0; start < n; start += BlockSize) {
+    std::size_t const nBlock = std::min(BlockSize, n - start);
+    for (std::size_t i = 0; i < nBlock; ++i) {
+      Data_t const y = ys[start + i];
+      Data_t const sy = sys? sys[start + i]: Data_t(1.0);
+      if (y <= Data_t(0)) {
+        ey[i] = Data_t(0);
+        esy[i] = Data_t(0);
+        continue;
+      }
+      Value_t const value = EncodeValue(Value_t(y, sy));
+      ey[i] = value.value();
+      esy[i] = value.error();
+    } // for
+    added
+      += fitter.add_batch(xs + start, ey.data(), esy.data(), nBlock);
+  } // for blocks
+  return added;
+} // GaussianFit<T>::add_batch()
+
+
 //
 // fitting interface
 //
@@ -2043,6 +2725,332 @@ bool lar::util::GaussianFit<T>::isValid
 } // GaussianFit<>::isValid(FitParameters_t)
 
 
+//******************************************************************************
+//***  PolyFitBatch<>
+//***
+
+template <typename T, unsigned int D>
+void lar::util::PolyFitBatch<T, D>::resize(std::size_t nFits) {
+  n.assign(nFits, 0);
+  s2.assign(nFits, Data_t(0));
+  for (auto& sums: x) sums.assign(nFits, Data_t(0));
+  y.assign(nFits, Data_t(0));
+  y2.assign(nFits, Data_t(0));
+  for (auto& sums: xy) sums.assign(nFits, Data_t(0));
+
+  valid.assign(nFits, false);
+  for (auto& results: params) results.assign(nFits, Data_t(0));
+  for (auto& results: cov) results.assign(nFits, Data_t(0));
+  chi2.assign(nFits, Data_t(0));
+} // PolyFitBatch<>::resize()
+
+
+template <typename T, unsigned int D>
+bool lar::util::PolyFitBatch<T, D>::add
+  (std::size_t iFit, Data_t x_value, Data_t y_value, Data_t sy /* = 1.0 */)
+{
+  // same operations as FitDataCollector::add()
+  Data_t w = Collector_t::UncertaintyToWeight(sy);
+  if (!std::isnormal(w)) return false;
+  ++n[iFit];
+  s2[iFit] += w;
+  Data_t xw = w;
+  for (auto& sums: x) sums[iFit] += (xw *= x_value);
+  Data_t yw = y_value * w;
+  y[iFit] += yw;
+  y2[iFit] += w * Collector_t::sqr(y_value);
+  for (auto& sums: xy) sums[iFit] += (yw *= x_value);
+  return true;
+} // PolyFitBatch<>::add()
+
+
+template <typename T, unsigned int D>
+unsigned int lar::util::PolyFitBatch<T, D>::add_batch(
+  std::size_t iFit,
+  Data_t const* xs, Data_t const* ys, Data_t const* sys, std::size_t nPoints
+) {
+  Collector_t stats;
+  unsigned int const added = stats.add_batch(xs, ys, sys, nPoints);
+  n[iFit] += stats.N();
+  s2[iFit] += stats.XN(0);
+  for (unsigned int k = 1; k <= NXSums; ++k) x[k - 1][iFit] += stats.XN(k);
+  y[iFit] += stats.XNY(0);
+  y2[iFit] += stats.Y2();
+  for (unsigned int k = 1; k <= Degree; ++k) xy[k - 1][iFit] += stats.XNY(k);
+  return added;
+} // PolyFitBatch<>::add_batch()
+
+
+template <typename T, unsigned int D>
+template <typename Offset>
+std::size_t lar::util::PolyFitBatch<T, D>::add_groups(
+  Offset const* offsets,
+  Data_t const* xs, Data_t const* ys, Data_t const* sys /* = nullptr */
+) {
+  std::size_t added = 0;
+  for (std::size_t iFit = 0; iFit < size(); ++iFit) {
+    for (auto i = offsets[iFit]; i < offsets[iFit + 1]; ++i)
+      if (add(iFit, xs[i], ys[i], sys? sys[i]: Data_t(1.0))) ++added;
+  } // for
+  return added;
+} // PolyFitBatch<>::add_groups()
+
+
+template <typename T, unsigned int D>
+void lar::util::PolyFitBatch<T, D>::Fit() {
+
+  // the operations are the same as in SimplePolyFitterBase
+  for (std::size_t iFit = 0; iFit < size(); ++iFit) {
+    FitMatrix_t const Xmat = MakeMatrixX(iFit);
+    Data_t const det = MatrixOps::Determinant(Xmat);
+    bool const isValid = (n[iFit] > (int) Degree) && std::isnormal(det);
+    valid[iFit] = isValid;
+    if (!isValid) {
+      for (auto& results: params) results[iFit] = Data_t(0);
+      for (auto& results: cov) results[iFit] = Data_t(0);
+      chi2[iFit] = Data_t(0);
+      continue;
+    }
+
+    // parameters, with Cramer's rule
+    FitParameters_t fitParams;
+    for (unsigned int iParam = 0; iParam < NParams; ++iParam) {
+      FitMatrix_t XYmat(Xmat);
+      for (unsigned int i = 0; i < NParams; ++i)
+        XYmat[i * NParams + iParam] = XNY(iFit, i);
+      fitParams[iParam] = MatrixOps::Determinant(XYmat) / det;
+      params[iParam][iFit] = fitParams[iParam];
+    } // for
+
+    // covariance matrix
+    FitMatrix_t const Smat = MatrixOps::InvertSymmetricMatrix(Xmat, det);
+    for (unsigned int i = 0; i < Smat.size(); ++i) cov[i][iFit] = Smat[i];
+
+    chi2[iFit] = details::PolyChiSquare<T, D>::compute
+      (fitParams, SumsView{ *this, iFit });
+
+  } // for fits
+
+} // PolyFitBatch<>::Fit()
+
+
+template <typename T, unsigned int D>
+auto lar::util::PolyFitBatch<T, D>::FitParameters(std::size_t iFit) const
+  -> FitParameters_t
+{
+  FitParameters_t fitParams;
+  for (unsigned int i = 0; i < NParams; ++i) fitParams[i] = params[i][iFit];
+  return fitParams;
+} // PolyFitBatch<>::FitParameters()
+
+
+template <typename T, unsigned int D>
+auto lar::util::PolyFitBatch<T, D>::FitParameterErrors(std::size_t iFit) const
+  -> FitParameters_t
+{
+  return SimpleFitter_t::ExtractParameterErrors(FitParameterCovariance(iFit));
+} // PolyFitBatch<>::FitParameterErrors()
+
+
+template <typename T, unsigned int D>
+auto lar::util::PolyFitBatch<T, D>::FitParameterCovariance
+  (std::size_t iFit) const -> FitMatrix_t
+{
+  FitMatrix_t Smat;
+  for (unsigned int i = 0; i < Smat.size(); ++i) Smat[i] = cov[i][iFit];
+  return Smat;
+} // PolyFitBatch<>::FitParameterCovariance()
+
+
+template <typename T, unsigned int D>
+auto lar::util::PolyFitBatch<T, D>::MakeMatrixX(std::size_t iFit) const
+  -> FitMatrix_t
+{
+  FitMatrix_t Xmat;
+  for (unsigned int i = 0; i < NParams; ++i) { // row
+    for (unsigned int j = i; j < NParams; ++j) { // column
+      Xmat[j * NParams + i] = Xmat[i * NParams + j] = XN(iFit, i + j);
+    } // for j
+  } // for i
+  return Xmat;
+} // PolyFitBatch<>::MakeMatrixX()
+
+
+//******************************************************************************
+//***  GaussianFitBatch<>
+//***
+
+template <typename T>
+void lar::util::GaussianFitBatch<T>::resize(std::size_t nFits) {
+  fitter.resize(nFits);
+  for (auto& results: params) results.assign(nFits, Data_t(0));
+  for (auto& results: errors) results.assign(nFits, Data_t(0));
+} // GaussianFitBatch<>::resize()
+
+
+template <typename T>
+bool lar::util::GaussianFitBatch<T>::add
+  (std::size_t iFit, Data_t x, Data_t y, Data_t sy /* = Data_t(1.0) */)
+{
+  if (y <= Data_t(0)) return false; // ignore the non-positive values
+  auto const value
+    = SingleFit_t::EncodeValue(typename SingleFit_t::Value_t(y, sy));
+  return fitter.add(iFit, x, value.value(), value.error());
+} // GaussianFitBatch<>::add()
+
+
+template <typename T>
+template <typename Offset>
+std::size_t lar::util::GaussianFitBatch<T>::add_groups(
+  Offset const* offsets,
+  Data_t const* xs, Data_t const* ys, Data_t const* sys /* = nullptr */
+) {
+  std::size_t added = 0;
+  for (std::size_t iFit = 0; iFit < size(); ++iFit) {
+    for (auto i = offsets[iFit]; i < offsets[iFit + 1]; ++i)
+      if (add(iFit, xs[i], ys[i], sys? sys[i]: Data_t(1.0))) ++added;
+  } // for
+  return added;
+} // GaussianFitBatch<>::add_groups()
+
+
+template <typename T>
+void lar::util::GaussianFitBatch<T>::Fit() {
+
+  fitter.Fit();
+
+  for (std::size_t iFit = 0; iFit < size(); ++iFit) {
+    if (!fitter.isValid(iFit)) {
+      for (auto& results: params) results[iFit] = Data_t(0);
+      for (auto& results: errors) results[iFit] = Data_t(0);
+      continue;
+    }
+
+    // as GaussianFit::FitParameters()
+    FitParameters_t const gaussParams
+      = SingleFit_t::ConvertParameters(fitter.FitParameters(iFit));
+
+    // as GaussianFit::FitParameterErrors(): quadratic parameters from the
+    // covariance matrix, as in SimplePolyFitterBase::FillResults()
+    auto const Smat = fitter.FitParameterCovariance(iFit);
+    FitParameters_t Ymat;
+    for (unsigned int i = 0; i < NParams; ++i) Ymat[i] = fitter.XNY(iFit, i);
+    FitParameters_t const qpars
+      = Fitter_t::MatrixOps::MatrixVectorProduct(Smat, Ymat);
+    FitParameters_t dummy, gaussErrors;
+    SingleFit_t::ConvertParametersAndErrors(qpars, Smat, dummy, gaussErrors);
+
+    for (unsigned int i = 0; i < NParams; ++i) {
+      params[i][iFit] = gaussParams[i];
+      errors[i][iFit] = gaussErrors[i];
+    } // for
+  } // for fits
+
+} // GaussianFitBatch<>::Fit()
+
+
+template <typename T>
+auto lar::util::GaussianFitBatch<T>::FitParameters(std::size_t iFit) const
+  -> FitParameters_t
+{
+  FitParameters_t fitParams;
+  for (unsigned int i = 0; i < NParams; ++i) fitParams[i] = params[i][iFit];
+  return fitParams;
+} // GaussianFitBatch<>::FitParameters()
+
+
+template <typename T>
+auto lar::util::GaussianFitBatch<T>::FitParameterErrors(std::size_t iFit) const
+  -> FitParameters_t
+{
+  FitParameters_t fitErrors;
+  for (unsigned int i = 0; i < NParams; ++i) fitErrors[i] = errors[i][iFit];
+  return fitErrors;
+} // GaussianFitBatch<>::FitParameterErrors()
+
+//******************************************************************************
+//***  SlidingWindowFit<>
+//***
+
+template <typename Fitter>
+lar::util::SlidingWindowFit<Fitter>::SlidingWindowFit(
+  std::size_t windowSize,
+  std::size_t refreshPeriod /* = DefaultRefreshPeriod */
+)
+  : fWindowSize(windowSize)
+  , fRefreshPeriod(refreshPeriod)
+{
+  if (fWindowSize == 0U) {
+    throw std::invalid_argument
+      ("SlidingWindowFit: window size must be positive");
+  }
+} // SlidingWindowFit<>::SlidingWindowFit()
+
+
+template <typename Fitter>
+template <typename Op>
+std::size_t lar::util::SlidingWindowFit<Fitter>::scan(
+  Data_t const* xs, Data_t const* ys, Data_t const* sys, std::size_t n,
+  Op&& op
+) const {
+  if (n < fWindowSize) return 0U;
+
+  auto uncertainty
+    = [sys](std::size_t i){ return sys? sys[i]: Data_t(1.0); };
+  Fitter_t fitter;
+  Data_t origin = Data_t(0);
+  auto fill = [&](std::size_t first)
+    {
+      fitter.clear();
+      origin = xs[first];
+      for (std::size_t i = first; i < first + fWindowSize; ++i)
+        fitter.add(xs[i] - origin, ys[i], uncertainty(i));
+    };
+
+  fill(0U);
+  op(std::size_t(0U), static_cast<Fitter_t const&>(fitter), origin);
+
+  std::size_t const nPositions = n - fWindowSize + 1;
+  for (std::size_t first = 1U; first < nPositions; ++first) {
+    if ((fRefreshPeriod > 0U) && (first % fRefreshPeriod == 0U))
+      fill(first);
+    else {
+      std::size_t const leaving = first - 1, entering = first + fWindowSize - 1;
+      fitter.remove(xs[leaving] - origin, ys[leaving], uncertainty(leaving));
+      fitter.add(xs[entering] - origin, ys[entering], uncertainty(entering));
+    }
+    op(first, static_cast<Fitter_t const&>(fitter), origin);
+  } // for
+  return nPositions;
+} // SlidingWindowFit<>::scan()
+
+
+template <typename Fitter>
+auto lar::util::SlidingWindowFit<Fitter>::fit
+  (Data_t const* xs, Data_t const* ys, Data_t const* sys, std::size_t n) const
+  -> std::vector<Result_t>
+{
+  std::vector<Result_t> results;
+  if (n >= fWindowSize) results.reserve(n - fWindowSize + 1);
+  auto collect
+    = [&results](std::size_t first, Fitter_t const& fitter, Data_t origin)
+    {
+      Result_t result;
+      result.first = first;
+      result.origin = origin;
+      result.valid = fitter.isValid();
+      result.NDF = fitter.NDF();
+      if (result.valid) {
+        result.params = fitter.FitParameters();
+        result.chi2 = fitter.ChiSquare();
+      }
+      results.push_back(result);
+    };
+  scan(xs, ys, sys, n, collect);
+  return results;
+} // SlidingWindowFit<>::fit()
+
+
 //******************************************************************************
 
 
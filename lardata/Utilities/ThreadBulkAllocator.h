@@ -0,0 +1,503 @@
+/**
+ * @file   lardata/Utilities/ThreadBulkAllocator.h
+ * @brief  Thread-aware memory allocator for large amount of (small) objects.
+ * @date   October 19, 2026
+ * @see    lardata/Utilities/BulkAllocator.h
+ *
+ * This library is header-only.
+ */
+
+#ifndef LARDATA_UTILITIES_THREADBULKALLOCATOR_H
+#define LARDATA_UTILITIES_THREADBULKALLOCATOR_H
+
+// C/C++ standard libraries
+#include <unordered_map>
+#include <vector>
+#include <array>
+#include <memory> // std::unique_ptr<>
+#include <mutex>
+#include <thread> // std::this_thread
+#include <atomic>
+#include <new> // std::bad_alloc
+#include <stdexcept> // std::logic_error
+#include <algorithm> // std::max()
+#include <cstddef> // std::byte, std::max_align_t
+#include <cstdint> // std::uintptr_t, std::uint64_t
+
+
+namespace lar {
+
+  //----------------------------------------------------------------------------
+  /// Lifetime of the memory held by a `lar::ThreadBulkResource`.
+  enum class BulkArenaScope {
+    Job,     ///< Memory released on `endOf(Job)` or on destruction.
+    Event,   ///< Memory released on `endOf(Event)` (end of each event).
+    Explicit ///< Memory released only on explicit `release()` or destruction.
+  }; // enum class BulkArenaScope
+
+
+  //----------------------------------------------------------------------------
+  namespace details {
+    namespace bulk_allocator {
+
+      /**
+       * @brief Memory arena allocating memory in large chunks.
+       *
+       * The arena hands out memory from the current chunk, and starts a new
+       * chunk when that is exhausted. Memory returned by `recycle()` is kept
+       * in free lists sorted by block size, and reused by later requests of
+       * the same size class; blocks of a size class are always aligned to
+       * `Granularity`, so that they can serve requests of any alignment.
+       * The memory is returned to the system only by `release()` or on
+       * destruction.
+       *
+       * This object is not thread-safe: it is meant to be used by one thread
+       * at a time.
+       */
+      class BulkArena {
+          public:
+        /// Granularity of the block sizes in the free lists [bytes]
+        static constexpr std::size_t Granularity = alignof(std::max_align_t);
+
+        /// Number of size classes with a free list.
+        static constexpr std::size_t NSizeClasses = 32;
+
+        /// Constructor: sets the size of the chunks to be allocated [bytes].
+        explicit BulkArena(std::size_t chunkSize): fChunkSize(chunkSize) {}
+
+        /// Returns `bytes` of memory aligned to `align`.
+        void* allocate(std::size_t bytes, std::size_t align);
+
+        /// Makes the memory at `p` available for reuse by this arena.
+        void recycle(void* p, std::size_t bytes, std::size_t align) noexcept;
+
+        /// Returns all the memory to the system; all pointers become invalid.
+        void release() noexcept;
+
+        /// Returns the number of memory chunks currently allocated.
+        std::size_t nChunks() const { return fChunks.size(); }
+
+        /// Returns the total memory currently allocated [bytes].
+        std::size_t allocatedBytes() const { return fAllocated; }
+
+          private:
+        struct FreeBlock_t { FreeBlock_t* next; };
+
+        std::size_t fChunkSize; ///< Size of each new chunk [bytes].
+
+        std::vector<std::unique_ptr<std::byte[]>> fChunks; ///< Memory chunks.
+
+        std::byte* fCurrent = nullptr; ///< Next free byte in the last chunk.
+        std::byte* fEnd = nullptr; ///< End of the last chunk.
+        std::size_t fAllocated = 0; ///< Total allocated memory [bytes].
+
+        /// Free lists, one per size class.
+        std::array<FreeBlock_t*, NSizeClasses> fFreeLists {};
+
+        /// Returns the size class of `bytes`, or `NSizeClasses` if too large.
+        static std::size_t sizeClass(std::size_t bytes, std::size_t align)
+          {
+            if ((align > Granularity) || (bytes == 0)) return NSizeClasses;
+            std::size_t const iClass = (bytes - 1) / Granularity;
+            return std::min(iClass, NSizeClasses);
+          }
+
+        /// Allocates a new chunk of at least the specified size.
+        void newChunk(std::size_t minBytes);
+
+      }; // class BulkArena
+
+    } // namespace bulk_allocator
+  } // namespace details
+
+
+  //----------------------------------------------------------------------------
+  /**
+   * @brief Memory pool with one chunked arena per thread.
+   *
+   * This object owns a set of memory arenas, one for each thread which
+   * allocated memory from it. Each thread allocates from its own arena, which
+   * is accessed without locking after the first allocation, so that many
+   * threads can allocate concurrently (e.g. in a multithreaded _art_ module).
+   *
+   * As `lar::BulkAllocator`, memory is reserved in large chunks and it is
+   * released all at once. When the resource is configured to reuse freed
+   * memory, a deallocated block is added to the free lists of the arena of the
+   * thread deallocating it, even if a different thread allocated it: all
+   * arenas live as long as the resource, so memory can migrate between them.
+   * Otherwise deallocation does nothing at all.
+   *
+   * The lifetime of the memory is set by the scope (`lar::BulkArenaScope`):
+   * `endOf(scope)` releases all the memory only if `scope` is the one the
+   * resource was configured with, while `release()` always does.
+   * For example, a resource with `BulkArenaScope::Event` scope may be owned
+   * by a module, which calls `endOf(lar::BulkArenaScope::Event)` at the end of
+   * each event. Releasing memory is not thread-safe, and it is a logic error
+   * to do it while any other thread is using the resource or any of the
+   * memory allocated from it.
+   *
+   * Allocators of type `lar::ThreadBulkAllocator` use this resource.
+   */
+  class ThreadBulkResource {
+      public:
+
+    /// Configuration of the resource.
+    struct Config_t {
+      /// Memory lifetime.
+      BulkArenaScope scope = BulkArenaScope::Job;
+      /// Size of the memory chunks allocated by each thread [bytes].
+      std::size_t chunkSize = DefaultChunkSize;
+      /// Whether to reuse deallocated memory (in the deallocating thread).
+      bool reuseFreed = true;
+    }; // Config_t
+
+    /// Default size of the memory chunks [bytes].
+    static constexpr std::size_t DefaultChunkSize = 1024 * 1024;
+
+    /// Constructor with default configuration.
+    ThreadBulkResource(): ThreadBulkResource(Config_t{}) {}
+
+    /// Constructor: uses the specified configuration.
+    explicit ThreadBulkResource(Config_t const& config)
+      : fConfig(config), fSerial(nextSerial())
+      {
+        if (fConfig.chunkSize == 0) {
+          throw std::logic_error
+            ("lar::ThreadBulkResource: chunk size must not be 0");
+        }
+      }
+
+    // the thread arenas are bound to this very object: no copy nor move
+    ThreadBulkResource(ThreadBulkResource const&) = delete;
+    ThreadBulkResource(ThreadBulkResource&&) = delete;
+    ThreadBulkResource& operator= (ThreadBulkResource const&) = delete;
+    ThreadBulkResource& operator= (ThreadBulkResource&&) = delete;
+
+
+    /// Returns `bytes` of memory aligned to `align` from the thread arena.
+    void* allocate
+      (std::size_t bytes, std::size_t align = alignof(std::max_align_t))
+      { return threadArena().allocate(bytes, align); }
+
+    /// Returns memory to the pool (reused only if so configured).
+    void deallocate(
+      void* p, std::size_t bytes,
+      std::size_t align = alignof(std::max_align_t)
+      ) noexcept
+      {
+        if (!fConfig.reuseFreed || !p) return;
+        threadArena().recycle(p, bytes, align);
+      }
+
+    /// Releases all memory if `scope` is the one of this resource.
+    /// @return whether the memory was released
+    bool endOf(BulkArenaScope scope)
+      {
+        if (scope != fConfig.scope) return false;
+        release();
+        return true;
+      }
+
+    /// Releases all the memory of all threads; all pointers become invalid.
+    void release() noexcept;
+
+
+    /// Returns the scope of the memory of this resource.
+    BulkArenaScope scope() const { return fConfig.scope; }
+
+    /// Returns the size of the memory chunks [bytes].
+    std::size_t chunkSize() const { return fConfig.chunkSize; }
+
+    /// Returns whether deallocated memory is reused.
+    bool reusesFreed() const { return fConfig.reuseFreed; }
+
+    /// Returns the number of threads which have used this resource.
+    std::size_t nArenas() const;
+
+    /// Returns the number of chunks allocated by all threads.
+    std::size_t nChunks() const;
+
+    /// Returns the total memory allocated by all threads [bytes].
+    std::size_t allocatedBytes() const;
+
+
+    /// Returns a resource shared by all the default-constructed allocators.
+    static ThreadBulkResource& global()
+      { static ThreadBulkResource resource; return resource; }
+
+
+      private:
+    using Arena_t = details::bulk_allocator::BulkArena;
+
+    /// Cache of the last arenas used by a thread.
+    struct ArenaCache_t {
+      /// Number of resources remembered by each thread.
+      static constexpr std::size_t NEntries = 4;
+
+      struct Entry_t {
+        std::uint64_t serial = 0; ///< Serial number of the owning resource.
+        Arena_t* arena = nullptr; ///< Arena of this thread in that resource.
+      };
+
+      std::array<Entry_t, NEntries> entries; ///< Recently used arenas.
+      std::size_t next = 0; ///< Entry to be replaced next.
+    }; // ArenaCache_t
+
+    Config_t const fConfig; ///< Configuration.
+
+    /// Unique identifier of this resource (never reused).
+    std::uint64_t const fSerial;
+
+    mutable std::mutex fArenaMutex; ///< Protects the arena registry.
+
+    /// Arena of each thread.
+    std::unordered_map<std::thread::id, std::unique_ptr<Arena_t>> fArenas;
+
+    /// Returns the arena of the current thread, creating it if needed.
+    Arena_t& threadArena()
+      {
+        ArenaCache_t& cache = threadCache();
+        for (auto const& entry: cache.entries)
+          if (entry.serial == fSerial) return *(entry.arena);
+
+        auto& entry = cache.entries[cache.next];
+        cache.next = (cache.next + 1) % ArenaCache_t::NEntries;
+        entry.arena = &registerThreadArena();
+        entry.serial = fSerial;
+        return *(entry.arena);
+      } // threadArena()
+
+    /// Returns the arena of the current thread from the registry.
+    Arena_t& registerThreadArena();
+
+    /// Returns the arena cache of the current thread.
+    static ArenaCache_t& threadCache()
+      { thread_local ArenaCache_t cache; return cache; }
+
+    /// Returns a new unique serial number.
+    static std::uint64_t nextSerial()
+      {
+        static std::atomic<std::uint64_t> counter { 0 };
+        return ++counter;
+      }
+
+  }; // class ThreadBulkResource
+
+
+  //----------------------------------------------------------------------------
+  /**
+   * @brief Thread-aware allocator reserving a lot of memory in advance.
+   * @tparam T type being allocated
+   * @see `lar::ThreadBulkResource`
+   *
+   * This allocator behaves like `lar::BulkAllocator` (large chunks reserved in
+   * advance, memory released all together), but it can be used concurrently
+   * by many threads. It is a thin handle to a `lar::ThreadBulkResource`, which
+   * owns the memory: each thread gets its own memory arena, and the lifetime
+   * of the memory is decided by the resource scope.
+   *
+   * Allocators created with the default constructor all share the same
+   * resource, `lar::ThreadBulkResource::global()`, with job scope.
+   * Containers with a different lifetime should be given an allocator
+   * constructed on a dedicated resource:
+   * @code
+   * lar::ThreadBulkResource eventMemory
+   *   ({ lar::BulkArenaScope::Event, 1024 * 1024, true });
+   * using Map_t = std::map<int, int, std::less<int>,
+   *   lar::ThreadBulkAllocator<std::pair<const int, int>>>;
+   * {
+   *   Map_t hits(Map_t::key_compare(), Map_t::allocator_type(eventMemory));
+   *   // ...
+   * } // all containers using eventMemory must be gone before releasing it
+   * eventMemory.endOf(lar::BulkArenaScope::Event);
+   * @endcode
+   *
+   * Differently from `lar::BulkAllocator`, the allocator is stateful, and
+   * rebinding preserves the resource.
+   */
+  template <typename T>
+  class ThreadBulkAllocator {
+      public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    template <typename U>
+    struct rebind { using other = ThreadBulkAllocator<U>; };
+
+    /// Default constructor: uses the global resource.
+    ThreadBulkAllocator() noexcept
+      : ThreadBulkAllocator(ThreadBulkResource::global()) {}
+
+    /// Constructor: allocates memory from the specified resource.
+    ThreadBulkAllocator(ThreadBulkResource& resource) noexcept
+      : fResource(&resource) {}
+
+    /// Conversion from an allocator of another type: same resource.
+    template <typename U>
+    ThreadBulkAllocator(ThreadBulkAllocator<U> const& other) noexcept
+      : fResource(&other.resource()) {}
+
+    /// Allocates memory for `n` elements.
+    T* allocate(size_type n)
+      {
+        return static_cast<T*>
+          (fResource->allocate(n * sizeof(T), alignof(T)));
+      }
+
+    /// Returns to the resource the memory of `n` elements at `p`.
+    void deallocate(T* p, size_type n) noexcept
+      { fResource->deallocate(p, n * sizeof(T), alignof(T)); }
+
+    /// Returns the resource this allocator uses.
+    ThreadBulkResource& resource() const { return *fResource; }
+
+      private:
+    ThreadBulkResource* fResource; ///< Resource providing the memory.
+
+  }; // class ThreadBulkAllocator<>
+
+
+  /// Allocators are equal if they share the same resource.
+  template <typename T, typename U>
+  bool operator==
+    (ThreadBulkAllocator<T> const& a, ThreadBulkAllocator<U> const& b)
+    { return &a.resource() == &b.resource(); }
+
+  template <typename T, typename U>
+  bool operator!=
+    (ThreadBulkAllocator<T> const& a, ThreadBulkAllocator<U> const& b)
+    { return !(a == b); }
+
+
+} // namespace lar
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+namespace lar {
+  namespace details {
+    namespace bulk_allocator {
+
+      //------------------------------------------------------------------------
+      inline void* BulkArena::allocate(std::size_t bytes, std::size_t align) {
+        if (bytes == 0) bytes = 1;
+
+        std::size_t const iClass = sizeClass(bytes, align);
+        if (iClass < NSizeClasses) {
+          // all the blocks in a size class have the same (rounded) size and
+          // the largest alignment, since the free list serves any alignment
+          bytes = (iClass + 1) * Granularity;
+          align = Granularity;
+          if (FreeBlock_t* block = fFreeLists[iClass]) {
+            fFreeLists[iClass] = block->next;
+            return block;
+          }
+        } // if size class
+
+        auto alignUp = [align](std::byte* p)
+          {
+            auto const addr = reinterpret_cast<std::uintptr_t>(p);
+            return p + ((align - (addr % align)) % align);
+          };
+
+        std::byte* ptr = fCurrent? alignUp(fCurrent): nullptr;
+        if (!ptr || (ptr + bytes > fEnd)) {
+          newChunk(bytes + align);
+          ptr = alignUp(fCurrent);
+        }
+        fCurrent = ptr + bytes;
+        return ptr;
+      } // BulkArena::allocate()
+
+
+      //------------------------------------------------------------------------
+      inline void BulkArena::recycle
+        (void* p, std::size_t bytes, std::size_t align) noexcept
+      {
+        if (bytes == 0) bytes = 1;
+        std::size_t const iClass = sizeClass(bytes, align);
+        if (iClass >= NSizeClasses) return; // large blocks are not reused
+        auto* block = static_cast<FreeBlock_t*>(p);
+        block->next = fFreeLists[iClass];
+        fFreeLists[iClass] = block;
+      } // BulkArena::recycle()
+
+
+      //------------------------------------------------------------------------
+      inline void BulkArena::release() noexcept {
+        fChunks.clear();
+        fFreeLists.fill(nullptr);
+        fCurrent = fEnd = nullptr;
+        fAllocated = 0;
+      } // BulkArena::release()
+
+
+      //------------------------------------------------------------------------
+      inline void BulkArena::newChunk(std::size_t minBytes) {
+        std::size_t const size = std::max(fChunkSize, minBytes);
+        fChunks.emplace_back(new std::byte[size]);
+        fCurrent = fChunks.back().get();
+        fEnd = fCurrent + size;
+        fAllocated += size;
+      } // BulkArena::newChunk()
+
+
+    } // namespace bulk_allocator
+  } // namespace details
+
+
+  //----------------------------------------------------------------------------
+  inline void ThreadBulkResource::release() noexcept {
+    std::lock_guard<std::mutex> lock(fArenaMutex);
+    // arenas are kept, since threads may hold a pointer to them
+    for (auto& arenaInfo: fArenas) arenaInfo.second->release();
+  } // ThreadBulkResource::release()
+
+
+  //----------------------------------------------------------------------------
+  inline std::size_t ThreadBulkResource::nArenas() const {
+    std::lock_guard<std::mutex> lock(fArenaMutex);
+    return fArenas.size();
+  } // ThreadBulkResource::nArenas()
+
+
+  //----------------------------------------------------------------------------
+  inline std::size_t ThreadBulkResource::nChunks() const {
+    std::lock_guard<std::mutex> lock(fArenaMutex);
+    std::size_t n = 0;
+    for (auto const& arenaInfo: fArenas) n += arenaInfo.second->nChunks();
+    return n;
+  } // ThreadBulkResource::nChunks()
+
+
+  //----------------------------------------------------------------------------
+  inline std::size_t ThreadBulkResource::allocatedBytes() const {
+    std::lock_guard<std::mutex> lock(fArenaMutex);
+    std::size_t n = 0;
+    for (auto const& arenaInfo: fArenas)
+      n += arenaInfo.second->allocatedBytes();
+    return n;
+  } // ThreadBulkResource::allocatedBytes()
+
+
+  //----------------------------------------------------------------------------
+  inline auto ThreadBulkResource::registerThreadArena() -> Arena_t& {
+    std::lock_guard<std::mutex> lock(fArenaMutex);
+    auto& arena = fArenas[std::this_thread::get_id()];
+    if (!arena) arena = std::make_unique<Arena_t>(fConfig.chunkSize);
+    return *arena;
+  } // ThreadBulkResource::registerThreadArena()
+
+
+  //----------------------------------------------------------------------------
+
+} // namespace lar
+
+
+#endif // LARDATA_UTILITIES_THREADBULKALLOCATOR_H
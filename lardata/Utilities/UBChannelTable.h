@@ -0,0 +1,294 @@
+/**
+ * @file   UBChannelTable.h
+ * @brief  Dense map between DAQ (crate, card, channel) and LArSoft channels
+ * @date   October 19, 2026
+ *
+ * This is a header-only library.
+ */
+
+#ifndef UBCHANNELTABLE_H
+#define UBCHANNELTABLE_H
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <cstdint> // std::int32_t
+#include <cstdlib> // std::strtol()
+#include <cstring> // std::memcmp()
+#include <fstream>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility> // std::pair
+#include <vector>
+
+
+///General LArSoft Utilities
+namespace util{
+
+  class UBDaqID {
+  public:
+  UBDaqID() : crate(-1), card(-1), channel(-1) {};
+  UBDaqID( int _crate, int _card, int _channel ) :
+    crate(_crate), card(_card), channel(_channel) {};
+    ~UBDaqID() {};
+
+    int crate;
+    int card;
+    int channel;
+
+    const bool operator<(const UBDaqID& rhs) const {
+      bool is_less=false;
+      if (this->crate   == rhs.crate &&
+    	  this->card    == rhs.card  &&
+    	  this->channel <  rhs.channel) is_less=true;
+      else if (this->crate == rhs.crate &&
+    	       this->card  <  rhs.card) is_less=true;
+      else if (this->crate < rhs.crate) is_less=true;
+      return is_less;
+    }
+
+  };
+
+
+  typedef int UBLArSoftCh_t;
+
+  typedef std::map< UBDaqID, UBLArSoftCh_t > UBChannelMap_t;
+  typedef std::map< UBLArSoftCh_t, UBDaqID > UBChannelReverseMap_t;
+
+
+  /**
+   * @brief Channel map stored in direct-indexed tables.
+   *
+   * The LArSoft channel of a DAQ (crate, card, channel) is stored in a table
+   * indexed by the three numbers; the DAQ ID of a LArSoft channel, in a table
+   * indexed by the channel. Both lookups are a range check and a single
+   * memory access.
+   *
+   * The table is filled once from the entries of the channel map database,
+   * in their order. As with the insertion into `UBChannelMap_t` and
+   * `UBChannelReverseMap_t`, when an identifier appears more than once the
+   * first entry is kept. The `std::map` forms are still available via
+   * `map()` and `reverseMap()`.
+   * Entries with a negative DAQ identifier or LArSoft channel can't be
+   * indexed: they are left out of the tables, but they are still part of
+   * `entries()`, `map()` and `reverseMap()`.
+   *
+   * The table can be saved into a binary cache file and loaded back with
+   * `writeCache()` and `readCache()`; the file stores the entries, so that
+   * the loaded table is built exactly as the original one.
+   */
+  class UBChannelTable {
+  public:
+    /// Value for DAQ IDs with no LArSoft channel.
+    static constexpr UBLArSoftCh_t InvalidChannel = -1;
+
+    /// An entry of the channel map database.
+    struct Entry {
+      UBDaqID       daqID;
+      UBLArSoftCh_t channel;
+    };
+
+    /// Creates an empty table.
+    UBChannelTable() = default;
+
+    /// Creates the table from the entries, in database order.
+    explicit UBChannelTable(std::vector<Entry> entries);
+
+    /// Returns the LArSoft channel of the DAQ ID (`InvalidChannel` if none).
+    UBLArSoftCh_t LArSoftChannel(int crate, int card, int channel) const
+    {
+      if ((crate < 0) || (crate >= fNCrates) || (card < 0) || (card >= fNCards)
+        || (channel < 0) || (channel >= fNChannels))
+        return InvalidChannel;
+      return fDaqToLArSoft[(crate * fNCards + card) * fNChannels + channel];
+    }
+
+    /// Returns the LArSoft channel of the DAQ ID (`InvalidChannel` if none).
+    UBLArSoftCh_t LArSoftChannel(UBDaqID const& daqID) const
+      { return LArSoftChannel(daqID.crate, daqID.card, daqID.channel); }
+
+    /// Returns the DAQ ID of the LArSoft channel (`nullptr` if none).
+    UBDaqID const* DaqID(UBLArSoftCh_t channel) const
+    {
+      if ((channel < 0) || (std::size_t(channel) >= fLArSoftToDaq.size())) return nullptr;
+      UBDaqID const& daqID = fLArSoftToDaq[channel];
+      return (daqID.crate < 0) ? nullptr : &daqID;
+    }
+
+    /// Returns the entries the table was built from.
+    std::vector<Entry> const& entries() const { return fEntries; }
+
+    /// Number of distinct DAQ IDs mapped.
+    std::size_t size() const { return fNMapped; }
+    bool empty() const { return fNMapped == 0; }
+
+    /// Returns the table as a `std::map` from DAQ ID to LArSoft channel.
+    UBChannelMap_t map() const;
+
+    /// Returns the table as a `std::map` from LArSoft channel to DAQ ID.
+    UBChannelReverseMap_t reverseMap() const;
+
+    /// Writes the table into a binary cache file.
+    void writeCache(std::string const& path) const;
+
+    /// Reads a table from a binary cache file.
+    static UBChannelTable readCache(std::string const& path);
+
+    /// Parses a "(crate,slot,FEMch,larsoft_chan)" database tuple.
+    static std::optional<Entry> parseDBTuple(char const* tuple);
+
+  private:
+    /// Identifier and version of the cache files.
+    static constexpr char CacheMagic[8] = { 'U', 'B', 'C', 'H', 'M', 'A', 'P', '1' };
+
+    std::vector<Entry> fEntries;              ///< Entries, in database order.
+    int fNCrates = 0;
+    int fNCards = 0;
+    int fNChannels = 0;
+    std::size_t fNMapped = 0;
+    std::vector<UBLArSoftCh_t> fDaqToLArSoft; ///< By (crate, card, channel).
+    std::vector<UBDaqID> fLArSoftToDaq;       ///< By LArSoft channel.
+
+  }; // class UBChannelTable
+
+} //namespace util
+
+
+//------------------------------------------------------------------------------
+inline util::UBChannelTable::UBChannelTable(std::vector<Entry> entries)
+  : fEntries(std::move(entries))
+{
+  auto const indexable = [](Entry const& entry)
+    {
+      UBDaqID const& id = entry.daqID;
+      return (id.crate >= 0) && (id.card >= 0) && (id.channel >= 0) && (entry.channel >= 0);
+    };
+
+  UBLArSoftCh_t maxChannel = -1;
+  for (Entry const& entry: fEntries) {
+    if (!indexable(entry)) continue;
+    UBDaqID const& id = entry.daqID;
+    if (id.crate >= fNCrates) fNCrates = id.crate + 1;
+    if (id.card >= fNCards) fNCards = id.card + 1;
+    if (id.channel >= fNChannels) fNChannels = id.channel + 1;
+    if (entry.channel > maxChannel) maxChannel = entry.channel;
+  }
+
+  fDaqToLArSoft.assign(std::size_t(fNCrates) * fNCards * fNChannels, InvalidChannel);
+  fLArSoftToDaq.assign(maxChannel + 1, UBDaqID());
+  for (Entry const& entry: fEntries) {
+    if (!indexable(entry)) continue;
+    UBDaqID const& id = entry.daqID;
+    UBLArSoftCh_t& channel = fDaqToLArSoft[(id.crate * fNCards + id.card) * fNChannels + id.channel];
+    if (channel == InvalidChannel) {
+      channel = entry.channel;
+      ++fNMapped;
+    }
+    UBDaqID& daqID = fLArSoftToDaq[entry.channel];
+    if (daqID.crate < 0) daqID = id;
+  }
+}
+
+
+//------------------------------------------------------------------------------
+inline util::UBChannelMap_t util::UBChannelTable::map() const
+{
+  UBChannelMap_t channelMap;
+  for (Entry const& entry: fEntries) channelMap.insert({ entry.daqID, entry.channel });
+  return channelMap;
+}
+
+
+inline util::UBChannelReverseMap_t util::UBChannelTable::reverseMap() const
+{
+  UBChannelReverseMap_t reverseMap;
+  for (Entry const& entry: fEntries) reverseMap.insert({ entry.channel, entry.daqID });
+  return reverseMap;
+}
+
+
+//------------------------------------------------------------------------------
+inline void util::UBChannelTable::writeCache(std::string const& path) const
+{
+  std::ofstream out(path, std::ios::binary);
+  if (!out) {
+    throw cet::exception("UBChannelTable")
+      << "Can't write channel map cache '" << path << "'\n";
+  }
+  std::vector<std::int32_t> words;
+  words.reserve(1 + 4 * fEntries.size());
+  words.push_back(fEntries.size());
+  for (Entry const& entry: fEntries) {
+    words.push_back(entry.daqID.crate);
+    words.push_back(entry.daqID.card);
+    words.push_back(entry.daqID.channel);
+    words.push_back(entry.channel);
+  }
+  out.write(CacheMagic, sizeof(CacheMagic));
+  out.write(reinterpret_cast<char const*>(words.data()), words.size() * sizeof(std::int32_t));
+  if (!out) {
+    throw cet::exception("UBChannelTable")
+      << "Error while writing channel map cache '" << path << "'\n";
+  }
+}
+
+
+inline util::UBChannelTable util::UBChannelTable::readCache(std::string const& path)
+{
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    throw cet::exception("UBChannelTable")
+      << "Can't open channel map cache '" << path << "'\n";
+  }
+  char magic[sizeof(CacheMagic)];
+  std::int32_t nEntries = -1;
+  in.read(magic, sizeof(magic));
+  in.read(reinterpret_cast<char*>(&nEntries), sizeof(nEntries));
+  if (!in || (std::memcmp(magic, CacheMagic, sizeof(magic)) != 0) || (nEntries < 0)) {
+    throw cet::exception("UBChannelTable")
+      << "'" << path << "' is not a channel map cache\n";
+  }
+  // the size is checked before allocating: a corrupted count must not be trusted
+  std::streampos const dataStart = in.tellg();
+  in.seekg(0, std::ios::end);
+  std::streamoff const dataSize = in.tellg() - dataStart;
+  in.seekg(dataStart);
+  if (!in || (dataSize != std::streamoff(4 * sizeof(std::int32_t)) * nEntries)) {
+    throw cet::exception("UBChannelTable")
+      << "Channel map cache '" << path << "' does not have " << nEntries << " entries\n";
+  }
+  std::vector<std::int32_t> words(4 * std::size_t(nEntries));
+  in.read(reinterpret_cast<char*>(words.data()), words.size() * sizeof(std::int32_t));
+  if (!in) {
+    throw cet::exception("UBChannelTable")
+      << "Can't read the entries of channel map cache '" << path << "'\n";
+  }
+  std::vector<Entry> entries;
+  entries.reserve(nEntries);
+  for (std::size_t i = 0; i < words.size(); i += 4)
+    entries.push_back({ UBDaqID(words[i], words[i+1], words[i+2]), words[i+3] });
+  return UBChannelTable(std::move(entries));
+}
+
+
+//------------------------------------------------------------------------------
+inline std::optional<util::UBChannelTable::Entry>
+util::UBChannelTable::parseDBTuple(char const* tuple)
+{
+  // (crate,slot,FEMch,larsoft_chan) format
+  if (*tuple != '(') return std::nullopt;
+  long fields[4];
+  char const* p = tuple + 1;
+  for (int i = 0; i < 4; ++i) {
+    char* end = nullptr;
+    fields[i] = std::strtol(p, &end, 10);
+    if ((end == p) || (*end != ((i == 3)? ')': ','))) return std::nullopt;
+    p = end + 1;
+  }
+  return Entry{ UBDaqID(fields[0], fields[1], fields[2]), UBLArSoftCh_t(fields[3]) };
+}
+
+
+#endif // UBCHANNELTABLE_H
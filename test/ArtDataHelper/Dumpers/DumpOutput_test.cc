@@ -0,0 +1,241 @@
+/**
+ * @file    DumpOutput_test.cc
+ * @brief   Test of the binary and digest output of the dumper modules
+ * @date    October 19, 2026
+ * @see     lardata/ArtDataHelper/Dumpers/DumpOutput.h
+ *
+ * See http://www.boost.org/libs/test for the Boost test library home page.
+ *
+ * The printing function here is written like the ones of the dumper modules,
+ * mixing values with decoration and manipulators.
+ */
+
+// C/C++ standard libraries
+#include <cstdint> // std::int8_t, std::uint8_t
+#include <cstdio> // std::remove()
+#include <iomanip> // std::setw(), std::setprecision()
+#include <limits> // std::numeric_limits<>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility> // std::pair, std::move()
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( DumpOutput_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK()
+
+// LArSoft libraries
+#include "lardata/ArtDataHelper/Dumpers/DumpOutput.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+
+/// The seed for the default random engine
+constexpr unsigned int RandomSeed = 12345;
+
+
+//------------------------------------------------------------------------------
+enum class Compression { None, Huffman };
+
+std::ostream& operator<< (std::ostream& out, Compression c)
+  { return out << static_cast<int>(c); }
+
+/// An object with no special support in the dump streams.
+struct Point { int x, y; };
+
+std::ostream& operator<< (std::ostream& out, Point const& p)
+  { return out << p.x << " " << p.y; }
+
+
+struct Waveform {
+  unsigned int channel;
+  Compression compression;
+  std::vector<short> ADCs;
+};
+
+std::vector<Waveform> makeWaveforms(unsigned int n, unsigned int nTicks) {
+  std::default_random_engine random_engine(RandomSeed);
+  std::normal_distribution<float> noise(0.0, 3.0);
+  std::vector<Waveform> waveforms;
+  for (unsigned int i = 0; i < n; ++i) {
+    Waveform waveform{ i, (i % 2)? Compression::Huffman: Compression::None, {} };
+    for (unsigned int iTick = 0; iTick < nTicks; ++iTick)
+      waveform.ADCs.push_back(short(2048 + noise(random_engine)));
+    waveforms.push_back(std::move(waveform));
+  }
+  return waveforms;
+} // makeWaveforms()
+
+
+/// Prints the waveform like a dumper module would.
+template <typename Stream>
+void PrintWaveform(Stream&& out, Waveform const& waveform, std::string indent = "  ") {
+  out << indent << "#" << waveform.channel << ": " << waveform.ADCs.size()
+    << " ticks; compression: " << waveform.compression << " ("
+    << ((waveform.compression == Compression::None)? "none": "Huffman") << ")";
+  out << "\n" << indent << std::fixed << std::setprecision(3);
+  for (short ADC: waveform.ADCs) out << " " << std::setw(4) << ADC;
+  out << std::endl;
+} // PrintWaveform()
+
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+void EncodingTest() {
+  recob::dumper::BinaryDumpStream out;
+  out << "value: " << true << ' ' << -5 << " " << 7U << std::setw(8) << 2.5f
+    << std::endl << std::string("Z") << std::string("   ") << Compression::Huffman
+    << Point{ 1, 2 } << std::numeric_limits<long long>::min()
+    << std::numeric_limits<unsigned long long>::max() << short(-300)
+    << std::int8_t(-3) << ' ' << std::uint8_t(200);
+
+  std::vector<std::pair<char, std::string>> records;
+  std::size_t const nRecords = recob::dumper::DecodeRecords(
+    out.sink().data,
+    [&records](char tag, std::string const& value)
+      { records.emplace_back(tag, value); }
+    );
+
+  std::vector<std::pair<char, std::string>> const expected = {
+    { 'b', "true" },
+    { 'i', "-5" },
+    { 'u', "7" },
+    { 'd', "2.5" },
+    { 's', "Z" },
+    { 'i', "1" },
+    { 's', "1 2" },
+    { 'i', std::to_string(std::numeric_limits<long long>::min()) },
+    { 'u', std::to_string(std::numeric_limits<unsigned long long>::max()) },
+    { 'i', "-300" },
+    { 'i', "-3" },
+    { 'u', "200" },
+  };
+  BOOST_CHECK_EQUAL(nRecords, expected.size());
+  BOOST_REQUIRE_EQUAL(records.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    BOOST_TEST_CONTEXT("record #" << i) {
+      BOOST_CHECK_EQUAL(records[i].first, expected[i].first);
+      BOOST_CHECK_EQUAL(records[i].second, expected[i].second);
+    }
+  }
+
+  // corrupted records
+  std::string const truncated = out.sink().data.substr(0, 5);
+  BOOST_CHECK_THROW(
+    recob::dumper::DecodeRecords(truncated, [](char, std::string const&){}),
+    cet::exception
+    );
+  BOOST_CHECK_THROW(
+    recob::dumper::DecodeRecords("x", [](char, std::string const&){}),
+    cet::exception
+    );
+
+  BOOST_CHECK(recob::dumper::ParseDumpMode("text") == recob::dumper::DumpMode::Text);
+  BOOST_CHECK(recob::dumper::ParseDumpMode("binary") == recob::dumper::DumpMode::Binary);
+  BOOST_CHECK(recob::dumper::ParseDumpMode("hash") == recob::dumper::DumpMode::Hash);
+  BOOST_CHECK_THROW(recob::dumper::ParseDumpMode("Text"), cet::exception);
+} // EncodingTest()
+
+
+void HashTest() {
+  std::vector<Waveform> waveforms = makeWaveforms(20, 100);
+  auto const print = [&waveforms](auto& out)
+    { for (Waveform const& waveform: waveforms) PrintWaveform(out, waveform); };
+
+  recob::dumper::BinaryDumpStream binary;
+  print(binary);
+  recob::dumper::HashDumpStream hash;
+  print(hash);
+  BOOST_CHECK_EQUAL(hash.sink().hash, recob::dumper::HashRecords(binary.sink().data));
+
+  recob::dumper::DumpOutput output(recob::dumper::DumpMode::Hash, "");
+  BOOST_CHECK(!output.isText());
+  BOOST_CHECK_EQUAL(output.dump(1, 0, 1, "daq", print), hash.sink().hash);
+
+  // any changed value changes the digest
+  waveforms[7].ADCs[50] += 1;
+  BOOST_CHECK_NE(output.dump(1, 0, 1, "daq", print), hash.sink().hash);
+
+  BOOST_CHECK_EQUAL(recob::dumper::DigestString(0xabcU), "0000000000000abc");
+  BOOST_CHECK_THROW
+    (recob::dumper::DumpOutput(recob::dumper::DumpMode::Binary, ""), cet::exception);
+} // HashTest()
+
+
+void FileRoundTripTest() {
+  std::string const path = "DumpOutput_test.lardump";
+  std::vector<Waveform> const waveforms = makeWaveforms(5, 30);
+
+  std::vector<std::uint64_t> digests;
+  {
+    recob::dumper::DumpOutput output(recob::dumper::DumpMode::Binary, path);
+    for (unsigned int event = 1; event <= 3; ++event) {
+      digests.push_back(output.dump(7, 2, event, "daq", [&](auto& out)
+        {
+          out << event;
+          for (Waveform const& waveform: waveforms) PrintWaveform(out, waveform);
+        }));
+    }
+  } // the file is closed here
+
+  recob::dumper::DumpFileReader reader(path);
+  recob::dumper::DumpBlock block;
+  unsigned int nBlocks = 0;
+  while (reader.next(block)) {
+    ++nBlocks;
+    BOOST_TEST_CONTEXT("block #" << nBlocks) {
+      BOOST_CHECK_EQUAL(block.run, 7U);
+      BOOST_CHECK_EQUAL(block.subRun, 2U);
+      BOOST_CHECK_EQUAL(block.event, nBlocks);
+      BOOST_CHECK_EQUAL(block.label, "daq");
+      BOOST_CHECK_EQUAL(recob::dumper::HashRecords(block.records), digests[nBlocks - 1]);
+      std::size_t const nRecords = recob::dumper::DecodeRecords
+        (block.records, [](char, std::string const&){});
+      // event, and per waveform channel, size, compression and ADCs
+      BOOST_CHECK_EQUAL(nRecords, 1U + waveforms.size() * (3U + 30U));
+    }
+  }
+  BOOST_CHECK_EQUAL(nBlocks, 3U);
+
+  BOOST_CHECK_THROW
+    (recob::dumper::DumpFileReader("DumpOutput_test_missing.lardump"), cet::exception);
+
+  std::remove(path.c_str());
+} // FileRoundTripTest()
+
+
+void ManyWaveformsTest() {
+  std::vector<Waveform> const waveforms = makeWaveforms(2000, 1000);
+
+  recob::dumper::BinaryDumpStream binary;
+  for (Waveform const& waveform: waveforms) PrintWaveform(binary, waveform);
+  recob::dumper::HashDumpStream hash;
+  for (Waveform const& waveform: waveforms) PrintWaveform(hash, waveform);
+
+  BOOST_CHECK_EQUAL(hash.sink().hash, recob::dumper::HashRecords(binary.sink().data));
+} // ManyWaveformsTest()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(EncodingTestCase) {
+  EncodingTest();
+}
+
+BOOST_AUTO_TEST_CASE(HashTestCase) {
+  HashTest();
+}
+
+BOOST_AUTO_TEST_CASE(FileRoundTripTestCase) {
+  FileRoundTripTest();
+}
+
+BOOST_AUTO_TEST_CASE(ManyWaveformsTestCase) {
+  ManyWaveformsTest();
+}
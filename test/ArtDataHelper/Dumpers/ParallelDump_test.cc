@@ -0,0 +1,279 @@
+/**
+ * @file    ParallelDump_test.cc
+ * @brief   Test of the parallel formatting of data product dumps
+ * @date    October 19, 2026
+ * @see     lardata/ArtDataHelper/Dumpers/ParallelDump.h
+ *
+ * See http://www.boost.org/libs/test for the Boost test library home page.
+ *
+ * The reference is the formatting of each element into a new stream, as the
+ * dumper modules do with a new message for each element.
+ * The raw digit and wire dumpers used by `DumpProducts` are tested the same
+ * way, together with the lines introducing each product.
+ */
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <iomanip> // std::setw(), std::setprecision()
+#include <ios> // std::fixed
+#include <random>
+#include <sstream>
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( ParallelDump_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK()
+
+// LArSoft libraries
+#include "lardata/ArtDataHelper/Dumpers/ParallelDump.h"
+#include "lardata/ArtDataHelper/Dumpers/RawDigitDumpers.h"
+#include "lardata/ArtDataHelper/Dumpers/WireDumpers.h"
+#include "lardata/ArtDataHelper/Dumpers/HitDumpers.h"
+#include "lardataobj/RawData/RawDigit.h"
+#include "lardataobj/RecoBase/Wire.h"
+
+// framework libraries
+#include "canvas/Persistency/Provenance/EventID.h"
+#include "canvas/Utilities/InputTag.h"
+
+
+/// The seed for the default random engine
+constexpr unsigned int RandomSeed = 12345;
+
+
+//------------------------------------------------------------------------------
+using Waveform_t = std::vector<float>;
+
+std::vector<Waveform_t> makeWaveforms(std::size_t n, std::size_t nTicks) {
+  std::default_random_engine random_engine(RandomSeed);
+  std::normal_distribution<float> noise(0.0, 3.0);
+  std::vector<Waveform_t> waveforms(n);
+  for (Waveform_t& waveform: waveforms)
+    for (std::size_t iTick = 0; iTick < nTicks; ++iTick)
+      waveform.push_back(noise(random_engine));
+  return waveforms;
+} // makeWaveforms()
+
+
+/// Prints like the wire dumper; the format state is changed on odd elements.
+void PrintWaveform(std::ostream& out, Waveform_t const& waveform, std::size_t i) {
+  out << "  #" << i << ": " << waveform.size() << " ticks";
+  if (i % 2) out << std::fixed << std::setprecision(3);
+  for (std::size_t iTick = 0; iTick < waveform.size(); ++iTick) {
+    if (iTick % 20 == 0) out << "\n   ";
+    out << std::setw(8) << waveform[iTick];
+  }
+} // PrintWaveform()
+
+
+/// Formats each element into a new stream.
+std::vector<std::string> serialFormat(std::vector<Waveform_t> const& waveforms) {
+  std::vector<std::string> texts;
+  for (std::size_t i = 0; i < waveforms.size(); ++i) {
+    std::ostringstream out;
+    PrintWaveform(out, waveforms[i], i);
+    texts.push_back(out.str());
+  }
+  return texts;
+} // serialFormat()
+
+
+/// Raw digits with noise, with flat stretches (repeated lines) and no ticks.
+std::vector<raw::RawDigit> makeRawDigits(std::size_t n, std::size_t nTicks) {
+  std::default_random_engine random_engine(RandomSeed);
+  std::poisson_distribution<int> noise(8.0);
+  std::vector<raw::RawDigit> digits;
+  for (std::size_t iChannel = 0; iChannel < n; ++iChannel) {
+    std::size_t const nChannelTicks = (iChannel % 10 == 9)? 0: nTicks;
+    raw::RawDigit::ADCvector_t ADCs(nChannelTicks, 400);
+    for (std::size_t iTick = 0; iTick < nChannelTicks; ++iTick) {
+      if ((iTick / 100) % 2) continue; // flat stretch of 100 ticks
+      ADCs[iTick] += noise(random_engine);
+    }
+    digits.emplace_back(iChannel, nChannelTicks, ADCs);
+  }
+  return digits;
+} // makeRawDigits()
+
+
+/// Wires with a few regions of interest each (some without any).
+std::vector<recob::Wire> makeWires(std::size_t n, std::size_t nTicks) {
+  std::default_random_engine random_engine(RandomSeed);
+  std::normal_distribution<float> signal(5.0, 2.0);
+  std::vector<recob::Wire> wires;
+  for (std::size_t iChannel = 0; iChannel < n; ++iChannel) {
+    recob::Wire::RegionsOfInterest_t RoIs(nTicks);
+    if (iChannel % 8 == 7) { // no region of interest
+      wires.emplace_back(RoIs, iChannel, geo::View_t(iChannel % 3));
+      continue;
+    }
+    for (std::size_t start = iChannel % 7 * 20; start + 30 < nTicks;
+      start += 150
+    ) {
+      std::vector<float> RoI(30);
+      for (float& sample: RoI) sample = signal(random_engine);
+      RoIs.add_range(start, RoI);
+    }
+    wires.emplace_back(RoIs, iChannel, geo::View_t(iChannel % 3));
+  }
+  return wires;
+} // makeWires()
+
+
+/// Formats each element with `print(out, element)` into a new stream.
+template <typename Coll, typename Print>
+std::vector<std::string> serialFormat(Coll const& coll, Print print) {
+  std::vector<std::string> texts;
+  for (auto const& element: coll) {
+    std::ostringstream out;
+    print(out, element);
+    texts.push_back(out.str());
+  }
+  return texts;
+} // serialFormat()
+
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+void OrderTest() {
+  std::vector<std::vector<Waveform_t>> const products = {
+    makeWaveforms(101, 60), makeWaveforms(0, 60), makeWaveforms(7, 300),
+    makeWaveforms(1, 1)
+  };
+  std::vector<std::vector<std::string>> expected;
+  for (auto const& product: products) expected.push_back(serialFormat(product));
+
+  for (unsigned int nThreads: { 1U, 2U, 5U, 0U }) {
+    for (std::size_t chunkSize: { 1U, 3U, 32U, 1000U }) {
+      BOOST_TEST_CONTEXT(nThreads << " threads, chunks of " << chunkSize) {
+        recob::dumper::ParallelFormatter formatter(nThreads, chunkSize);
+        for (auto const& product: products) {
+          formatter.add(product.size(),
+            [&product](std::ostream& out, std::size_t i)
+              { PrintWaveform(out, product[i], i); }
+            );
+        }
+        BOOST_CHECK_EQUAL(formatter.nProducts(), products.size());
+        formatter.run();
+
+        for (std::size_t iProduct = 0; iProduct < products.size(); ++iProduct) {
+          BOOST_CHECK_EQUAL(formatter.size(iProduct), products[iProduct].size());
+          std::vector<std::string> texts;
+          formatter.forEach(iProduct,
+            [&texts](std::string_view text){ texts.emplace_back(text); });
+          BOOST_CHECK(texts == expected[iProduct]);
+        }
+      }
+    }
+  }
+} // OrderTest()
+
+
+void ExceptionTest() {
+  recob::dumper::ParallelFormatter formatter(4U, 2U);
+  formatter.add(100U, [](std::ostream& out, std::size_t i)
+    {
+      if (i == 57) throw std::runtime_error("element 57");
+      out << i;
+    });
+  BOOST_CHECK_THROW(formatter.run(), std::runtime_error);
+
+  formatter.clear();
+  BOOST_CHECK_EQUAL(formatter.nProducts(), 0U);
+} // ExceptionTest()
+
+
+/// Formats raw digits and wires with the dumpers of `DumpProducts`.
+void DumperTest() {
+  constexpr unsigned int DigitsPerLine = 20U;
+  constexpr raw::RawDigit::ADCvector_t::value_type Pedestal = 400;
+
+  std::vector<raw::RawDigit> const digits = makeRawDigits(53, 450);
+  std::vector<recob::Wire> const wires = makeWires(41, 600);
+
+  auto const printDigit = [](std::ostream& out, raw::RawDigit const& digit)
+    { raw::dumper::DumpRawDigit(out, digit, DigitsPerLine, Pedestal); };
+  auto const printWire = [](std::ostream& out, recob::Wire const& wire)
+    { recob::dumper::DumpWire(out, wire, DigitsPerLine); };
+
+  std::vector<std::string> const expectedDigits
+    = serialFormat(digits, printDigit);
+  std::vector<std::string> const expectedWires = serialFormat(wires, printWire);
+
+  for (unsigned int nThreads: { 1U, 3U, 8U }) {
+    for (std::size_t chunkSize: { 1U, 5U, 32U }) {
+      BOOST_TEST_CONTEXT(nThreads << " threads, chunks of " << chunkSize) {
+        recob::dumper::ParallelFormatter formatter(nThreads, chunkSize);
+        std::size_t const iDigits = formatter.add(digits.size(),
+          [&digits, &printDigit](std::ostream& out, std::size_t i)
+            { printDigit(out, digits[i]); }
+          );
+        std::size_t const iWires = formatter.add(wires.size(),
+          [&wires, &printWire](std::ostream& out, std::size_t i)
+            { printWire(out, wires[i]); }
+          );
+        formatter.run();
+
+        std::vector<std::string> digitTexts, wireTexts;
+        formatter.forEach(iDigits,
+          [&digitTexts](std::string_view text){ digitTexts.emplace_back(text); });
+        formatter.forEach(iWires,
+          [&wireTexts](std::string_view text){ wireTexts.emplace_back(text); });
+        BOOST_CHECK(digitTexts == expectedDigits);
+        BOOST_CHECK(wireTexts == expectedWires);
+      }
+    }
+  }
+} // DumperTest()
+
+
+/// Checks the lines introducing each product.
+void HeaderTest() {
+  art::EventID const eventID { 1U, 2U, 3U };
+  std::ostringstream ID;
+  ID << eventID;
+
+  std::ostringstream digitsHeader;
+  raw::dumper::DumpRawDigitsHeader
+    (digitsHeader, eventID, 53U, art::InputTag{ "daq" });
+  BOOST_CHECK_EQUAL(digitsHeader.str(),
+    "Event " + ID.str() + " contains 53 'daq' waveforms");
+
+  std::ostringstream wiresHeader;
+  recob::dumper::DumpWiresHeader
+    (wiresHeader, eventID, 41U, art::InputTag{ "caldata", "", "Reco" });
+  BOOST_CHECK_EQUAL(wiresHeader.str(),
+    "Event " + ID.str() + " contains 41 'caldata::Reco' wires");
+
+  std::ostringstream hitsHeader;
+  recob::dumper::DumpHitsHeader
+    (hitsHeader, 0U, art::InputTag{ "gaushit", "inst" });
+  BOOST_CHECK_EQUAL
+    (hitsHeader.str(), "The event contains 0 'gaushit:inst' hits");
+} // HeaderTest()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(OrderTestCase) {
+  OrderTest();
+}
+
+BOOST_AUTO_TEST_CASE(ExceptionTestCase) {
+  ExceptionTest();
+}
+
+BOOST_AUTO_TEST_CASE(DumperTestCase) {
+  DumperTest();
+}
+
+BOOST_AUTO_TEST_CASE(HeaderTestCase) {
+  HeaderTest();
+}
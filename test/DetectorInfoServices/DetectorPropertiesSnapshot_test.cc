@@ -0,0 +1,218 @@
+/**
+ * @file    DetectorPropertiesSnapshot_test.cc
+ * @brief   Test of the flat detector properties snapshot
+ * @date    October 19, 2026
+ * @see     lardata/DetectorInfoServices/DetectorPropertiesSnapshot.h
+ *
+ * See http://www.boost.org/libs/test for the Boost test library home page.
+ *
+ * The snapshot is compiled from mock detector properties and geometry with
+ * the same interface as `detinfo::DetectorPropertiesData` and
+ * `geo::GeometryCore`. The x and ticks conversions must be exactly the ones
+ * of the detector properties, and the tabulated energy loss close to it.
+ */
+
+// C/C++ standard libraries
+#include <cmath>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( DetectorPropertiesSnapshot_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK()
+
+// LArSoft libraries
+#include "lardata/DetectorInfoServices/DetectorPropertiesSnapshot.h"
+
+
+/// The seed for the default random engine
+constexpr unsigned int RandomSeed = 12345;
+
+
+//------------------------------------------------------------------------------
+//--- Mock services
+//
+
+/// Two cryostats, with two and four TPCs of three planes (one with two).
+struct MockGeometry {
+  unsigned int Ncryostats() const { return 2; }
+  unsigned int NTPC(unsigned int c) const { return (c == 0)? 2: 4; }
+  unsigned int Nplanes(unsigned int t, unsigned int c) const
+    { return ((c == 1) && (t == 3))? 2: 3; }
+}; // MockGeometry
+
+
+/// Detector properties with the formulae of `DetectorPropertiesData`.
+struct MockDetectorProperties {
+  double Temperature() const { return 87.0; }
+  double Efield(unsigned int gap = 0) const { return 0.5 + 0.1 * gap; }
+  double DriftVelocity() const { return 0.1565; }
+  double ElectronLifetime() const { return 3000.0; }
+  unsigned int NumberTimeSamples() const { return 9600; }
+  unsigned int ReadOutWindowSize() const { return 6400; }
+
+  double GetXTicksCoefficient(unsigned int t, unsigned int c) const
+    { return 0.07825 * (((t + c) % 2)? -1.0: +1.0); }
+  double GetXTicksOffset(unsigned int p, unsigned int t, unsigned int c) const
+    { return 3200.0 + 13.7 * p - 1.1 * t + 0.3 * c; }
+  double ConvertXToTicks(double X, unsigned int p, unsigned int t, unsigned int c) const
+    { return X / GetXTicksCoefficient(t, c) + GetXTicksOffset(p, t, c); }
+  double ConvertTicksToX(double ticks, unsigned int p, unsigned int t, unsigned int c) const
+    { return (ticks - GetXTicksOffset(p, t, c)) * GetXTicksCoefficient(t, c); }
+
+  /// Restricted Bethe-Bloch formula for liquid argon [MeV/cm].
+  double Eloss(double mom, double mass, double tcut) const
+  {
+    double const K = 0.307075, ZA = 18.0 / 39.948, I = 188.0e-6, me = 0.510998918;
+    double const density = 1.396;
+    double const massMeV = 1000. * mass, momMeV = 1000. * mom;
+    double const gamma = std::sqrt(1. + momMeV * momMeV / (massMeV * massMeV));
+    double const beta = std::sqrt(1. - 1. / (gamma * gamma));
+    double const bg = beta * gamma;
+    double const tmax = 2. * me * bg * bg
+      / (1. + 2. * gamma * me / massMeV + (me / massMeV) * (me / massMeV));
+    double const tupper = (tcut > 0.)? std::min(1000. * tcut, tmax): tmax;
+    double const dedx = density * K * ZA / (beta * beta) * (
+        0.5 * std::log(2. * me * bg * bg * tupper / (I * I))
+      - 0.5 * beta * beta * (1. + tupper / tmax)
+      );
+    return dedx;
+  }
+
+  /// Energy loss variance [MeV^2/cm].
+  double ElossVar(double mom, double mass) const
+  {
+    double const K = 0.307075, ZA = 18.0 / 39.948, me = 0.510998918;
+    double const density = 1.396;
+    double const massMeV = 1000. * mass, momMeV = 1000. * mom;
+    double const gamma = std::sqrt(1. + momMeV * momMeV / (massMeV * massMeV));
+    double const beta = std::sqrt(1. - 1. / (gamma * gamma));
+    double const bg = beta * gamma;
+    double const tmax = 2. * me * bg * bg
+      / (1. + 2. * gamma * me / massMeV + (me / massMeV) * (me / massMeV));
+    return density * 0.5 * K * ZA * tmax * (1. - 0.5 * beta * beta) / (beta * beta);
+  }
+}; // MockDetectorProperties
+
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+void ConversionTest() {
+  MockGeometry const geom;
+  MockDetectorProperties const detProp;
+  detinfo::DetectorPropertiesSnapshot const snapshot
+    = detinfo::makeDetectorPropertiesSnapshot(detProp, geom);
+
+  BOOST_CHECK(std::is_trivially_copyable_v<detinfo::DetectorPropertiesSnapshot>);
+  BOOST_CHECK_EQUAL(snapshot.nCryostats, 2U);
+  BOOST_CHECK_EQUAL(snapshot.maxTPCs, 4U);
+  BOOST_CHECK_EQUAL(snapshot.maxPlanes, 3U);
+  BOOST_CHECK_EQUAL(snapshot.temperature, detProp.Temperature());
+  BOOST_CHECK_EQUAL(snapshot.efield[2], detProp.Efield(2));
+  BOOST_CHECK_EQUAL(snapshot.driftVelocity, detProp.DriftVelocity());
+  BOOST_CHECK_EQUAL(snapshot.numberTimeSamples, detProp.NumberTimeSamples());
+  BOOST_CHECK_EQUAL(snapshot.nElossCurves, 0U);
+
+  std::default_random_engine random_engine(RandomSeed);
+  std::uniform_real_distribution<double> uniformX(-200., 200.);
+  std::uniform_real_distribution<double> uniformTicks(0., 9600.);
+
+  for (unsigned int c = 0; c < geom.Ncryostats(); ++c) {
+    for (unsigned int t = 0; t < geom.NTPC(c); ++t) {
+      for (unsigned int p = 0; p < geom.Nplanes(t, c); ++p) {
+        BOOST_TEST_CONTEXT("C:" << c << " T:" << t << " P:" << p) {
+          BOOST_CHECK_EQUAL
+            (snapshot.GetXTicksOffset(p, t, c), detProp.GetXTicksOffset(p, t, c));
+          for (int i = 0; i < 100; ++i) {
+            double const x = uniformX(random_engine);
+            double const ticks = uniformTicks(random_engine);
+            BOOST_CHECK_EQUAL
+              (snapshot.ConvertXToTicks(x, p, t, c), detProp.ConvertXToTicks(x, p, t, c));
+            BOOST_CHECK_EQUAL
+              (snapshot.ConvertTicksToX(ticks, p, t, c), detProp.ConvertTicksToX(ticks, p, t, c));
+          }
+        }
+      }
+    }
+  }
+
+  // the snapshot is a plain value
+  detinfo::DetectorPropertiesSnapshot const copy = snapshot;
+  BOOST_CHECK_EQUAL(copy.ConvertXToTicks(10., 1, 3, 1), detProp.ConvertXToTicks(10., 1, 3, 1));
+} // ConversionTest()
+
+
+void ElossTest() {
+  MockGeometry const geom;
+  MockDetectorProperties const detProp;
+  double const muonMass = 0.105658367, protonMass = 0.938272;
+  detinfo::DetectorPropertiesSnapshot const snapshot
+    = detinfo::makeDetectorPropertiesSnapshot
+      (detProp, geom, { { muonMass, 0.01 }, { protonMass, 0.0, 0.1, 10.0 } });
+
+  BOOST_CHECK_EQUAL(snapshot.nElossCurves, 2U);
+  BOOST_CHECK_EQUAL(snapshot.ElossCurveIndex(muonMass, 0.01), 0);
+  BOOST_CHECK_EQUAL(snapshot.ElossCurveIndex(protonMass, 0.0), 1);
+  BOOST_CHECK_EQUAL(snapshot.ElossCurveIndex(muonMass, 0.0), -1);
+
+  auto const& muon = snapshot.Curve(0);
+  auto const& proton = snapshot.Curve(1);
+  BOOST_CHECK(muon.inRange(0.02));
+  BOOST_CHECK(!muon.inRange(0.005));
+  BOOST_CHECK(!proton.inRange(20.0));
+
+  // the curve is exact at the tabulated points
+  BOOST_CHECK_CLOSE(muon.Eloss(0.01), detProp.Eloss(0.01, muonMass, 0.01), 1e-8);
+  BOOST_CHECK_CLOSE(proton.Eloss(10.0), detProp.Eloss(10.0, protonMass, 0.0), 1e-8);
+
+  std::default_random_engine random_engine(RandomSeed);
+  std::uniform_real_distribution<double> uniformLogP(std::log(0.01), std::log(100.));
+  for (int i = 0; i < 1000; ++i) {
+    double const mom = std::exp(uniformLogP(random_engine));
+    BOOST_TEST_CONTEXT("p=" << mom) {
+      BOOST_CHECK_CLOSE(muon.Eloss(mom), detProp.Eloss(mom, muonMass, 0.01), 0.1);
+      BOOST_CHECK_CLOSE(muon.ElossVar(mom), detProp.ElossVar(mom, muonMass), 0.1);
+      if (proton.inRange(mom)) {
+        BOOST_CHECK_CLOSE(proton.Eloss(mom), detProp.Eloss(mom, protonMass, 0.0), 0.1);
+      }
+    }
+  }
+} // ElossTest()
+
+
+void CapacityTest() {
+  struct HugeGeometry {
+    unsigned int Ncryostats() const { return 1; }
+    unsigned int NTPC(unsigned int) const { return 400; }
+    unsigned int Nplanes(unsigned int, unsigned int) const { return 3; }
+  };
+  MockDetectorProperties const detProp;
+  BOOST_CHECK_THROW
+    (detinfo::makeDetectorPropertiesSnapshot(detProp, HugeGeometry()), cet::exception);
+
+  std::vector<detinfo::DetectorPropertiesSnapshot::ElossCurveSpec> const tooMany
+    (detinfo::DetectorPropertiesSnapshot::MaxElossCurves + 1, { 0.105658367, 0.0 });
+  BOOST_CHECK_THROW
+    (detinfo::makeDetectorPropertiesSnapshot(detProp, MockGeometry(), tooMany), cet::exception);
+} // CapacityTest()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(ConversionTestCase) {
+  ConversionTest();
+}
+
+BOOST_AUTO_TEST_CASE(ElossTestCase) {
+  ElossTest();
+}
+
+BOOST_AUTO_TEST_CASE(CapacityTestCase) {
+  CapacityTest();
+}
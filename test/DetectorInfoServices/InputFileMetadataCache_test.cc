@@ -0,0 +1,219 @@
+/**
+ * @file    InputFileMetadataCache_test.cc
+ * @brief   Test of the cache of the configuration stored in input files
+ * @date    October 19, 2026
+ * @see     lardata/DetectorInfoServices/InputFileMetadataCache.h
+ *
+ * See http://www.boost.org/libs/test for the Boost test library home page.
+ *
+ * The input files are simulated by a reader returning FHiCL parameter sets
+ * from memory, which counts how many times each file is read.
+ */
+
+// C/C++ standard libraries
+#include <map>
+#include <string>
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( InputFileMetadataCache_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK()
+
+// LArSoft libraries
+#include "lardata/DetectorInfoServices/InputFileMetadataCache.h"
+
+
+//------------------------------------------------------------------------------
+//--- Mock input files
+//
+
+/// Content of the mock input files.
+struct MockFile {
+  bool hasMetaDataTree = true;
+  std::vector<std::string> parameterSets;
+};
+
+/// Reader of mock files, counting the reads of each file.
+struct MockReader {
+  std::map<std::string, MockFile> const* files;
+  std::map<std::string, unsigned int>* nReads;
+
+  void operator()(
+    detinfo::InputFileMetadataCache::FileMetadata& metadata,
+    detinfo::InputFileMetadataCache::Select_t const& select
+    ) const
+    {
+      ++(*nReads)[metadata.fileName];
+      auto const iFile = files->find(metadata.fileName);
+      if (iFile == files->end()) return;
+      metadata.open = true;
+      metadata.hasMetaDataTree = iFile->second.hasMetaDataTree;
+      if (!metadata.hasMetaDataTree) return;
+      metadata.fileFormatVersion = 14;
+      for (std::string const& ps: iFile->second.parameterSets)
+        select(ps.c_str());
+    }
+}; // MockReader
+
+
+std::map<std::string, MockFile> const MockFiles {
+  { "clocks_and_properties.root", {
+    true,
+    {
+      "service_type: \"DetectorClocksService\" ClockSpeed: 1.5",
+      "service_type: \"DetectorPropertiesService\" NumberTimeSamples: 3200",
+      "service_type: \"Geometry\"",
+      "service_type: \"DetectorClocksService\" ClockSpeed: 2.0"
+    }
+  } },
+  { "no_metadata.root", { false, { "service_type: \"DetectorClocksService\"" } } }
+};
+
+
+/// Returns a selector for parameter sets of the specified service type.
+detinfo::InputFileMetadataCache::Selector_t selectService
+  (std::string const& serviceType, unsigned int* nCalls = nullptr)
+{
+  return [serviceType, nCalls](fhicl::ParameterSet const& ps)
+    {
+      if (nCalls) ++*nCalls;
+      return ps.get<std::string>("service_type", "") == serviceType;
+    };
+} // selectService()
+
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+void SharedReadTest() {
+
+  std::map<std::string, unsigned int> nReads;
+  detinfo::InputFileMetadataCache cache{ MockReader{ &MockFiles, &nReads } };
+
+  // no consumer: the file is not read at all
+  auto const unread = cache.metadata("clocks_and_properties.root");
+  BOOST_CHECK(!unread->open);
+  BOOST_CHECK_EQUAL(nReads["clocks_and_properties.root"], 0U);
+
+  cache.registerConsumer("Clocks", selectService("DetectorClocksService"));
+  cache.registerConsumer("Properties", selectService("DetectorPropertiesService"));
+  cache.registerConsumer("Nobody", selectService("LArPropertiesService"));
+
+  // all the consumers ask for the same file, which is read once
+  auto const clocks = cache.metadata("clocks_and_properties.root");
+  auto const properties = cache.metadata("clocks_and_properties.root");
+  auto const nobody = cache.metadata("clocks_and_properties.root");
+  BOOST_CHECK_EQUAL(nReads["clocks_and_properties.root"], 1U);
+  BOOST_CHECK_EQUAL(clocks, properties);
+  BOOST_CHECK_EQUAL(clocks, nobody);
+
+  BOOST_CHECK(clocks->open);
+  BOOST_CHECK(clocks->hasMetaDataTree);
+  BOOST_CHECK_EQUAL(clocks->fileFormatVersion, 14);
+
+  auto const& clockSets = clocks->parameterSets("Clocks");
+  BOOST_REQUIRE_EQUAL(clockSets.size(), 2U);
+  BOOST_CHECK_EQUAL(clockSets[0].get<double>("ClockSpeed"), 1.5);
+  BOOST_CHECK_EQUAL(clockSets[1].get<double>("ClockSpeed"), 2.0);
+
+  auto const& propSets = properties->parameterSets("Properties");
+  BOOST_REQUIRE_EQUAL(propSets.size(), 1U);
+  BOOST_CHECK_EQUAL(propSets[0].get<unsigned int>("NumberTimeSamples"), 3200U);
+
+  BOOST_CHECK(nobody->parameterSets("Nobody").empty());
+  BOOST_CHECK(nobody->parameterSets("NotRegistered").empty());
+
+  // a new consumer makes the cached selection incomplete: the file is read again
+  cache.registerConsumer("Geometry", selectService("Geometry"));
+  auto const geometry = cache.metadata("clocks_and_properties.root");
+  BOOST_CHECK_EQUAL(nReads["clocks_and_properties.root"], 2U);
+  BOOST_CHECK_EQUAL(geometry->parameterSets("Geometry").size(), 1U);
+  BOOST_CHECK_EQUAL(geometry->parameterSets("Clocks").size(), 2U);
+
+  // after clear() the file is read again
+  cache.clear();
+  cache.metadata("clocks_and_properties.root");
+  BOOST_CHECK_EQUAL(nReads["clocks_and_properties.root"], 3U);
+
+} // SharedReadTest()
+
+
+void MissingMetadataTreeTest() {
+
+  std::map<std::string, unsigned int> nReads;
+  detinfo::InputFileMetadataCache cache{ MockReader{ &MockFiles, &nReads } };
+
+  unsigned int nSelections = 0U;
+  cache.registerConsumer
+    ("Clocks", selectService("DetectorClocksService", &nSelections));
+
+  auto const metadata = cache.metadata("no_metadata.root");
+  BOOST_CHECK_EQUAL(nReads["no_metadata.root"], 1U);
+  BOOST_CHECK(metadata->open);
+  BOOST_CHECK(!metadata->hasMetaDataTree);
+  BOOST_CHECK_EQUAL(metadata->fileFormatVersion, -1);
+  BOOST_CHECK(metadata->parameterSets("Clocks").empty());
+  BOOST_CHECK_EQUAL(nSelections, 0U);
+
+  // a file which can't be opened
+  auto const missing = cache.metadata("missing.root");
+  BOOST_CHECK(!missing->open);
+  BOOST_CHECK(!missing->hasMetaDataTree);
+  BOOST_CHECK(missing->parameterSets("Clocks").empty());
+
+} // MissingMetadataTreeTest()
+
+
+void UnregisterTest() {
+
+  std::map<std::string, unsigned int> nReads;
+  detinfo::InputFileMetadataCache cache{ MockReader{ &MockFiles, &nReads } };
+
+  unsigned int nClockSelections = 0U;
+  unsigned int nPropSelections = 0U;
+  cache.registerConsumer
+    ("Clocks", selectService("DetectorClocksService", &nClockSelections));
+  cache.registerConsumer
+    ("Properties", selectService("DetectorPropertiesService", &nPropSelections));
+
+  cache.metadata("clocks_and_properties.root");
+  BOOST_CHECK_EQUAL(nClockSelections, 4U);
+  BOOST_CHECK_EQUAL(nPropSelections, 4U);
+
+  // the removed consumer is not asked any more
+  cache.unregisterConsumer("Clocks");
+  cache.clear();
+  auto const metadata = cache.metadata("clocks_and_properties.root");
+  BOOST_CHECK_EQUAL(nReads["clocks_and_properties.root"], 2U);
+  BOOST_CHECK_EQUAL(nClockSelections, 4U);
+  BOOST_CHECK_EQUAL(nPropSelections, 8U);
+  BOOST_CHECK(metadata->parameterSets("Clocks").empty());
+  BOOST_CHECK_EQUAL(metadata->parameterSets("Properties").size(), 1U);
+
+  // with no consumer left, files are not read
+  cache.unregisterConsumer("Properties");
+  cache.unregisterConsumer("NotRegistered");
+  cache.clear();
+  auto const unread = cache.metadata("clocks_and_properties.root");
+  BOOST_CHECK_EQUAL(nReads["clocks_and_properties.root"], 2U);
+  BOOST_CHECK(!unread->open);
+
+} // UnregisterTest()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(SharedReadTestCase) {
+  SharedReadTest();
+}
+
+BOOST_AUTO_TEST_CASE(MissingMetadataTreeTestCase) {
+  MissingMetadataTreeTest();
+}
+
+BOOST_AUTO_TEST_CASE(UnregisterTestCase) {
+  UnregisterTest();
+}
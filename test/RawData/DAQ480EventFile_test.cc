@@ -0,0 +1,126 @@
+/**
+ * @file    DAQ480EventFile_test.cc
+ * @brief   Tests the memory-mapped reader of DAQ480 event files
+ * @date    October 19, 2026
+ * @see     lardata/RawData/utils/DAQ480EventFile.h
+ *
+ * See http://www.boost.org/libs/test for the Boost test library home page.
+ *
+ * Synthetic event files are written in the test directory; the content read
+ * via the mapping is compared with the one read with a stream, the way the
+ * input drivers used to do.
+ */
+
+// C/C++ standard libraries
+#include <cstdio> // std::remove()
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( DAQ480EventFile_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK()
+
+// LArSoft libraries
+#include "lardata/RawData/utils/DAQ480EventFile.h"
+#include "lardataobj/RawData/DAQHeader.h"
+#include "canvas/Utilities/Exception.h"
+#include "DAQ480FileGenerator.h"
+
+
+/// The seed for the default random engine
+constexpr unsigned int RandomSeed = 12345;
+
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+/// Compares the mapped content with the one read via std::ifstream.
+void MappedContentTest() {
+  std::string const path = "DAQ480EventFile_test_content.bin";
+  unsigned short const nChannels = 144;
+  unsigned short const nSamples = 2048;
+  testing::writeDAQ480EventFile(path, nChannels, nSamples, true, RandomSeed);
+
+  lris::DAQ480EventFile const efile(path);
+  BOOST_CHECK_EQUAL(efile.header().fixed, 0x0000D480);
+  BOOST_CHECK_EQUAL(efile.header().run, 211);
+  BOOST_CHECK_EQUAL(efile.header().nchan, nChannels);
+  BOOST_CHECK_EQUAL(efile.channels().size(), nChannels);
+
+  raw::DAQHeader daqHeader;
+  efile.fillDAQHeader(daqHeader);
+  BOOST_CHECK_EQUAL(daqHeader.GetRun(), 211);
+  BOOST_CHECK_EQUAL(daqHeader.GetEvent(), 17);
+  BOOST_CHECK_EQUAL(daqHeader.GetNChannels(), nChannels);
+
+  std::ifstream infile(path, std::ios::binary);
+  lris::daq480::header h1;
+  infile.read((char *) &h1, sizeof h1);
+  for (auto const& block: efile.channels()) {
+    lris::daq480::channel c1;
+    infile.read((char *) &c1, sizeof c1);
+    std::vector<short> adclist(c1.samples);
+    infile.read((char*)&adclist[0],sizeof(short)*c1.samples);
+
+    BOOST_CHECK_EQUAL(block.ch, c1.ch);
+    BOOST_CHECK_EQUAL(block.samples, c1.samples);
+    raw::RawDigit::ADCvector_t const adcs = block.adcVector();
+    BOOST_CHECK_EQUAL_COLLECTIONS
+      (adcs.begin(), adcs.end(), adclist.begin(), adclist.end());
+  } // for
+
+  std::remove(path.c_str());
+} // MappedContentTest()
+
+
+/// Checks that incomplete files are reported.
+void TruncatedFileTest() {
+  std::string const path = "DAQ480EventFile_test_truncated.bin";
+  unsigned short const nChannels = 16;
+  unsigned short const nSamples = 100;
+
+  // no footer: fine only if it is not required
+  std::size_t const size = testing::writeDAQ480EventFile(path, nChannels, nSamples, false, RandomSeed);
+  BOOST_CHECK_THROW(lris::DAQ480EventFile{ path }, art::Exception);
+  BOOST_CHECK_NO_THROW((lris::DAQ480EventFile{ path, -1, false }));
+
+  // more blocks than in the file
+  BOOST_CHECK_THROW((lris::DAQ480EventFile{ path, nChannels + 1, false }), art::Exception);
+
+  // last block cut in the middle of its samples
+  {
+    std::ifstream in(path, std::ios::binary);
+    std::vector<char> content(size - 10);
+    in.read(content.data(), content.size());
+    in.close();
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(content.data(), content.size());
+  }
+  BOOST_CHECK_THROW((lris::DAQ480EventFile{ path, -1, false }), art::Exception);
+  BOOST_CHECK_NO_THROW((lris::DAQ480EventFile{ path, nChannels - 1, false }));
+
+  // not even a header
+  { std::ofstream out(path, std::ios::binary | std::ios::trunc); out << "D480"; }
+  BOOST_CHECK_THROW(lris::DAQ480EventFile{ path }, art::Exception);
+
+  std::remove(path.c_str());
+
+  // no file at all
+  BOOST_CHECK_THROW(lris::DAQ480EventFile{ path }, art::Exception);
+} // TruncatedFileTest()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(MappedContentTestCase) {
+  MappedContentTest();
+}
+
+BOOST_AUTO_TEST_CASE(TruncatedFileTestCase) {
+  TruncatedFileTest();
+}
@@ -0,0 +1,57 @@
+/**
+ * @file    DAQ480FileGenerator.h
+ * @brief   Writes synthetic DAQ480 event files for the tests
+ * @date    October 19, 2026
+ * @see     lardata/RawData/utils/DAQ480EventFile.h
+ */
+
+#ifndef LARDATA_TEST_RAWDATA_DAQ480FILEGENERATOR_H
+#define LARDATA_TEST_RAWDATA_DAQ480FILEGENERATOR_H
+
+// LArSoft libraries
+#include "lardata/RawData/utils/DAQ480EventFile.h"
+
+// C/C++ standard libraries
+#include <cstddef>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace testing {
+
+  /// Writes a synthetic event file with random samples; returns its size.
+  inline std::size_t writeDAQ480EventFile(std::string const& path,
+                                          unsigned short nChannels,
+                                          unsigned short nSamples,
+                                          bool withFooter,
+                                          unsigned int seed,
+                                          unsigned short run = 211,
+                                          unsigned short event = 17)
+  {
+    std::default_random_engine random_engine(seed);
+    std::uniform_int_distribution<short> uniform(0, 4095);
+
+    std::ofstream out(path, std::ios::binary);
+    lris::daq480::header h1 = {
+      0x0000D480, 0x0001, 0x0600, run, event, 1285000000, 0, nChannels
+    };
+    out.write((char const*) &h1, sizeof h1);
+    std::vector<short> adclist(nSamples);
+    for (unsigned short ch = 1; ch <= nChannels; ++ch) {
+      lris::daq480::channel c1 = { ch, nSamples };
+      out.write((char const*) &c1, sizeof c1);
+      for (short& adc: adclist) adc = uniform(random_engine);
+      out.write((char const*) adclist.data(), sizeof(short) * nSamples);
+    }
+    if (withFooter) {
+      lris::daq480::footer f1 = { 0, 0 };
+      out.write((char const*) &f1, sizeof f1);
+    }
+    return out.tellp();
+  } // writeDAQ480EventFile()
+
+} // namespace testing
+
+#endif // LARDATA_TEST_RAWDATA_DAQ480FILEGENERATOR_H
@@ -0,0 +1,157 @@
+/**
+ * @file    EventFilePrefetcher_test.cc
+ * @brief   Tests the background decoding of event files
+ * @date    October 19, 2026
+ * @see     lardata/RawData/utils/EventFilePrefetcher.h
+ *
+ * See http://www.boost.org/libs/test for the Boost test library home page.
+ *
+ * Synthetic DAQ480 event files are written in the test directory and decoded
+ * into raw::RawDigit with different prefetching windows.
+ */
+
+// C/C++ standard libraries
+#include <cstdio> // std::remove()
+#include <string>
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( EventFilePrefetcher_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK()
+
+// LArSoft libraries
+#include "lardata/RawData/utils/EventFilePrefetcher.h"
+#include "lardata/RawData/utils/DAQ480EventFile.h"
+#include "lardataobj/RawData/RawDigit.h"
+#include "lardataobj/RawData/DAQHeader.h"
+#include "canvas/Utilities/Exception.h"
+#include "DAQ480FileGenerator.h"
+
+
+/// The seed for the default random engine
+constexpr unsigned int RandomSeed = 12345;
+
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+/// Products from one event file, like in the input drivers.
+struct Event_t {
+  std::vector<raw::RawDigit> digits;
+  raw::DAQHeader             daqHeader;
+};
+
+/// Decodes the file the way LArRawInputDriver does.
+void decodeFile(std::string const& path, Event_t& event) {
+  lris::DAQ480EventFile const efile(path);
+  efile.fillDAQHeader(event.daqHeader);
+  event.digits.clear();
+  event.digits.reserve(efile.channels().size());
+  for (auto const& c1: efile.channels()) {
+    event.digits.emplace_back(c1.ch - 1, c1.samples, c1.adcVector());
+    event.digits.back().SetPedestal(400.);
+  }
+} // decodeFile()
+
+
+/// Writes a list of event files, each with its own event number.
+std::vector<std::string> writeEventFiles(
+  std::string const& stem, unsigned int nFiles,
+  unsigned short nChannels, unsigned short nSamples
+) {
+  std::vector<std::string> files;
+  for (unsigned int i = 0; i < nFiles; ++i) {
+    files.push_back(stem + "_" + std::to_string(i) + ".bin");
+    testing::writeDAQ480EventFile
+      (files.back(), nChannels, nSamples, true, RandomSeed + i, 211, i + 1);
+  }
+  return files;
+} // writeEventFiles()
+
+
+void removeFiles(std::vector<std::string> const& files)
+  { for (auto const& file: files) std::remove(file.c_str()); }
+
+
+/// Reads all the events with the specified window.
+std::vector<Event_t> readAll
+  (std::vector<std::string> const& files, unsigned int window)
+{
+  lris::EventFilePrefetcher<Event_t> prefetcher(window);
+  prefetcher.start(files, decodeFile);
+  std::vector<Event_t> events;
+  while (!prefetcher.done()) {
+    BOOST_CHECK_EQUAL(prefetcher.nextIndex(), events.size());
+    events.push_back(prefetcher.next());
+  }
+  return events;
+} // readAll()
+
+
+/// Checks that the events come in file order, with the same content.
+void OrderTest() {
+  std::vector<std::string> const files
+    = writeEventFiles("EventFilePrefetcher_test_order", 24, 48, 256);
+
+  std::vector<Event_t> const expected = readAll(files, 0U);
+  BOOST_CHECK_EQUAL(expected.size(), files.size());
+
+  for (unsigned int window: { 1U, 3U, 8U, 64U }) {
+    std::vector<Event_t> const events = readAll(files, window);
+    BOOST_CHECK_EQUAL(events.size(), expected.size());
+    for (std::size_t i = 0; i < events.size(); ++i) {
+      BOOST_CHECK_EQUAL(events[i].daqHeader.GetEvent(), i + 1);
+      BOOST_CHECK_EQUAL(events[i].digits.size(), expected[i].digits.size());
+      for (std::size_t j = 0; j < events[i].digits.size(); ++j) {
+        auto const& adcs = events[i].digits[j].ADCs();
+        auto const& expectedADCs = expected[i].digits[j].ADCs();
+        BOOST_CHECK_EQUAL(events[i].digits[j].Channel(), expected[i].digits[j].Channel());
+        BOOST_CHECK(adcs == expectedADCs);
+      } // for digits
+    } // for events
+  } // for windows
+
+  // the list can be dropped before its end, and restarted
+  lris::EventFilePrefetcher<Event_t> prefetcher(4U);
+  prefetcher.start(files, decodeFile);
+  prefetcher.next();
+  prefetcher.stop();
+  prefetcher.start(files, decodeFile);
+  BOOST_CHECK_EQUAL(prefetcher.next().daqHeader.GetEvent(), 1);
+
+  removeFiles(files);
+} // OrderTest()
+
+
+/// Checks that decoding errors are reported for the right file.
+void ErrorTest() {
+  std::vector<std::string> files
+    = writeEventFiles("EventFilePrefetcher_test_error", 8, 16, 64);
+  files[5] = "EventFilePrefetcher_test_error_missing.bin";
+
+  for (unsigned int window: { 0U, 2U, 8U }) {
+    lris::EventFilePrefetcher<Event_t> prefetcher(window);
+    prefetcher.start(files, decodeFile);
+    for (unsigned int i = 0; i < 5; ++i)
+      BOOST_CHECK_EQUAL(prefetcher.next().daqHeader.GetEvent(), i + 1);
+    BOOST_CHECK_THROW(prefetcher.next(), art::Exception);
+    BOOST_CHECK_EQUAL(prefetcher.next().daqHeader.GetEvent(), 7);
+  } // for windows
+
+  removeFiles(files);
+} // ErrorTest()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(OrderTestCase) {
+  OrderTest();
+}
+
+BOOST_AUTO_TEST_CASE(ErrorTestCase) {
+  ErrorTest();
+}
@@ -0,0 +1,283 @@
+/**
+ * @file    RawDigitFormat_test.cc
+ * @brief   Regression test of the raw format decoding against the legacy code
+ * @date    October 19, 2026
+ * @see     lardata/RawData/utils/RawDigitFormat.h
+ * @see     lardata/RawData/utils/DAQ480Format.h
+ *
+ * See http://www.boost.org/libs/test for the Boost test library home page.
+ *
+ * The reference decoding functions are the stream-based loops the input
+ * drivers used before the formats were described by `lris::RawDigitFormat`.
+ * Each format must produce the same `raw::RawDigit` collection, with one or
+ * more threads.
+ */
+
+// C/C++ standard libraries
+#include <cmath> // std::abs()
+#include <cstdio> // std::remove()
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( RawDigitFormat_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK()
+
+// LArSoft libraries
+#include "lardata/RawData/utils/DAQ480Format.h"
+#include "lardata/RawData/utils/DAQ480EventFile.h"
+#include "lardata/RawData/utils/RawDigitFormat.h"
+#include "lardataobj/RawData/RawDigit.h"
+#include "lardataobj/RawData/ExternalTrigger.h"
+#include "DAQ480FileGenerator.h"
+
+
+/// The seed for the default random engine
+constexpr unsigned int RandomSeed = 12345;
+
+
+//------------------------------------------------------------------------------
+//--- Legacy decoding (reference)
+//
+
+/// Reads header and wire blocks the legacy way; returns the run number.
+template <typename Op>
+unsigned short legacyRead(std::ifstream& infile, int nBlocks, Op op) {
+  lris::daq480::header h1;
+  infile.read((char *) &h1, sizeof h1);
+  if (nBlocks < 0) nBlocks = h1.nchan;
+  for( int i = 0; i != nBlocks; ++i ) {
+    lris::daq480::channel c1;
+    infile.read((char *) &c1, sizeof c1);
+    std::vector<short> adclist(c1.samples);
+    infile.read((char*)&adclist[0],sizeof(short)*c1.samples);
+    op(i, h1, c1, adclist);
+  }
+  return h1.run;
+} // legacyRead()
+
+
+void legacyArgoNeuT(std::string const& path, std::vector<raw::RawDigit>& digitList) {
+  std::ifstream infile(path, std::ios::binary);
+  digitList.clear();
+  digitList.resize(240*2);
+  legacyRead(infile, -1, [&digitList](int i, auto const&, auto const& c1, auto const& adclist){
+      digitList[i] = raw::RawDigit((c1.ch-1), c1.samples, adclist);
+      digitList[i].SetPedestal(400.);
+    });
+} // legacyArgoNeuT()
+
+
+void legacyShortBo(std::string const& path, std::vector<raw::RawDigit>& digitList) {
+  std::ifstream infile(path, std::ios::binary);
+  digitList.clear();
+  digitList.resize(48*3);
+  legacyRead(infile, -1, [&digitList](int i, auto const& h1, auto const& c1, auto const& adclist){
+      int iw = i;
+      if (h1.run<280 && h1.run>192) {
+        if (i==92) iw=95;
+        if (i==93) iw=94;
+        if (i==94) iw=93;
+        if (i==95) iw=92;
+      }
+      digitList[i] = raw::RawDigit(iw, c1.samples, adclist);
+      digitList[i].SetPedestal(400.);
+    });
+} // legacyShortBo()
+
+
+void legacyLongBo(std::string const& path,
+                  std::vector<raw::RawDigit>& digitList,
+                  std::vector<raw::ExternalTrigger>& extTrig)
+{
+  std::ifstream infile(path, std::ios::binary);
+  digitList.clear();
+  digitList.resize(48*3);
+  legacyRead(infile, 144, [&digitList](int i, auto const&, auto const& c1, auto adclist){
+      for (int ijk=0;ijk<c1.samples;++ijk) {
+        if (std::abs(adclist[ijk])<1e-5)
+          adclist[ijk]+=400;
+      }
+      if (i>63 && i<80) {
+        for (int ijk=0;ijk<c1.samples;++ijk) {
+          int mysig=adclist[ijk]-400;
+          adclist[ijk]=400-mysig;
+        }
+      }
+      if (i<96){
+        digitList[i] = raw::RawDigit(i, c1.samples, adclist);
+        digitList[i].SetPedestal(400.);
+      }
+      else{
+        digitList[239-i] = raw::RawDigit(239-i, c1.samples, adclist);
+        digitList[239-i].SetPedestal(400.);
+      }
+    });
+
+  extTrig.clear();
+  extTrig.resize(16);
+  for( int i = 0; i < 16; ++i ) {
+    unsigned int utrigtime = 0;
+    lris::daq480::channel c1;
+    infile.read((char *) &c1, sizeof c1);
+    std::vector<short> adclist(c1.samples);
+    infile.read((char*)&adclist[0],sizeof(short)*c1.samples);
+    int j=0;
+    while (j<c1.samples){
+      float test = 400.0-adclist[j];
+      if (test>10 && j>0) {
+        utrigtime=j;
+        break;
+      }
+      j++;
+    }
+    extTrig[i] = raw::ExternalTrigger(i+144,utrigtime);
+  }
+} // legacyLongBo()
+
+
+void legacyJP250L(std::vector<unsigned short> const& m_data,
+                  unsigned short m_nChannels, unsigned short m_nSamples,
+                  std::vector<raw::RawDigit>& rdcol)
+{
+  std::vector<short> adcVec(m_nSamples,0);
+  for(unsigned int n = 0; n < m_nChannels; ++n){
+    adcVec.clear();
+    for(unsigned int i = 0; i < m_nSamples; ++i){
+      adcVec.push_back(m_data[(m_nSamples+4)*n+(4+i)]);
+    }
+    rdcol.push_back(raw::RawDigit(n,m_nSamples,adcVec));
+  }
+} // legacyJP250L()
+
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+void checkSameDigits
+  (std::vector<raw::RawDigit> const& digits, std::vector<raw::RawDigit> const& expected)
+{
+  BOOST_CHECK_EQUAL(digits.size(), expected.size());
+  for (std::size_t i = 0; i < std::min(digits.size(), expected.size()); ++i) {
+    raw::RawDigit const& digit = digits[i];
+    raw::RawDigit const& expectedDigit = expected[i];
+    BOOST_TEST_CONTEXT("digit #" << i) {
+      BOOST_CHECK_EQUAL(digit.Channel(), expectedDigit.Channel());
+      BOOST_CHECK_EQUAL(digit.Samples(), expectedDigit.Samples());
+      BOOST_CHECK_EQUAL(digit.GetPedestal(), expectedDigit.GetPedestal());
+      BOOST_CHECK_EQUAL(digit.GetSigma(), expectedDigit.GetSigma());
+      BOOST_CHECK(digit.Compression() == expectedDigit.Compression());
+      BOOST_CHECK(digit.ADCs() == expectedDigit.ADCs());
+    }
+  } // for
+} // checkSameDigits()
+
+
+void ArgoNeuTTest() {
+  std::string const path = "RawDigitFormat_test_argoneut.bin";
+  testing::writeDAQ480EventFile(path, 480, 2048, true, RandomSeed);
+
+  std::vector<raw::RawDigit> expected;
+  legacyArgoNeuT(path, expected);
+
+  for (unsigned int nThreads: { 1U, 4U }) {
+    lris::DAQ480Event event;
+    lris::DecodeDAQ480File(path, lris::ArgoNeuTFormat(), event, nThreads);
+    checkSameDigits(event.digits, expected);
+    BOOST_CHECK(event.triggers.empty());
+  }
+  std::remove(path.c_str());
+} // ArgoNeuTTest()
+
+
+void ShortBoTest() {
+  std::string const path = "RawDigitFormat_test_shortbo.bin";
+  for (unsigned short run: { 150, 211 }) { // without and with wire swap
+    testing::writeDAQ480EventFile(path, 144, 2048, true, RandomSeed + run, run);
+
+    std::vector<raw::RawDigit> expected;
+    legacyShortBo(path, expected);
+
+    for (unsigned int nThreads: { 1U, 4U }) {
+      lris::DAQ480Event event;
+      lris::DecodeDAQ480File(path, lris::ShortBoFormat(), event, nThreads);
+      checkSameDigits(event.digits, expected);
+    }
+  }
+  std::remove(path.c_str());
+} // ShortBoTest()
+
+
+void LongBoTest() {
+  std::string const path = "RawDigitFormat_test_longbo.bin";
+  // 144 wires and 16 trigger inputs; random samples include zeroes
+  testing::writeDAQ480EventFile(path, 160, 2048, false, RandomSeed);
+
+  std::vector<raw::RawDigit> expected;
+  std::vector<raw::ExternalTrigger> expectedTrig;
+  legacyLongBo(path, expected, expectedTrig);
+
+  for (unsigned int nThreads: { 1U, 4U }) {
+    lris::DAQ480Event event;
+    lris::DecodeDAQ480File(path, lris::LongBoFormat(), event, nThreads);
+    checkSameDigits(event.digits, expected);
+    BOOST_CHECK_EQUAL(event.triggers.size(), expectedTrig.size());
+    for (std::size_t i = 0; i < expectedTrig.size(); ++i) {
+      BOOST_CHECK_EQUAL(event.triggers[i].GetTrigID(), expectedTrig[i].GetTrigID());
+      BOOST_CHECK_EQUAL(event.triggers[i].GetTrigTime(), expectedTrig[i].GetTrigTime());
+    }
+  }
+  std::remove(path.c_str());
+} // LongBoTest()
+
+
+void JP250LTest() {
+  // the JP250L data block: (nSamples+4) words per channel
+  unsigned short const nChannels = 256;
+  unsigned short const nSamples = 1024;
+  std::default_random_engine random_engine(RandomSeed);
+  std::uniform_int_distribution<unsigned short> uniform;
+  std::vector<unsigned short> data((nSamples+4)*nChannels);
+  for (unsigned short& word: data) word = uniform(random_engine);
+
+  std::vector<raw::RawDigit> expected;
+  legacyJP250L(data, nChannels, nSamples, expected);
+
+  // the description used by LArRawInputDriverJP250L
+  lris::RawDigitFormat const format = lris::JP250LFormat(nChannels);
+  std::vector<lris::RawChannelBlock> const blocks
+    = lris::JP250LChannelBlocks(data.data(), nChannels, nSamples);
+  BOOST_CHECK_EQUAL(format.nDigits, nChannels);
+  BOOST_CHECK_EQUAL(blocks.size(), nChannels);
+
+  for (unsigned int nThreads: { 1U, 4U }) {
+    std::vector<raw::RawDigit> digits;
+    lris::BuildRawDigits(blocks, format, 1, digits, nThreads);
+    checkSameDigits(digits, expected);
+  }
+} // JP250LTest()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(ArgoNeuTTestCase) {
+  ArgoNeuTTest();
+}
+
+BOOST_AUTO_TEST_CASE(ShortBoTestCase) {
+  ShortBoTest();
+}
+
+BOOST_AUTO_TEST_CASE(LongBoTestCase) {
+  LongBoTest();
+}
+
+BOOST_AUTO_TEST_CASE(JP250LTestCase) {
+  JP250LTest();
+}
@@ -26,6 +26,8 @@
 
 // C/C++ standard libraries
 #include <memory> // std::make_unique()
+#include <thread>
+#include <vector>
 
 
 namespace lar {
@@ -44,6 +46,9 @@ namespace lar {
     *
     * * *nPoints* (unsigned integer, default: 10): number of space points to
     *     generate
+    * * *concurrent* (boolean, default: false): fills the space points from
+    *     multiple threads, via `recob::ConcurrentChargedSpacePointCollectionCreator`
+    *     (`set()`, `add()` and `addAll()`), and checks the final content
     *
     */
     class ChargedSpacePointProxyInputMaker: public art::EDProducer {
@@ -59,6 +64,12 @@ namespace lar {
           10U // default
           };
 
+        fhicl::Atom<bool> concurrent {
+          Name("concurrent"),
+          Comment("fill the points from multiple threads."),
+          false // default
+          };
+
       }; // struct Config
 
       using Parameters = art::EDProducer::Table<Config>;
@@ -69,6 +80,10 @@ namespace lar {
 
         private:
       unsigned int nPoints; ///< Number of points to generate.
+      bool concurrent; ///< Whether to use the concurrent creator.
+
+      /// Produces the points with the concurrent collection creator.
+      void produceConcurrently(art::Event& event) const;
 
     };  // ChargedSpacePointProxyInputMaker
 
@@ -84,6 +99,7 @@ lar::test::ChargedSpacePointProxyInputMaker::ChargedSpacePointProxyInputMaker
   (Parameters const& config)
   : EDProducer{config}
   , nPoints(config().nPoints())
+  , concurrent(config().concurrent())
 {
 
   // declare production of recob::SpacePoint and recob::PointCharge collections:
@@ -94,6 +110,11 @@ lar::test::ChargedSpacePointProxyInputMaker::ChargedSpacePointProxyInputMaker
 // -----------------------------------------------------------------------------
 void lar::test::ChargedSpacePointProxyInputMaker::produce(art::Event& event) {
 
+  if (concurrent) {
+    produceConcurrently(event);
+    return;
+  }
+
   auto spacePoints = recob::ChargedSpacePointCollectionCreator::forPtrs(event);
 
   BOOST_CHECK(spacePoints.empty());
@@ -128,4 +149,97 @@ void lar::test::ChargedSpacePointProxyInputMaker::produce(art::Event& event) {
 
 } // lar::test::ChargedSpacePointProxyInputMaker::produce()
 
+void lar::test::ChargedSpacePointProxyInputMaker::produceConcurrently
+  (art::Event& event) const
+{
+
+  auto spacePoints
+    = recob::ConcurrentChargedSpacePointCollectionCreator::forPtrs
+    (event, nPoints);
+
+  BOOST_CHECK(spacePoints.empty());
+  BOOST_CHECK_EQUAL(spacePoints.capacity(), (std::size_t) nPoints);
+
+  // the first third of the points is reserved in one go, so that their order
+  // is deterministic, and filled with `set()`; the threads then insert the
+  // others, some with `add()` one at a time, some with `addAll()` in blocks
+  std::size_t const nSet = nPoints / 3U;
+  std::size_t const first = spacePoints.reserve(nSet);
+  BOOST_CHECK_EQUAL(first, 0U);
+
+  const double err[6U] = { 1.0, 0.0, 1.0, 0.0, 0.0, 1.0 };
+
+  auto makePoint = [&err](unsigned int iPoint)
+    {
+      double const pos[3U]
+        = { double(iPoint), double(2.0 * iPoint), double(4.0 * iPoint) };
+      return recob::SpacePoint{ pos, err, 1.0 /* chisq */, int(iPoint) /* id */ };
+    };
+  auto makeCharge = [](unsigned int iPoint)
+    { return recob::PointCharge{ recob::PointCharge::Charge_t(iPoint) }; };
+
+  unsigned int const nThreads = 4U;
+  unsigned int const blockSize = 4U; // points in each addAll() call
+  std::vector<std::thread> workers;
+  for (unsigned int iThread = 0; iThread < nThreads; ++iThread) {
+    workers.emplace_back([&, iThread, nPoints=nPoints](){
+      for (unsigned int iPoint = iThread; iPoint < nSet; iPoint += nThreads)
+        spacePoints.set(iPoint, makePoint(iPoint), makeCharge(iPoint));
+
+      bool const useAddAll = (iThread % 2U == 1U);
+      std::vector<recob::SpacePoint> points;
+      std::vector<recob::PointCharge> charges;
+      for (unsigned int iPoint = nSet + iThread; iPoint < nPoints;
+        iPoint += nThreads
+      ) {
+        if (!useAddAll) {
+          spacePoints.add(makePoint(iPoint), makeCharge(iPoint));
+          continue;
+        }
+        points.push_back(makePoint(iPoint));
+        charges.push_back(makeCharge(iPoint));
+        if (points.size() < blockSize) continue;
+        spacePoints.addAll(std::move(points), std::move(charges)); // empties them
+      } // for (iPoint)
+      if (!points.empty()) spacePoints.addAll(points, charges);
+    });
+  } // for (iThread)
+  for (auto& worker: workers) worker.join();
+
+  BOOST_CHECK_EQUAL(spacePoints.size(), (std::size_t) nPoints);
+
+  // each point is there exactly once, together with its charge
+  std::vector<unsigned int> nCopies(nPoints, 0U);
+  for (unsigned int iPoint = 0; iPoint < nPoints; ++iPoint) {
+    recob::SpacePoint const& point = spacePoints.spacePoint(iPoint);
+    mf::LogVerbatim("ChargedSpacePointProxyInputMaker")
+      << "[#" << iPoint << "] point: " << point
+      << " (ptr: " << spacePoints.spacePointPtr(iPoint)
+      << "); charge: " << spacePoints.charge(iPoint)
+      << " (ptr: " << spacePoints.chargePtr(iPoint) << ")";
+
+    int const id = point.ID();
+    BOOST_TEST_CONTEXT("point #" << iPoint << " (ID=" << id << ")") {
+      if (iPoint < nSet) BOOST_CHECK_EQUAL(id, (int) iPoint);
+      BOOST_REQUIRE_GE(id, 0);
+      BOOST_REQUIRE_LT(id, (int) nPoints);
+      BOOST_CHECK_EQUAL(point.XYZ()[0], double(id));
+      BOOST_CHECK_EQUAL(point.XYZ()[2], double(4.0 * id));
+      BOOST_CHECK_EQUAL
+        (spacePoints.charge(iPoint).charge(), recob::PointCharge::Charge_t(id));
+    }
+    ++nCopies[id];
+  } // for (iPoint)
+  for (unsigned int iPoint = 0; iPoint < nPoints; ++iPoint)
+    BOOST_CHECK_EQUAL(nCopies[iPoint], 1U);
+
+  mf::LogInfo("ChargedSpacePointProxyInputMaker")
+    << "Produced " << spacePoints.size() << " points and charges"
+    << " from " << nThreads << " threads.";
+
+  spacePoints.put();
+  BOOST_CHECK(spacePoints.empty());
+
+} // lar::test::ChargedSpacePointProxyInputMaker::produceConcurrently()
+
 DEFINE_ART_MODULE(lar::test::ChargedSpacePointProxyInputMaker)
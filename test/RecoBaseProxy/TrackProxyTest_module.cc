@@ -88,6 +88,9 @@ class TrackProxyTest : public art::EDAnalyzer {
   /// Performs the actual test.
   void testTracks(art::Event const& event);
 
+  /// Tests the lazy track proxy and the columnar point information.
+  void testLazyTracks(art::Event const& event);
+
   /// Single-track processing function example.
   template <typename Track>
   void processTrack(Track const& track) const;
@@ -370,6 +373,94 @@ void TrackProxyTest::testTracks(art::Event const& event) {
 } // TrackProxyTest::testTracks()
 
 
+//------------------------------------------------------------------------------
+void TrackProxyTest::testLazyTracks(art::Event const& event) {
+
+  auto expectedTracksHandle
+    = event.getValidHandle<std::vector<recob::Track>>(tracksTag);
+  auto const& expectedTracks = *expectedTracksHandle;
+
+  art::FindManyP<recob::Hit> hitsPerTrack
+    (expectedTracksHandle, event, tracksTag);
+
+  auto tracks = proxy::getCollection<proxy::LazyTracks>(event, tracksTag
+    , proxy::withLazyAssociatedAs<recob::Hit, tag::SpecialHits>()
+    , proxy::withFitHitInfo()
+    );
+
+  decltype(auto) lazyHits = tracks.get<recob::Hit>();
+  decltype(auto) lazySpecialHits = tracks.get<tag::SpecialHits>();
+
+  // nothing has been accessed yet
+  BOOST_CHECK(!lazyHits.isMaterialized());
+  BOOST_CHECK(!lazySpecialHits.isMaterialized());
+
+  BOOST_CHECK_EQUAL(tracks.size(), expectedTracks.size());
+
+  std::size_t iExpectedTrack = 0;
+  for (auto const& trackProxy: tracks) {
+    BOOST_TEST_CHECKPOINT("Track #" << trackProxy.index());
+
+    auto const& expectedHits = hitsPerTrack.at(iExpectedTrack);
+
+    BOOST_CHECK_EQUAL(trackProxy.nHits(), expectedHits.size());
+    BOOST_CHECK_EQUAL
+      (trackProxy.get<tag::SpecialHits>().size(), expectedHits.size());
+
+    std::size_t iHit = 0;
+    for (art::Ptr<recob::Hit> const& hitPtr: trackProxy.hits()) {
+      BOOST_CHECK_EQUAL(hitPtr, expectedHits.at(iHit));
+      ++iHit;
+    } // for hits
+    BOOST_CHECK_EQUAL(iHit, expectedHits.size());
+
+    ++iExpectedTrack;
+  } // for
+  BOOST_CHECK_EQUAL(iExpectedTrack, expectedTracks.size());
+
+  BOOST_CHECK(lazyHits.isMaterialized());
+  BOOST_CHECK(lazySpecialHits.isMaterialized());
+
+  //
+  // columnar point information
+  //
+  auto const columns = proxy::makeTrackPointColumns(tracks);
+  BOOST_CHECK_EQUAL(columns.nTracks(), expectedTracks.size());
+
+  std::size_t nExpectedPoints = 0U;
+  for (std::size_t iTrack = 0; iTrack < expectedTracks.size(); ++iTrack) {
+    BOOST_TEST_CHECKPOINT("Columns of track #" << iTrack);
+
+    recob::Track const& expectedTrack = expectedTracks[iTrack];
+    auto const& trackProxy = tracks[iTrack];
+
+    BOOST_CHECK_EQUAL(columns.beginPoint(iTrack), nExpectedPoints);
+    BOOST_CHECK_EQUAL(columns.nPoints(iTrack), expectedTrack.NPoints());
+
+    for (std::size_t iPoint = 0; iPoint < expectedTrack.NPoints(); ++iPoint) {
+      std::size_t const i = columns.beginPoint(iTrack) + iPoint;
+      auto const& expectedPos
+        = expectedTrack.Trajectory().LocationAtPoint(iPoint);
+      auto const& expectedMom = expectedTrack.MomentumVectorAtPoint(iPoint);
+      BOOST_CHECK_EQUAL(columns.x[i], expectedPos.X());
+      BOOST_CHECK_EQUAL(columns.y[i], expectedPos.Y());
+      BOOST_CHECK_EQUAL(columns.z[i], expectedPos.Z());
+      BOOST_CHECK_EQUAL(columns.px[i], expectedMom.X());
+      BOOST_CHECK_EQUAL(columns.py[i], expectedMom.Y());
+      BOOST_CHECK_EQUAL(columns.pz[i], expectedMom.Z());
+      BOOST_CHECK_EQUAL(columns.flags[i], expectedTrack.FlagsAtPoint(iPoint));
+      BOOST_CHECK_EQUAL(columns.hitPtrs[i], trackProxy.hitAtPoint(iPoint));
+    } // for points
+
+    nExpectedPoints += expectedTrack.NPoints();
+  } // for tracks
+  BOOST_CHECK_EQUAL(columns.nPoints(), nExpectedPoints);
+  BOOST_CHECK_EQUAL(columns.x.size(), nExpectedPoints);
+  BOOST_CHECK_EQUAL(columns.hitPtrs.size(), nExpectedPoints);
+
+} // TrackProxyTest::testLazyTracks()
+
+
 //------------------------------------------------------------------------------
 void TrackProxyTest::analyze(art::Event const& event) {
 
@@ -382,6 +473,7 @@ void TrackProxyTest::analyze(art::Event const& event) {
 
   // actual test
   testTracks(event);
+  testLazyTracks(event);
 
   // "test" that track proxies survive their collection (part II)
   mf::LogVerbatim("TrackProxyTest")
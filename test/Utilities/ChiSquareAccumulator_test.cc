@@ -63,6 +63,52 @@ void testChiSquareAccumulator() {
 } // testChiSquareAccumulator()
 
 
+//------------------------------------------------------------------------------
+void testChiSquareAccumulator_remove() {
+
+  auto one = [](double){ return 1.0; };
+
+  auto chiSquare = lar::util::makeChiSquareAccumulator(one);
+
+  chiSquare.add(1.0, 1.0);
+  chiSquare.add(2.0, 0.5);
+  chiSquare.add(3.0, 2.0, 0.5);
+  BOOST_CHECK_EQUAL(chiSquare.N(), 3U);
+  BOOST_CHECK_CLOSE(chiSquare(), 4.25, 1e-4);
+
+  chiSquare.remove(2.0, 0.5);
+  BOOST_CHECK_EQUAL(chiSquare.N(), 2U);
+  BOOST_CHECK_CLOSE(chiSquare(), 4.0, 1e-4);
+
+  chiSquare.remove(3.0, 2.0, 0.5);
+  BOOST_CHECK_EQUAL(chiSquare.N(), 1U);
+  BOOST_CHECK_SMALL(chiSquare(), 1e-5);
+
+  // removing the last point leaves an exact 0
+  chiSquare.add(4.0, 3.0, 0.1);
+  chiSquare.remove(4.0, 3.0, 0.1);
+  chiSquare.remove(1.0, 1.0);
+  BOOST_CHECK_EQUAL(chiSquare.N(), 0U);
+  BOOST_CHECK_EQUAL(chiSquare(), 0.0);
+
+  // sliding window of 3 points
+  double const y[] = { 1.0, 3.0, 0.0, 2.0, 1.5, -1.0, 1.0 };
+  constexpr unsigned int N = sizeof(y) / sizeof(y[0]);
+  constexpr unsigned int Window = 3U;
+  for (unsigned int i = 0; i < Window; ++i) chiSquare.add(i, y[i]);
+  for (unsigned int first = 1; first + Window <= N; ++first) {
+    chiSquare.remove(first - 1, y[first - 1]);
+    chiSquare.add(first + Window - 1, y[first + Window - 1]);
+
+    auto expected = lar::util::makeChiSquareAccumulator(one);
+    for (unsigned int i = first; i < first + Window; ++i) expected.add(i, y[i]);
+    BOOST_CHECK_EQUAL(chiSquare.N(), Window);
+    BOOST_CHECK_CLOSE(chiSquare(), expected(), 1e-8);
+  } // for
+
+} // testChiSquareAccumulator_remove()
+
+
 //------------------------------------------------------------------------------
 void testChiSquareAccumulator_documentation() {
   /*
@@ -151,6 +197,7 @@ void testMakeChiSquareAccumulator_documentation2() {
 BOOST_AUTO_TEST_CASE(ChiSquareAccumulatorTestCase) {
 
   testChiSquareAccumulator();
+  testChiSquareAccumulator_remove();
   testChiSquareAccumulator_documentation();
   testMakeChiSquareAccumulator_documentation1();
   testMakeChiSquareAccumulator_documentation2();
@@ -0,0 +1,208 @@
+/**
+ * @file    FlatUniqueRangeSet_test.cc
+ * @brief   Tests the flat set of non-overlapping ranges
+ * @date    October 19, 2026
+ * @see     lardata/Utilities/FlatUniqueRangeSet.h
+ *
+ * See http://www.boost.org/libs/test for the Boost test library home page.
+ *
+ * The content is compared with the one of `util::UniqueRangeSet` filled with
+ * the same ranges.
+ */
+
+// C/C++ standard libraries
+#include <vector>
+#include <random>
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( FlatUniqueRangeSet_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK()
+
+// LArSoft libraries
+#include "lardata/Utilities/FlatUniqueRangeSet.h"
+#include "lardata/Utilities/UniqueRangeSet.h"
+
+
+/// The seed for the default random engine
+constexpr unsigned int RandomSeed = 12345;
+
+using Range_t = util::Range<int>;
+
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+/// Returns `n` random ranges in [ 0, maxTick ], of length up to `maxLength`.
+std::vector<Range_t> randomRanges
+  (std::default_random_engine& engine, unsigned int n, int maxTick, int maxLength)
+{
+  std::uniform_int_distribution<int> startDist(0, maxTick - maxLength);
+  std::uniform_int_distribution<int> lengthDist(0, maxLength);
+  std::vector<Range_t> ranges;
+  ranges.reserve(n);
+  for (unsigned int i = 0; i < n; ++i) {
+    int const start = startDist(engine);
+    ranges.emplace_back(start, start + lengthDist(engine));
+  }
+  return ranges;
+} // randomRanges()
+
+
+/// Checks that the two sets have the same ranges.
+template <typename SetA, typename SetB>
+void CheckSameRanges(SetA const& a, SetB const& b) {
+  BOOST_CHECK_EQUAL(a.size(), b.size());
+  auto ib = b.begin();
+  for (auto const& range: a) {
+    if (ib == b.end()) break;
+    BOOST_CHECK_EQUAL(range.Start(), ib->Start());
+    BOOST_CHECK_EQUAL(range.End(), ib->End());
+    ++ib;
+  }
+} // CheckSameRanges()
+
+
+//------------------------------------------------------------------------------
+void InsertTest() {
+
+  std::default_random_engine engine(RandomSeed);
+  for (unsigned int iTrial = 0; iTrial < 200; ++iTrial) {
+    BOOST_TEST_CHECKPOINT("trial #" << iTrial);
+    unsigned int const n = 1 + iTrial % 100;
+    std::vector<Range_t> const ranges
+      = randomRanges(engine, n, 1000, 1 + iTrial % 40);
+
+    util::UniqueRangeSet<int> expected;
+    util::FlatUniqueRangeSet<int> flat;
+    for (Range_t const& range: ranges) {
+      std::size_t const nMerged = flat.insert(range);
+      BOOST_CHECK_EQUAL(nMerged, expected.insert(range));
+    }
+    CheckSameRanges(flat, expected);
+
+    // bulk insertion, in two batches
+    util::FlatUniqueRangeSet<int> bulk;
+    auto const middle = ranges.begin() + n / 2;
+    std::size_t nMerged = bulk.insert(ranges.begin(), middle);
+    nMerged += bulk.insert(middle, ranges.end());
+    CheckSameRanges(bulk, expected);
+    BOOST_CHECK_EQUAL(nMerged, n - expected.size());
+
+    util::FlatUniqueRangeSet<int> bulkAll;
+    bulkAll.insert(ranges);
+    CheckSameRanges(bulkAll, expected);
+
+    // merging sets
+    util::FlatUniqueRangeSet<int> merged;
+    merged.Merge(bulk);
+    merged.Merge(flat);
+    CheckSameRanges(merged, expected);
+
+    BOOST_CHECK_EQUAL(flat.Start(), expected.Start());
+    BOOST_CHECK_EQUAL(flat.End(), expected.End());
+  } // for
+
+  util::FlatUniqueRangeSet<int> empty;
+  BOOST_CHECK_THROW(empty.Start(), std::runtime_error);
+  BOOST_CHECK_THROW(empty.emplace(5, 3), std::runtime_error);
+  BOOST_CHECK_EQUAL(empty.insert(std::vector<Range_t>{}), 0U);
+  BOOST_CHECK(empty.empty());
+
+} // InsertTest()
+
+
+//------------------------------------------------------------------------------
+void QueryTest() {
+
+  std::default_random_engine engine(RandomSeed + 1);
+  std::uniform_int_distribution<int> tickDist(-10, 1010);
+  std::uniform_int_distribution<int> lengthDist(0, 20);
+
+  for (unsigned int iTrial = 0; iTrial < 100; ++iTrial) {
+    BOOST_TEST_CHECKPOINT("trial #" << iTrial);
+    std::vector<Range_t> const ranges = randomRanges(engine, 30, 1000, 15);
+    util::UniqueRangeSet<int> expected;
+    for (Range_t const& range: ranges) expected.insert(range);
+    util::FlatUniqueRangeSet<int> flat;
+    flat.insert(ranges);
+
+    for (unsigned int iQuery = 0; iQuery < 100; ++iQuery) {
+      int const start = tickDist(engine), end = start + lengthDist(engine);
+
+      // overlap query against a linear scan
+      auto expectedOverlap = flat.end();
+      for (auto it = flat.begin(); it != flat.end(); ++it) {
+        if ((it->End() < start) || (end < it->Start())) continue;
+        expectedOverlap = it;
+        break;
+      }
+      BOOST_CHECK(flat.FindOverlap(start, end) == expectedOverlap);
+      BOOST_CHECK_EQUAL
+        (flat.Contains(start), (flat.FindOverlap(start, start) != flat.end()));
+
+      // exclusive regions, where the original is defined
+      if (expected.End() < start) continue;
+      CheckSameRanges
+        (flat.Exclusive(start, end), expected.Exclusive(start, end));
+    } // for queries
+  } // for trials
+
+  util::FlatUniqueRangeSet<int> empty;
+  auto const all = empty.Exclusive(3, 8);
+  BOOST_CHECK_EQUAL(all.size(), 1U);
+  BOOST_CHECK_EQUAL(all.Start(), 3);
+  BOOST_CHECK_EQUAL(all.End(), 8);
+
+} // QueryTest()
+
+
+//------------------------------------------------------------------------------
+/// Builds per-channel sets, comparing threaded and sequential builds.
+void ChannelBuilderTest() {
+
+  constexpr unsigned int NChannels = 2000;
+  constexpr unsigned int NRangesPerChannel = 300;
+
+  std::default_random_engine engine(RandomSeed + 2);
+  std::vector<std::vector<Range_t>> rangeLists;
+  rangeLists.reserve(NChannels);
+  for (unsigned int i = 0; i < NChannels; ++i)
+    rangeLists.push_back(randomRanges(engine, NRangesPerChannel, 6400, 30));
+
+  std::vector<util::UniqueRangeSet<int>> expected(NChannels);
+  for (unsigned int i = 0; i < NChannels; ++i)
+    for (Range_t const& range: rangeLists[i]) expected[i].insert(range);
+  std::vector<util::FlatUniqueRangeSet<int>> flat(NChannels);
+  for (unsigned int i = 0; i < NChannels; ++i)
+    for (Range_t const& range: rangeLists[i]) flat[i].insert(range);
+  auto const bulk = util::BuildUniqueRangeSets(rangeLists);
+  auto const threaded = util::BuildUniqueRangeSets(rangeLists, 4U);
+
+  BOOST_CHECK_EQUAL(bulk.size(), NChannels);
+  BOOST_CHECK_EQUAL(threaded.size(), NChannels);
+  for (unsigned int i = 0; i < NChannels; ++i) {
+    CheckSameRanges(flat[i], expected[i]);
+    CheckSameRanges(bulk[i], expected[i]);
+    CheckSameRanges(threaded[i], expected[i]);
+  }
+
+} // ChannelBuilderTest()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(Insert) {
+  InsertTest();
+}
+
+BOOST_AUTO_TEST_CASE(Query) {
+  QueryTest();
+}
+
+BOOST_AUTO_TEST_CASE(ChannelBuilder) {
+  ChannelBuilderTest();
+}
@@ -13,6 +13,8 @@
  *
  * * `GridContainer2DTest`: two-dimension container test
  * * `GridContainer3DTest`: three-dimension container test
+ * * `CompactGridContainer3DTest`: three-dimension contiguous container test
+ * * `GridContainer3DComparison`: comparison of the two 3D containers
  *
  * See the documentation of the three functions for more information.
  *
@@ -21,6 +23,12 @@
 // LArSoft libraries
 #include "lardata/Utilities/GridContainers.h"
 
+// C/C++ standard libraries
+#include <vector>
+#include <array>
+#include <random>
+#include <cstdlib> // std::abs()
+
 // Boost libraries
 #define BOOST_TEST_MODULE ( PointIsolationAlg_test )
 #include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
@@ -213,6 +221,190 @@ void GridContainer3DTest() {
 } // GridContainer3DTest()
 
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Test for a CompactGridContainer3D of integers
+ *
+ * The test fills a `CompactGridContainer3D<int>` container with the same
+ * content as `GridContainer3DTest()`, in two passes, and verifies the content
+ * and the neighbourhood scan.
+ *
+ */
+void CompactGridContainer3DTest() {
+
+  //
+  // initialise
+  //
+  using Container_t = util::CompactGridContainer3D<int>;
+  // BUG the double brace syntax is required to work around clang bug 21629
+  // (https://bugs.llvm.org/show_bug.cgi?id=21629)
+  Container_t grid({{{ 2U, 3U, 4U }}});
+
+  BOOST_CHECK_EQUAL(grid.dims(), 3U);
+  BOOST_CHECK_EQUAL(grid.size(), 24U);
+  BOOST_CHECK_EQUAL(grid.sizeX(), 2U);
+  BOOST_CHECK_EQUAL(grid.sizeY(), 3U);
+  BOOST_CHECK_EQUAL(grid.sizeZ(), 4U);
+  BOOST_CHECK_EQUAL(grid.index({{ 1, 2, 3 }}), 23U);
+  BOOST_CHECK_EQUAL(grid.indexOffset({{ 0, 1, 2 }}, {{ 1, 2, 3 }}), 17);
+  BOOST_CHECK_EQUAL(grid.nData(), 0U);
+
+  //
+  // fill the container: first pass counts, second pass inserts
+  //
+  Container_t::CellID_t cellID;
+  for (unsigned int pass = 0; pass < 2; ++pass) {
+    for (cellID[0] = 0; (size_t) cellID[0] < grid.sizeX(); ++cellID[0]) {
+      for (cellID[1] = 0; (size_t) cellID[1] < grid.sizeY(); ++cellID[1]) {
+        for (cellID[2] = 0; (size_t) cellID[2] < grid.sizeZ(); ++cellID[2]) {
+
+          auto cellIndex = grid.index(cellID);
+
+          int count = cellID[0] + cellID[1] + cellID[2];
+          while (count-- > 0) {
+            if (pass == 0)      grid.count(cellID);
+            else if (count & 1) grid.insert(cellID, count);
+            else                grid.insert(cellIndex, count);
+          } // while
+
+        } // for iz
+      } // for iy
+    } // for ix
+    if (pass == 0) grid.allocate();
+  } // for pass
+
+  BOOST_CHECK_EQUAL(grid.nData(), 72U);
+  BOOST_CHECK_EQUAL(grid.cellOffsets().back(), grid.nData());
+
+  //
+  // read the container
+  //
+  for (cellID[0] = 0; (size_t) cellID[0] < grid.sizeX(); ++cellID[0]) {
+    for (cellID[1] = 0; (size_t) cellID[1] < grid.sizeY(); ++cellID[1]) {
+      for (cellID[2] = 0; (size_t) cellID[2] < grid.sizeZ(); ++cellID[2]) {
+
+        int count = cellID[0] + cellID[1] + cellID[2];
+
+        auto cellIndex = grid.index(cellID);
+        auto const& cell =  (count & 1)? grid[cellIndex]: grid[cellID];
+
+        BOOST_TEST_CHECKPOINT
+          ("[" << cellID[0] << "][" << cellID[1] << "][" << cellID[2] << "]");
+        BOOST_CHECK_EQUAL(cell.size(), (size_t) count);
+        BOOST_CHECK_EQUAL(cell.empty(), count == 0);
+
+        for (size_t k = 0; k < cell.size(); ++k) {
+          int val = cell[k];
+          BOOST_TEST_CHECKPOINT("  [" << k << "]");
+          BOOST_CHECK_EQUAL(val, --count);
+        } // for
+
+      } // for iz
+    } // for iy
+  } // for ix
+
+  //
+  // neighbourhood
+  //
+  for (cellID[0] = 0; (size_t) cellID[0] < grid.sizeX(); ++cellID[0]) {
+    for (cellID[1] = 0; (size_t) cellID[1] < grid.sizeY(); ++cellID[1]) {
+      for (cellID[2] = 0; (size_t) cellID[2] < grid.sizeZ(); ++cellID[2]) {
+
+        // expected: sum of the sizes of the cells in the 3x3x3 window
+        unsigned int expected = 0;
+        Container_t::CellID_t otherID;
+        for (otherID[0] = 0; (size_t) otherID[0] < grid.sizeX(); ++otherID[0])
+        for (otherID[1] = 0; (size_t) otherID[1] < grid.sizeY(); ++otherID[1])
+        for (otherID[2] = 0; (size_t) otherID[2] < grid.sizeZ(); ++otherID[2])
+        {
+          if (std::abs(otherID[0] - cellID[0]) > 1) continue;
+          if (std::abs(otherID[1] - cellID[1]) > 1) continue;
+          if (std::abs(otherID[2] - cellID[2]) > 1) continue;
+          expected += grid[otherID].size();
+        }
+
+        unsigned int n = 0;
+        grid.forEachInNeighbourhood(cellID, 1, [&n](int){ ++n; });
+        BOOST_TEST_CHECKPOINT
+          ("[" << cellID[0] << "][" << cellID[1] << "][" << cellID[2] << "]");
+        BOOST_CHECK_EQUAL(n, expected);
+
+      } // for iz
+    } // for iy
+  } // for ix
+
+  // window entirely out of the grid
+  unsigned int nOut = 0;
+  grid.forEachInNeighbourhood({{ 5, 0, 0 }}, 1, [&nOut](int){ ++nOut; });
+  BOOST_CHECK_EQUAL(nOut, 0U);
+
+} // CompactGridContainer3DTest()
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Compares the standard and the compact 3D containers
+ *
+ * A large number of pseudo-random points is binned into the two types of
+ * containers, and then for each point the number of points in the
+ * neighbouring cells is counted.
+ * The results of the two containers must match.
+ */
+void GridContainer3DComparison() {
+
+  constexpr std::size_t NCells = 64U;
+  constexpr unsigned int NPoints = 500000;
+  constexpr int RandomSeed = 12345;
+
+  using CellID_t = util::GridContainer3D<unsigned int>::CellID_t;
+
+  std::default_random_engine random_engine(RandomSeed);
+  std::uniform_int_distribution<int> uniform(0, NCells - 1);
+  std::vector<CellID_t> points(NPoints);
+  for (CellID_t& point: points)
+    for (auto& coord: point) coord = uniform(random_engine);
+
+  std::array<std::size_t, 3U> const dims {{ NCells, NCells, NCells }};
+
+  //
+  // standard container
+  //
+  util::GridContainer3D<unsigned int> stdGrid(dims);
+  for (unsigned int i = 0; i < NPoints; ++i) stdGrid.insert(points[i], i);
+  unsigned long long stdCount = 0;
+  for (CellID_t const& point: points) {
+    CellID_t cellID;
+    for (cellID[0] = point[0] - 1; cellID[0] <= point[0] + 1; ++cellID[0]) {
+      if (!stdGrid.hasX(cellID[0])) continue;
+      for (cellID[1] = point[1] - 1; cellID[1] <= point[1] + 1; ++cellID[1]) {
+        if (!stdGrid.hasY(cellID[1])) continue;
+        for (cellID[2] = point[2] - 1; cellID[2] <= point[2] + 1; ++cellID[2]) {
+          if (!stdGrid.hasZ(cellID[2])) continue;
+          for (unsigned int j: stdGrid[cellID]) stdCount += j & 1U;
+        } // for z
+      } // for y
+    } // for x
+  } // for points
+
+  //
+  // compact container
+  //
+  util::CompactGridContainer3D<unsigned int> compactGrid(dims);
+  for (CellID_t const& point: points) compactGrid.count(point);
+  compactGrid.allocate();
+  for (unsigned int i = 0; i < NPoints; ++i) compactGrid.insert(points[i], i);
+  unsigned long long compactCount = 0;
+  for (CellID_t const& point: points) {
+    compactGrid.forEachInNeighbourhood
+      (point, 1, [&compactCount](unsigned int j){ compactCount += j & 1U; });
+  } // for points
+
+  BOOST_CHECK_EQUAL(compactGrid.nData(), NPoints);
+  BOOST_CHECK_EQUAL(compactCount, stdCount);
+
+} // GridContainer3DComparison()
+
+
 //------------------------------------------------------------------------------
 //--- test cases
 //
@@ -224,3 +416,10 @@ BOOST_AUTO_TEST_CASE(GridContainer3DTestCase) {
   GridContainer3DTest();
 } // GridContainer3DTestCase
 
+BOOST_AUTO_TEST_CASE(CompactGridContainer3DTestCase) {
+  CompactGridContainer3DTest();
+} // CompactGridContainer3DTestCase
+
+BOOST_AUTO_TEST_CASE(GridContainer3DComparisonCase) {
+  GridContainer3DComparison();
+} // GridContainer3DComparisonCase
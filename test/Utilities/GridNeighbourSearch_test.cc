@@ -0,0 +1,202 @@
+/**
+ * @file    GridNeighbourSearch_test.cc
+ * @brief   Tests the neighbour search on a grid
+ * @date    October 19, 2026
+ * @see     lardata/Utilities/GridNeighbourSearch.h
+ *
+ * The test is run with no arguments.
+ *
+ * Tests are run:
+ *
+ * * `ParallelAssignTest`: threaded filling of a compact grid container
+ * * `NeighbourSearchTest`: comparison of the grid search with a brute force
+ *   one, with one and more threads
+ * * `ManyPointsTest`: comparison of the search with 1 and more threads on a
+ *   large sample
+ *
+ */
+
+// LArSoft libraries
+#include "lardata/Utilities/GridNeighbourSearch.h"
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( GridNeighbourSearch_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// C/C++ standard libraries
+#include <vector>
+#include <array>
+#include <random>
+#include <numeric> // std::accumulate(), std::iota()
+#include <algorithm> // std::is_sorted()
+
+
+/// The seed for the default random engine
+constexpr unsigned int RandomSeed = 12345;
+
+using Position_t = util::GridNeighbourSearch3D::Position_t;
+
+
+/// Returns `n` points uniformly distributed in a cube with side `side`.
+std::vector<Position_t> randomPoints(unsigned int n, double side) {
+  std::default_random_engine random_engine(RandomSeed);
+  std::uniform_real_distribution<double> uniform(-side / 2., side / 2.);
+  std::vector<Position_t> points(n);
+  for (Position_t& point: points)
+    for (double& coord: point) coord = uniform(random_engine);
+  return points;
+} // randomPoints()
+
+
+//------------------------------------------------------------------------------
+void ParallelAssignTest() {
+
+  constexpr unsigned int N = 200000;
+  constexpr std::size_t NCells = 20U;
+
+  std::default_random_engine random_engine(RandomSeed);
+  std::uniform_int_distribution<int> uniform(0, NCells - 1);
+  std::vector<util::CompactGridContainer3D<unsigned int>::CellID_t> cells(N);
+  for (auto& cellID: cells)
+    for (auto& coord: cellID) coord = uniform(random_engine);
+
+  std::array<std::size_t, 3U> const dims {{ NCells, NCells, NCells }};
+  util::CompactGridContainer3D<unsigned int> serialGrid(dims);
+  util::CompactGridContainer3D<unsigned int> parallelGrid(dims);
+
+  auto const cellIndexOf = [&serialGrid, &cells](unsigned int i)
+    { return serialGrid.index(cells[i]); };
+  auto const datumOf = [](unsigned int i){ return i; };
+  std::vector<unsigned int> input(N);
+  std::iota(input.begin(), input.end(), 0U);
+
+  serialGrid.assign(input.begin(), input.end(), cellIndexOf, datumOf);
+  parallelGrid.assign(input.begin(), input.end(), cellIndexOf, datumOf, 8U);
+
+  BOOST_CHECK_EQUAL(parallelGrid.nData(), N);
+  BOOST_CHECK(parallelGrid.cellOffsets() == serialGrid.cellOffsets());
+  BOOST_CHECK(parallelGrid.allData() == serialGrid.allData());
+
+  // input order is preserved within each cell
+  for (std::size_t iCell = 0; iCell < parallelGrid.size(); ++iCell) {
+    auto const& cell = parallelGrid[iCell];
+    BOOST_CHECK(std::is_sorted(cell.begin(), cell.end()));
+  } // for
+
+} // ParallelAssignTest()
+
+
+//------------------------------------------------------------------------------
+void NeighbourSearchTest() {
+
+  constexpr unsigned int N = 5000;
+  constexpr double Side = 10.0;
+  constexpr double Radius = 0.6;
+
+  std::vector<Position_t> const points = randomPoints(N, Side);
+
+  // brute force
+  std::vector<std::size_t> expected(N, 0U);
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < N; ++j) {
+      if (i == j) continue;
+      double d2 = 0.0;
+      for (unsigned int d = 0; d < 3U; ++d)
+        d2 += (points[i][d] - points[j][d]) * (points[i][d] - points[j][d]);
+      if (d2 <= Radius * Radius) ++expected[i];
+    } // for j
+  } // for i
+  std::size_t const nPairs
+    = std::accumulate(expected.begin(), expected.end(), std::size_t(0U));
+  BOOST_TEST_MESSAGE(nPairs << " neighbour pairs (counted twice)");
+  BOOST_CHECK_GT(nPairs, 0U);
+
+  for (unsigned int nThreads: { 1U, 4U }) {
+    BOOST_TEST_CHECKPOINT(nThreads << " threads");
+
+    util::GridNeighbourSearch3D const search(points, Radius, nThreads);
+    BOOST_CHECK_EQUAL(search.nPoints(), N);
+    BOOST_CHECK_EQUAL(search.radius(), Radius);
+
+    std::vector<std::size_t> const counts = search.countNeighbours(nThreads);
+    BOOST_CHECK(counts == expected);
+
+    // single position query
+    for (unsigned int i = 0; i < N; i += 97) {
+      std::size_t n = 0U;
+      search.forEachNeighbourOf
+        (points[i], [&n](std::size_t, double){ ++n; });
+      BOOST_CHECK_EQUAL(n, expected[i] + 1U); // includes the point itself
+    } // for
+  } // for threads
+
+  // a query far away finds nothing
+  util::GridNeighbourSearch3D const search(points, Radius);
+  std::size_t nFar = 0U;
+  search.forEachNeighbourOf
+    ({{ 1e9, -1e9, 0.0 }}, [&nFar](std::size_t, double){ ++nFar; });
+  BOOST_CHECK_EQUAL(nFar, 0U);
+
+  // sparse points in a large volume: the grid does not grow with the volume
+  std::vector<Position_t> sparse = randomPoints(100U, 1e6);
+  sparse.push_back(sparse.front());
+  sparse.back()[0] += Radius / 2.0;
+  util::GridNeighbourSearch3D const sparseSearch(sparse, Radius);
+  BOOST_CHECK_LE(sparseSearch.grid().size(),
+    util::GridNeighbourSearch3D::MaxCellsPerPoint * sparse.size());
+  BOOST_CHECK_GE(sparseSearch.cellSize(), Radius);
+  std::vector<std::size_t> const sparseCounts = sparseSearch.countNeighbours();
+  BOOST_CHECK_EQUAL(sparseCounts.front(), 1U);
+  BOOST_CHECK_EQUAL(sparseCounts.back(), 1U);
+  BOOST_CHECK_EQUAL(
+    std::accumulate(sparseCounts.begin(), sparseCounts.end(), std::size_t(0U)),
+    2U
+    );
+
+  // invalid radius
+  BOOST_CHECK_THROW
+    (util::GridNeighbourSearch3D(points, 0.0), std::invalid_argument);
+
+  // empty input
+  util::GridNeighbourSearch3D const empty(std::vector<Position_t>{}, Radius);
+  BOOST_CHECK_EQUAL(empty.nPoints(), 0U);
+  BOOST_CHECK(empty.countNeighbours(4U).empty());
+
+} // NeighbourSearchTest()
+
+
+//------------------------------------------------------------------------------
+void ManyPointsTest() {
+
+  constexpr unsigned int N = 500000;
+  constexpr double Side = 100.0;
+  constexpr double Radius = 1.5;
+  constexpr unsigned int NThreads = 4U;
+
+  std::vector<Position_t> const points = randomPoints(N, Side);
+
+  util::GridNeighbourSearch3D const serial(points, Radius, 1U);
+  std::vector<std::size_t> const expected = serial.countNeighbours(1U);
+
+  util::GridNeighbourSearch3D const parallel(points, Radius, NThreads);
+  std::vector<std::size_t> const counts = parallel.countNeighbours(NThreads);
+  BOOST_CHECK(counts == expected);
+
+} // ManyPointsTest()
+
+
+//------------------------------------------------------------------------------
+//--- test cases
+//
+BOOST_AUTO_TEST_CASE(ParallelAssignTestCase) {
+  ParallelAssignTest();
+} // ParallelAssignTestCase
+
+BOOST_AUTO_TEST_CASE(NeighbourSearchTestCase) {
+  NeighbourSearchTest();
+} // NeighbourSearchTestCase
+
+BOOST_AUTO_TEST_CASE(ManyPointsTestCase) {
+  ManyPointsTest();
+} // ManyPointsTestCase
@@ -0,0 +1,88 @@
+/**
+ * @file    PxHitColumns_test.cc
+ * @brief   Tests the structure-of-arrays collection of PxHit
+ * @date    October 19, 2026
+ * @see     lardata/Utilities/PxHitColumns.h
+ *
+ * See http://www.boost.org/libs/test for the Boost test library home page.
+ */
+
+// C/C++ standard libraries
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( PxHitColumns_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK()
+
+// LArSoft libraries
+#include "lardata/Utilities/PxHitColumns.h"
+
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+/// Checks that two hits have the same content.
+void CheckSameHit(util::PxHit const& hit, util::PxHit const& expected) {
+  BOOST_CHECK_EQUAL(hit.plane, expected.plane);
+  BOOST_CHECK_EQUAL(hit.w, expected.w);
+  BOOST_CHECK_EQUAL(hit.t, expected.t);
+  BOOST_CHECK_EQUAL(hit.charge, expected.charge);
+  BOOST_CHECK_EQUAL(hit.sumADC, expected.sumADC);
+  BOOST_CHECK_EQUAL(hit.peak, expected.peak);
+} // CheckSameHit()
+
+
+void ColumnsTest() {
+
+  // all the values are exactly representable in single precision
+  std::vector<util::PxHit> const hits {
+    { 0U,  0.5,  12.25, 100.0, 110.0, 20.0 },
+    { 1U, 30.0,   0.0,   2.5,    3.0,  0.5 },
+    { 2U, 31.5, 512.75, 64.0,   70.0, 12.0 }
+  };
+
+  util::PxHitColumns columns(hits);
+  BOOST_CHECK_EQUAL(columns.size(), hits.size());
+  BOOST_CHECK(!columns.empty());
+  BOOST_CHECK_EQUAL(columns.t.size(), hits.size());
+  BOOST_CHECK_EQUAL(columns.plane.size(), hits.size());
+
+  for (std::size_t i = 0; i < hits.size(); ++i) {
+    BOOST_TEST_CHECKPOINT("hit #" << i);
+    CheckSameHit(columns.hit(i), hits[i]);
+    util::PxPoint const point = columns.point(i);
+    BOOST_CHECK_EQUAL(point.plane, hits[i].plane);
+    BOOST_CHECK_EQUAL(point.w, hits[i].w);
+    BOOST_CHECK_EQUAL(point.t, hits[i].t);
+  } // for
+
+  std::vector<util::PxHit> const copy = columns.toPxHits();
+  BOOST_CHECK_EQUAL(copy.size(), hits.size());
+  for (std::size_t i = 0; i < copy.size(); ++i) CheckSameHit(copy[i], hits[i]);
+
+  columns.push_back(hits[1]);
+  BOOST_CHECK_EQUAL(columns.size(), hits.size() + 1);
+  BOOST_CHECK_EQUAL(columns.peak.size(), columns.size());
+  CheckSameHit(columns.hit(hits.size()), hits[1]);
+
+  columns.resize(2U);
+  BOOST_CHECK_EQUAL(columns.sumADC.size(), 2U);
+  CheckSameHit(columns.hit(1U), hits[1]);
+
+  columns.clear();
+  BOOST_CHECK(columns.empty());
+  BOOST_CHECK(columns.charge.empty());
+  BOOST_CHECK(columns.toPxHits().empty());
+
+} // ColumnsTest()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(Columns) {
+  ColumnsTest();
+}
@@ -0,0 +1,241 @@
+/**
+ * @file    PxHitGridIndex_test.cc
+ * @brief   Tests the spatial index of PxHit
+ * @date    October 19, 2026
+ * @see     lardata/Utilities/PxHitGridIndex.h
+ *
+ * See http://www.boost.org/libs/test for the Boost test library home page.
+ *
+ * The results of the index are compared with the ones of a linear scan of the
+ * hits.
+ */
+
+// C/C++ standard libraries
+#include <map>
+#include <cmath>
+#include <vector>
+#include <random>
+#include <algorithm> // std::includes()
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( PxHitGridIndex_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK()
+
+// LArSoft libraries
+#include "lardata/Utilities/PxHitGridIndex.h"
+#include "lardata/Utilities/UtilException.h"
+
+
+/// The seed for the default random engine
+constexpr unsigned int RandomSeed = 12345;
+
+/// Scale factors of the distance (like wire and time to centimeters)
+constexpr double WireScale = 0.3;
+constexpr double TimeScale = 0.08;
+
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+/// Creates `n` hits in a plane; some hits share position and charge.
+std::vector<util::PxHit> makeHits
+  (unsigned int n, double wireMax, double timeMax, unsigned int seed)
+{
+  std::default_random_engine engine(seed);
+  std::uniform_real_distribution<double> wireDist(0.0, wireMax);
+  std::uniform_real_distribution<double> timeDist(0.0, timeMax);
+  std::uniform_int_distribution<int> chargeDist(1, 500);
+
+  std::vector<util::PxHit> hits;
+  hits.reserve(n);
+  for (unsigned int i = 0; i < n; ++i) {
+    if ((i % 17 == 16) && !hits.empty()) { // a copy of an earlier hit
+      hits.push_back(hits[i / 2]);
+      continue;
+    }
+    hits.emplace_back(2U, wireDist(engine), timeDist(engine),
+      chargeDist(engine) * 0.5, 0.0, 0.0);
+  } // for
+  return hits;
+} // makeHits()
+
+
+/// Linear search of the closest hit, as `GeometryUtilities` does.
+unsigned int linearClosestHitIndex(
+  std::vector<util::PxHit> const& hits, double w, double t, double maxDistance
+) {
+  double min_length_from_start = maxDistance;
+  unsigned int ret_ind = hits.size();
+  for (unsigned int ii = 0; ii < hits.size(); ii++) {
+    double const dist_mod
+      = std::hypot((w - hits[ii].w) * WireScale, (t - hits[ii].t) * TimeScale);
+    if (dist_mod < min_length_from_start) {
+      min_length_from_start = dist_mod;
+      ret_ind = ii;
+    }
+  } // for
+  return ret_ind;
+} // linearClosestHitIndex()
+
+
+//------------------------------------------------------------------------------
+void ClosestHitTest() {
+
+  std::vector<util::PxHit> const hits = makeHits(5000, 300.0, 600.0, RandomSeed);
+
+  for (double cellSize: { 0.0, 1.0, 7.5, 1000.0 }) {
+    BOOST_TEST_CHECKPOINT("cell size: " << cellSize);
+    util::PxHitGridIndex const index = (cellSize > 0.0)
+      ? util::PxHitGridIndex(hits, cellSize): util::PxHitGridIndex(hits);
+    BOOST_CHECK_EQUAL(index.size(), hits.size());
+    BOOST_CHECK_GT(index.nCellsW() * index.nCellsT(), 0U);
+
+    std::default_random_engine engine(RandomSeed + 1);
+    // queries also outside of the area covered by the hits
+    std::uniform_real_distribution<double> wireDist(-100.0, 400.0);
+    std::uniform_real_distribution<double> timeDist(-200.0, 800.0);
+    for (unsigned int i = 0; i < 2000; ++i) {
+      double const w = wireDist(engine), t = timeDist(engine);
+      BOOST_CHECK_EQUAL(
+        index.closestHitIndex(w, t, WireScale, TimeScale, 99999.),
+        linearClosestHitIndex(hits, w, t, 99999.)
+        );
+      // with a limit on the distance
+      BOOST_CHECK_EQUAL(
+        index.closestHitIndex(w, t, WireScale, TimeScale, 0.5),
+        linearClosestHitIndex(hits, w, t, 0.5)
+        );
+    } // for queries
+
+    // queries exactly on hits, including the duplicate ones
+    for (unsigned int i = 0; i < hits.size(); i += 7) {
+      BOOST_CHECK_EQUAL(
+        index.closestHitIndex(hits[i].w, hits[i].t, WireScale, TimeScale),
+        linearClosestHitIndex(hits, hits[i].w, hits[i].t, 99999.)
+        );
+    } // for
+  } // for cell sizes
+
+  // empty collection
+  std::vector<util::PxHit> const noHits;
+  util::PxHitGridIndex const emptyIndex(noHits);
+  BOOST_CHECK_EQUAL(emptyIndex.closestHitIndex(1.0, 1.0), 0U);
+  BOOST_CHECK(emptyIndex.hitsInBox(0.0, 10.0, 0.0, 10.0).empty());
+
+  BOOST_CHECK_THROW(util::PxHitGridIndex(hits, 0.0), util::UtilException);
+
+  // sparse hits: the grid does not grow with the area
+  std::vector<util::PxHit> const sparse = makeHits(100, 1e6, 1e6, RandomSeed + 4);
+  util::PxHitGridIndex const sparseIndex(sparse, 0.001);
+  BOOST_CHECK_LE(sparseIndex.nCellsW() * sparseIndex.nCellsT(),
+    util::PxHitGridIndex::MaxCellsPerHit * sparse.size());
+  BOOST_CHECK_GE(sparseIndex.cellSize(), 0.001);
+  for (unsigned int i = 0; i < sparse.size(); i += 3) {
+    double const w = sparse[i].w + 10.0, t = sparse[i].t - 10.0;
+    BOOST_CHECK_EQUAL(
+      sparseIndex.closestHitIndex(w, t, WireScale, TimeScale),
+      linearClosestHitIndex(sparse, w, t, 99999.)
+      );
+  } // for
+
+} // ClosestHitTest()
+
+
+//------------------------------------------------------------------------------
+void BoxAndChargeTest() {
+
+  std::vector<util::PxHit> const hits = makeHits(5000, 300.0, 600.0, RandomSeed);
+  util::PxHitGridIndex const index(hits);
+
+  // all the hits in the box must be among the candidates
+  std::default_random_engine engine(RandomSeed + 2);
+  std::uniform_real_distribution<double> centerDist(-20.0, 620.0);
+  std::uniform_real_distribution<double> sizeDist(0.0, 30.0);
+  for (unsigned int i = 0; i < 500; ++i) {
+    double const w = centerDist(engine) / 2.0, t = centerDist(engine);
+    double const dw = sizeDist(engine), dt = sizeDist(engine);
+    std::vector<unsigned int> expected;
+    for (unsigned int iHit = 0; iHit < hits.size(); ++iHit) {
+      util::PxHit const& hit = hits[iHit];
+      if (hit.w >= w - dw && hit.w <= w + dw && hit.t >= t - dt && hit.t <= t + dt)
+        expected.push_back(iHit);
+    } // for
+    auto const candidates = index.hitsInBox(w - dw, w + dw, t - dt, t + dt);
+    BOOST_CHECK(std::is_sorted(candidates.begin(), candidates.end()));
+    BOOST_CHECK(std::includes(
+      candidates.begin(), candidates.end(), expected.begin(), expected.end()
+      ));
+  } // for
+
+  // charge ranking: one hit per charge value, the first one
+  std::map<double, unsigned int> hitmap;
+  double qtotal = 0.0;
+  for (unsigned int iHit = 0; iHit < hits.size(); ++iHit) {
+    hitmap.try_emplace(hits[iHit].charge, iHit);
+    qtotal += hits[iHit].charge;
+  }
+  std::vector<unsigned int> expected;
+  for (auto it = hitmap.rbegin(); it != hitmap.rend(); ++it)
+    expected.push_back(it->second);
+  auto const& ranked = index.chargeRankedHits();
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (ranked.begin(), ranked.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(index.totalCharge(), qtotal);
+
+} // BoxAndChargeTest()
+
+
+//------------------------------------------------------------------------------
+/// Compares closest hit queries with and without index on many hits.
+void ManyHitsTest() {
+
+  constexpr unsigned int NHits = 100000;
+  constexpr unsigned int NQueries = 1000;
+
+  std::vector<util::PxHit> const hits
+    = makeHits(NHits, 1000.0, 2000.0, RandomSeed);
+
+  std::default_random_engine engine(RandomSeed + 3);
+  std::uniform_real_distribution<double> wireDist(0.0, 1000.0);
+  std::uniform_real_distribution<double> timeDist(0.0, 2000.0);
+  std::vector<std::pair<double, double>> queries;
+  for (unsigned int i = 0; i < NQueries; ++i)
+    queries.emplace_back(wireDist(engine), timeDist(engine));
+
+  std::vector<unsigned int> linearResults;
+  for (auto const& [ w, t ]: queries)
+    linearResults.push_back(linearClosestHitIndex(hits, w, t, 99999.));
+
+  util::PxHitGridIndex const index(hits);
+
+  std::vector<unsigned int> indexResults;
+  for (auto const& [ w, t ]: queries) {
+    indexResults.push_back
+      (index.closestHitIndex(w, t, WireScale, TimeScale, 99999.));
+  }
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(
+    indexResults.begin(), indexResults.end(),
+    linearResults.begin(), linearResults.end()
+    );
+
+} // ManyHitsTest()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(ClosestHit) {
+  ClosestHitTest();
+}
+
+BOOST_AUTO_TEST_CASE(BoxAndCharge) {
+  BoxAndChargeTest();
+}
+
+BOOST_AUTO_TEST_CASE(ManyHits) {
+  ManyHitsTest();
+}
@@ -0,0 +1,357 @@
+/**
+ * @file    PxPolygon_test.cc
+ * @brief   Tests the polygon overlap and containment tests
+ * @date    October 19, 2026
+ * @see     lardata/Utilities/PxPolygon.h
+ *
+ * See http://www.boost.org/libs/test for the Boost test library home page.
+ *
+ * The results are compared on random polygons with the ones of the nested
+ * loop algorithms (the one of `GeometryUtilities::PolyOverlap()` for
+ * untangling).
+ */
+
+// C/C++ standard libraries
+#include <cmath>
+#include <vector>
+#include <random>
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( PxPolygon_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK()
+
+// LArSoft libraries
+#include "lardata/Utilities/PxPolygon.h"
+#include "lardata/Utilities/PxHitColumns.h"
+#include "lardata/Utilities/UtilException.h"
+
+
+/// The seed for the default random engine
+constexpr unsigned int RandomSeed = 12345;
+
+
+//------------------------------------------------------------------------------
+//--- Reference implementations
+//
+
+/**
+ * @brief The algorithm of `GeometryUtilities::PolyOverlap()` before the engine.
+ * @return whether the chain was untangled within `maxSwaps` swaps
+ *
+ * The original algorithm recursed after each swap, and never ended on some
+ * chains; this version loops instead, and gives up after `maxSwaps` swaps.
+ */
+bool ReferencePolyOverlap(
+  std::vector<util::PxPoint> const& points,
+  std::vector<std::size_t>& candidate_polygon,
+  std::size_t maxSwaps
+) {
+  using util::PxPolygon;
+  std::size_t nSwaps = 0;
+  bool swapped = true;
+  while (swapped) {
+    swapped = false;
+    for (unsigned int i = 0; !swapped && (i < (candidate_polygon.size() - 1)); i++) {
+      double Ax = points.at(candidate_polygon.at(i)).w;
+      double Ay = points.at(candidate_polygon.at(i)).t;
+      double Bx = points.at(candidate_polygon.at(i + 1)).w;
+      double By = points.at(candidate_polygon.at(i + 1)).t;
+      for (unsigned int j = i + 2; j < (candidate_polygon.size() - 1); j++) {
+        if (candidate_polygon.at(i) == candidate_polygon.at(j + 1)) continue;
+        double Cx = points.at(candidate_polygon.at(j)).w;
+        double Cy = points.at(candidate_polygon.at(j)).t;
+        double Dx = points.at(candidate_polygon.at(j + 1)).w;
+        double Dy = points.at(candidate_polygon.at(j + 1)).t;
+        if ((PxPolygon::Clockwise(Ax, Ay, Cx, Cy, Dx, Dy)
+             != PxPolygon::Clockwise(Bx, By, Cx, Cy, Dx, Dy))
+          && (PxPolygon::Clockwise(Ax, Ay, Bx, By, Cx, Cy)
+             != PxPolygon::Clockwise(Ax, Ay, Bx, By, Dx, Dy))
+        ) {
+          if (++nSwaps > maxSwaps) return false;
+          std::swap(candidate_polygon.at(i + 1), candidate_polygon.at(j));
+          candidate_polygon.at(candidate_polygon.size() - 1) = candidate_polygon.at(0);
+          swapped = true;
+          break;
+        }
+      } // for j
+    } // for i
+  } // while
+  return true;
+} // ReferencePolyOverlap()
+
+
+/// Even-odd containment test looking at all the edges.
+bool ReferenceContains
+  (std::vector<util::PxPoint> const& vertices, double w, double t)
+{
+  bool inside = false;
+  std::size_t const n = vertices.size();
+  for (std::size_t i = 0; i < n; ++i) {
+    util::PxPoint const& a = vertices[i];
+    util::PxPoint const& b = vertices[(i + 1) % n];
+    if (((a.t > t) != (b.t > t))
+      && (w < (b.w - a.w) * (t - a.t) / (b.t - a.t) + a.w))
+      inside = !inside;
+  } // for
+  return inside;
+} // ReferenceContains()
+
+
+/// Tests all the pairs of non-consecutive edges.
+bool ReferenceSelfIntersecting(std::vector<util::PxPoint> const& v) {
+  std::size_t const n = v.size();
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = i + 2; j < n; ++j) {
+      if ((i == 0) && (j == n - 1)) continue;
+      if (util::PxPolygon::SegmentsCross(v[i], v[i + 1], v[j], v[(j + 1) % n]))
+        return true;
+    } // for j
+  } // for i
+  return false;
+} // ReferenceSelfIntersecting()
+
+
+/// Tests all the pairs of edges, then containment of the first vertices.
+bool ReferenceOverlaps
+  (std::vector<util::PxPoint> const& a, std::vector<util::PxPoint> const& b)
+{
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    for (std::size_t j = 0; j < b.size(); ++j) {
+      if (util::PxPolygon::SegmentsCross(
+        a[i], a[(i + 1) % a.size()], b[j], b[(j + 1) % b.size()]
+        ))
+        return true;
+    } // for j
+  } // for i
+  return ReferenceContains(a, b.front().w, b.front().t)
+    || ReferenceContains(b, a.front().w, a.front().t);
+} // ReferenceOverlaps()
+
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+/// Returns `n` random points in a box; some points are on a coarse lattice.
+std::vector<util::PxPoint> randomPoints(
+  std::default_random_engine& engine, unsigned int n,
+  double w0, double t0, double size
+) {
+  std::uniform_real_distribution<double> uniform(0.0, size);
+  std::uniform_int_distribution<int> lattice(0, 4);
+  std::vector<util::PxPoint> points;
+  for (unsigned int i = 0; i < n; ++i) {
+    if (i % 5 == 4) { // exercise collinear and coincident vertices
+      points.emplace_back(0U,
+        w0 + lattice(engine) * size / 4, t0 + lattice(engine) * size / 4);
+    }
+    else points.emplace_back(0U, w0 + uniform(engine), t0 + uniform(engine));
+  }
+  return points;
+} // randomPoints()
+
+
+/// Returns a star-shaped (simple) polygon with `n` vertices.
+std::vector<util::PxPoint> randomStarPolygon(
+  std::default_random_engine& engine, unsigned int n,
+  double w0, double t0, double radius
+) {
+  std::uniform_real_distribution<double> radial(0.2 * radius, radius);
+  std::vector<util::PxPoint> points;
+  for (unsigned int i = 0; i < n; ++i) {
+    double const phi = 2.0 * M_PI * i / n;
+    double const r = radial(engine);
+    points.emplace_back(0U, w0 + r * std::cos(phi), t0 + r * std::sin(phi));
+  }
+  return points;
+} // randomStarPolygon()
+
+
+//------------------------------------------------------------------------------
+void UntangleTest() {
+
+  std::default_random_engine engine(RandomSeed);
+  unsigned int nFailures = 0;
+  for (unsigned int nPoints: { 3U, 5U, 8U, 12U, 30U }) {
+    for (unsigned int iTrial = 0; iTrial < 200; ++iTrial) {
+      BOOST_TEST_CHECKPOINT(nPoints << " points, trial #" << iTrial);
+      std::vector<util::PxPoint> const points
+        = randomPoints(engine, nPoints, 0.0, 0.0, 100.0);
+
+      // chain in the order of the points, closed on the first one
+      std::vector<std::size_t> chain;
+      for (std::size_t i = 0; i < nPoints; ++i) chain.push_back(i);
+      chain.push_back(0);
+
+      std::size_t const maxSwaps = chain.size() * chain.size() * chain.size() + 100;
+      std::vector<std::size_t> expected = chain;
+      bool const untangled = ReferencePolyOverlap(points, expected, maxSwaps);
+      auto pos = [&points](std::size_t i) -> util::PxPoint const&
+        { return points[i]; };
+      if (!untangled) { // some chains never get untangled
+        ++nFailures;
+        BOOST_CHECK_THROW
+          (util::PxPolygon::Untangle(chain, pos), util::UtilException);
+        continue;
+      }
+      std::vector<std::size_t> const result
+        = util::PxPolygon::Untangle(chain, pos);
+      BOOST_CHECK_EQUAL_COLLECTIONS
+        (result.begin(), result.end(), expected.begin(), expected.end());
+    } // for trials
+  } // for sizes
+  BOOST_TEST_MESSAGE(nFailures << " chains could not be untangled");
+
+} // UntangleTest()
+
+
+//------------------------------------------------------------------------------
+void ContainmentTest() {
+
+  std::default_random_engine engine(RandomSeed + 1);
+  std::uniform_real_distribution<double> uniform(-20.0, 120.0);
+
+  for (unsigned int iTrial = 0; iTrial < 200; ++iTrial) {
+    BOOST_TEST_CHECKPOINT("trial #" << iTrial);
+    // both simple and self-intersecting polygons
+    std::vector<util::PxPoint> const vertices = (iTrial % 2)
+      ? randomStarPolygon(engine, 3 + iTrial % 50, 50.0, 50.0, 50.0)
+      : randomPoints(engine, 3 + iTrial % 20, 0.0, 0.0, 100.0);
+    util::PxPolygon const polygon(vertices);
+
+    BOOST_CHECK_EQUAL
+      (polygon.IsSelfIntersecting(), ReferenceSelfIntersecting(vertices));
+
+    util::PxHitColumns hits;
+    std::vector<util::PxHit> hitVector;
+    for (unsigned int i = 0; i < 500; ++i) {
+      util::PxHit const hit { 0U, uniform(engine), uniform(engine), 1.0, 1.0, 1.0 };
+      hits.push_back(hit);
+      hitVector.push_back(hits.hit(i)); // same (single precision) position
+    }
+    // some hits exactly on vertices
+    for (auto const& vertex: vertices) {
+      hits.push_back({ 0U, vertex.w, vertex.t, 1.0, 1.0, 1.0 });
+      hitVector.push_back(hits.hit(hits.size() - 1));
+    }
+
+    std::vector<unsigned int> expected;
+    for (unsigned int i = 0; i < hitVector.size(); ++i) {
+      if (ReferenceContains(vertices, hitVector[i].w, hitVector[i].t))
+        expected.push_back(i);
+    }
+
+    std::vector<unsigned int> const fromColumns = polygon.ContainedHits(hits);
+    BOOST_CHECK_EQUAL_COLLECTIONS(fromColumns.begin(), fromColumns.end(),
+      expected.begin(), expected.end());
+    std::vector<unsigned int> const fromVector
+      = polygon.ContainedHits(hitVector);
+    BOOST_CHECK_EQUAL_COLLECTIONS(fromVector.begin(), fromVector.end(),
+      expected.begin(), expected.end());
+
+    std::vector<bool> inside;
+    polygon.Contains(hits, inside);
+    BOOST_CHECK_EQUAL(inside.size(), hits.size());
+    std::size_t nInside = 0;
+    for (bool in: inside) if (in) ++nInside;
+    BOOST_CHECK_EQUAL(nInside, expected.size());
+  } // for trials
+
+  // degenerate polygons
+  util::PxPolygon const empty;
+  BOOST_CHECK(!empty.Contains(0.0, 0.0));
+  BOOST_CHECK(!empty.IsSelfIntersecting());
+  util::PxPolygon const flat({ { 0U, 0.0, 1.0 }, { 0U, 2.0, 1.0 }, { 0U, 4.0, 1.0 } });
+  BOOST_CHECK(!flat.Contains(1.0, 1.0));
+  BOOST_CHECK(!flat.Overlaps(empty));
+
+} // ContainmentTest()
+
+
+//------------------------------------------------------------------------------
+void OverlapTest() {
+
+  std::default_random_engine engine(RandomSeed + 2);
+  std::uniform_real_distribution<double> position(0.0, 200.0);
+  std::uniform_real_distribution<double> size(5.0, 60.0);
+
+  unsigned int nOverlapping = 0;
+  for (unsigned int iTrial = 0; iTrial < 1000; ++iTrial) {
+    BOOST_TEST_CHECKPOINT("trial #" << iTrial);
+    std::vector<util::PxPoint> const a = (iTrial % 3)
+      ? randomStarPolygon
+        (engine, 3 + iTrial % 40, position(engine), position(engine), size(engine))
+      : randomPoints(engine, 3 + iTrial % 9, position(engine), position(engine), size(engine));
+    std::vector<util::PxPoint> const b = randomStarPolygon
+      (engine, 3 + iTrial % 25, position(engine), position(engine), size(engine));
+
+    util::PxPolygon const polyA(a), polyB(b);
+    bool const expected = ReferenceOverlaps(a, b);
+    BOOST_CHECK_EQUAL(polyA.Overlaps(polyB), expected);
+    BOOST_CHECK_EQUAL(polyB.Overlaps(polyA), ReferenceOverlaps(b, a));
+    if (expected) ++nOverlapping;
+  } // for
+  // make sure both outcomes were exercised
+  BOOST_CHECK_GT(nOverlapping, 0U);
+  BOOST_CHECK_LT(nOverlapping, 1000U);
+
+  // a polygon inside another one, without crossing edges
+  util::PxPolygon const outer
+    ({ { 0U, 0.0, 0.0 }, { 0U, 10.0, 0.0 }, { 0U, 10.0, 10.0 }, { 0U, 0.0, 10.0 } });
+  util::PxPolygon const inner
+    ({ { 0U, 4.0, 4.0 }, { 0U, 6.0, 4.0 }, { 0U, 5.0, 6.0 } });
+  BOOST_CHECK(!outer.EdgesCross(inner));
+  BOOST_CHECK(outer.Overlaps(inner));
+  BOOST_CHECK(inner.Overlaps(outer));
+
+} // OverlapTest()
+
+
+//------------------------------------------------------------------------------
+/// Compares the containment test with and without the engine on many hits.
+void ManyHitsTest() {
+
+  constexpr unsigned int NHits = 100000;
+  constexpr unsigned int NVertices = 200;
+
+  std::default_random_engine engine(RandomSeed + 3);
+  std::vector<util::PxPoint> const vertices
+    = randomStarPolygon(engine, NVertices, 500.0, 500.0, 400.0);
+  std::uniform_real_distribution<double> uniform(0.0, 1000.0);
+  util::PxHitColumns hits;
+  hits.reserve(NHits);
+  for (unsigned int i = 0; i < NHits; ++i)
+    hits.push_back({ 0U, uniform(engine), uniform(engine), 1.0, 1.0, 1.0 });
+
+  std::size_t nReference = 0;
+  for (std::size_t i = 0; i < hits.size(); ++i)
+    if (ReferenceContains(vertices, hits.w[i], hits.t[i])) ++nReference;
+
+  util::PxPolygon const polygon(vertices);
+  std::size_t const nEngine = polygon.ContainedHits(hits).size();
+
+  BOOST_CHECK_EQUAL(nEngine, nReference);
+
+} // ManyHitsTest()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(Untangle) {
+  UntangleTest();
+}
+
+BOOST_AUTO_TEST_CASE(Containment) {
+  ContainmentTest();
+}
+
+BOOST_AUTO_TEST_CASE(Overlap) {
+  OverlapTest();
+}
+
+BOOST_AUTO_TEST_CASE(ManyHits) {
+  ManyHitsTest();
+}
@@ -0,0 +1,278 @@
+/**
+ * @file    RunConditionsCache_test.cc
+ * @brief   Test of the run conditions cache and of its snapshot files
+ * @date    October 19, 2026
+ * @see     lardata/Utilities/RunConditionsCache.h
+ *
+ * See http://www.boost.org/libs/test for the Boost test library home page.
+ *
+ * The snapshot file stands in for the database: the conditions written into
+ * it must be read back identical, including the missing ones.
+ * The rows of the bulk queries are read from text files written by the test,
+ * with the `|` separated columns of a `psql` dump.
+ */
+
+// C/C++ standard libraries
+#include <cstdio> // std::remove()
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( RunConditionsCache_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK()
+
+// LArSoft libraries
+#include "lardata/Utilities/RunConditionsCache.h"
+
+
+/// The seed for the default random engine
+constexpr unsigned int RandomSeed = 12345;
+
+
+//------------------------------------------------------------------------------
+void checkSameConditions
+  (util::RunConditions const& cond, util::RunConditions const& expected)
+{
+  BOOST_CHECK_EQUAL(cond.run, expected.run);
+  BOOST_CHECK_EQUAL(cond.complete, expected.complete);
+  BOOST_CHECK(cond.lifetime == expected.lifetime);
+  BOOST_CHECK(cond.triggerOffset == expected.triggerOffset);
+  BOOST_CHECK(cond.temperature == expected.temperature);
+  BOOST_CHECK(cond.pot == expected.pot);
+  BOOST_CHECK(cond.efield == expected.efield);
+} // checkSameConditions()
+
+
+void SnapshotRoundTripTest() {
+  std::string const path = "RunConditionsCache_test_snapshot.txt";
+
+  std::default_random_engine random_engine(RandomSeed);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+  util::RunConditionsCache cache;
+  BOOST_CHECK(cache.empty());
+  for (int run = 600; run < 650; ++run) {
+    util::RunConditions& cond = cache.get(run);
+    cond.complete = (run % 3 != 0);
+    if (run % 5 != 0) cond.lifetime = 500.0 + 1000.0 * uniform(random_engine);
+    if (run % 7 != 0) cond.triggerOffset = -uniform(random_engine);
+    cond.temperature = 87.0 + uniform(random_engine);
+    if (run % 2 == 0) cond.pot = 1.0e18L * uniform(random_engine) / 3.0L;
+    if (run % 4 != 0) {
+      for (int gap = 0; gap < 3; ++gap) cond.efield.push_back(0.481 + uniform(random_engine));
+    }
+  }
+  BOOST_CHECK_EQUAL(cache.size(), 50U);
+  BOOST_CHECK(cache.isComplete(601));
+  BOOST_CHECK(!cache.isComplete(603));
+  BOOST_CHECK(!cache.isComplete(700));
+  BOOST_CHECK(cache.find(700) == nullptr);
+
+  cache.writeSnapshot(path);
+
+  util::RunConditionsCache readBack;
+  BOOST_CHECK_EQUAL(readBack.readSnapshot(path), cache.size());
+  BOOST_CHECK_EQUAL(readBack.size(), cache.size());
+  for (int run = 600; run < 650; ++run) {
+    BOOST_TEST_CONTEXT("run " << run) {
+      util::RunConditions const* cond = readBack.find(run);
+      BOOST_REQUIRE(cond);
+      checkSameConditions(*cond, *cache.find(run));
+    }
+  }
+
+  std::remove(path.c_str());
+} // SnapshotRoundTripTest()
+
+
+void SnapshotErrorTest() {
+  std::string const path = "RunConditionsCache_test_bad.txt";
+  util::RunConditionsCache cache;
+
+  BOOST_CHECK_THROW(cache.readSnapshot("RunConditionsCache_test_missing.txt"), cet::exception);
+
+  {
+    std::ofstream out(path);
+    out << "run 1 complete 1 tau 1 T0 - temp - pot - efield 0\n";
+  }
+  BOOST_CHECK_THROW(cache.readSnapshot(path), cet::exception); // no header
+
+  {
+    std::ofstream out(path);
+    out << util::RunConditionsCache::SnapshotHeader << "\n"
+      << "run 1 complete 1 tau 1 T0 - temp - pot - efield 0\n"
+      << "run 2 complete 1 tau 1x T0 - temp - pot - efield 0\n";
+  }
+  BOOST_CHECK_THROW(cache.readSnapshot(path), cet::exception); // bad value
+
+  {
+    std::ofstream out(path);
+    out << util::RunConditionsCache::SnapshotHeader << "\n"
+      << "run 3 complete 1 tau 1 T0 - temp - pot - efield 3 0.5 0.7\n";
+  }
+  BOOST_CHECK_THROW(cache.readSnapshot(path), cet::exception); // truncated
+
+  std::remove(path.c_str());
+} // SnapshotErrorTest()
+
+
+/// Reads `|` separated rows from a text file, like the ones of a query.
+template <typename Row>
+std::vector<Row> readRows(std::string const& path) {
+  std::vector<Row> rows;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    Row row;
+    std::istringstream sline(line);
+    for (std::string& column: row) std::getline(sline, column, '|');
+    rows.push_back(row);
+  }
+  return rows;
+} // readRows()
+
+
+void LookupTest() {
+  util::RunConditionsCache cache;
+  double value = 0.0;
+  std::vector<double> efield;
+
+  // not cached at all
+  BOOST_CHECK(!cache.lookup(5, &util::RunConditions::temperature, value));
+  BOOST_CHECK(!cache.lookupEfield(5, efield));
+
+  // answers of single queries: the others are still to be asked
+  cache.get(5).temperature = 87.5;
+  BOOST_CHECK(cache.lookup(5, &util::RunConditions::temperature, value) == 0);
+  BOOST_CHECK_EQUAL(value, 87.5);
+  BOOST_CHECK(!cache.lookup(5, &util::RunConditions::lifetime, value));
+  BOOST_CHECK(!cache.lookupEfield(5, efield));
+
+  cache.get(5).efield = { 0.5, 0.7 };
+  BOOST_CHECK(cache.lookupEfield(5, efield) == 0);
+  BOOST_CHECK(efield == cache.find(5)->efield);
+
+  // complete run: what is missing is not in the database
+  cache.get(5).complete = true;
+  value = -1.0;
+  BOOST_CHECK(cache.lookup(5, &util::RunConditions::lifetime, value) == -1);
+  BOOST_CHECK_EQUAL(value, -1.0);
+  long double pot = 0.0L;
+  BOOST_CHECK(cache.lookup(5, &util::RunConditions::pot, pot) == -1);
+  BOOST_CHECK(cache.lookup(5, &util::RunConditions::temperature, value) == 0);
+
+  cache.get(6).complete = true;
+  BOOST_CHECK(cache.lookupEfield(6, efield) == -1);
+} // LookupTest()
+
+
+void PrefetchTest() {
+  std::string const runPath = "RunConditionsCache_test_runs.txt";
+  std::string const fieldPath = "RunConditionsCache_test_efield.txt";
+
+  // run 105 has two rows, 107 has none; 108 has no field
+  {
+    std::ofstream out(runPath);
+    for (int run = 100; run < 110; ++run) {
+      if (run == 107) continue;
+      out << run << "|" << (run * 10.0) << "|" << (-run / 100.0) << "|87.5|"
+        << (run * 1.0e16) << "\n";
+    }
+    out << "105|1|2|3|4\n";
+    out << "200|1|2|3|4\n"; // not asked for
+  }
+  {
+    std::ofstream out(fieldPath);
+    for (int run = 100; run < 110; ++run) {
+      if (run == 108) continue;
+      for (int gap = 0; gap < 3; ++gap) out << run << "|" << (0.5 + gap) << "\n";
+    }
+  }
+  auto const rows = readRows<util::RunConditionsCache::ConditionsRow_t>(runPath);
+  auto const efieldRows = readRows<util::RunConditionsCache::EfieldRow_t>(fieldPath);
+
+  util::RunConditionsCache cache;
+  cache.get(104).complete = true;
+  cache.get(103).temperature = 90.0; // from a single query
+
+  std::vector<int> const missing = cache.missingRuns
+    ({ 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 101, 109 });
+  std::vector<int> const expectedMissing
+    { 100, 101, 102, 103, 105, 106, 107, 108, 109 };
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (missing.begin(), missing.end(), expectedMissing.begin(), expectedMissing.end());
+
+  BOOST_CHECK_EQUAL(cache.addPrefetched(missing, rows, &efieldRows), missing.size());
+  BOOST_CHECK(cache.find(200) == nullptr);
+  BOOST_CHECK(cache.missingRuns({ 100, 104, 109 }).empty());
+
+  double value = 0.0;
+  long double pot = 0.0L;
+  std::vector<double> efield;
+  std::vector<double> const expectedField { 0.5, 1.5, 2.5 };
+  for (int run: missing) {
+    BOOST_TEST_CONTEXT("run " << run) {
+      BOOST_CHECK(cache.isComplete(run));
+      if ((run == 105) || (run == 107)) {
+        BOOST_CHECK(cache.lookup(run, &util::RunConditions::lifetime, value) == -1);
+        BOOST_CHECK(cache.lookup(run, &util::RunConditions::triggerOffset, value) == -1);
+        BOOST_CHECK(cache.lookup(run, &util::RunConditions::temperature, value) == -1);
+        BOOST_CHECK(cache.lookup(run, &util::RunConditions::pot, pot) == -1);
+      }
+      else {
+        BOOST_CHECK(cache.lookup(run, &util::RunConditions::lifetime, value) == 0);
+        BOOST_CHECK_EQUAL(value, run * 10.0);
+        BOOST_CHECK(cache.lookup(run, &util::RunConditions::triggerOffset, value) == 0);
+        BOOST_CHECK_EQUAL(value, -run / 100.0);
+        BOOST_CHECK(cache.lookup(run, &util::RunConditions::temperature, value) == 0);
+        BOOST_CHECK_EQUAL(value, 87.5);
+        BOOST_CHECK(cache.lookup(run, &util::RunConditions::pot, pot) == 0);
+        BOOST_CHECK_CLOSE(static_cast<double>(pot), run * 1.0e16, 1e-6);
+      }
+      if (run == 108) {
+        BOOST_CHECK(cache.lookupEfield(run, efield) == -1);
+      }
+      else {
+        BOOST_CHECK(cache.lookupEfield(run, efield) == 0);
+        BOOST_CHECK(efield == expectedField);
+      }
+    } // context
+  } // for
+
+  // without the field, the runs are not complete and the field is still asked
+  util::RunConditionsCache partial;
+  partial.addPrefetched({ 100, 107 }, rows, nullptr);
+  BOOST_CHECK(!partial.isComplete(100));
+  BOOST_CHECK(partial.lookup(100, &util::RunConditions::lifetime, value) == 0);
+  BOOST_CHECK(!partial.lookupEfield(100, efield));
+  BOOST_CHECK(!partial.lookup(107, &util::RunConditions::lifetime, value));
+  BOOST_CHECK_EQUAL(partial.missingRuns({ 100, 107 }).size(), 2U);
+
+  std::remove(runPath.c_str());
+  std::remove(fieldPath.c_str());
+} // PrefetchTest()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(SnapshotRoundTripTestCase) {
+  SnapshotRoundTripTest();
+}
+
+BOOST_AUTO_TEST_CASE(SnapshotErrorTestCase) {
+  SnapshotErrorTest();
+}
+
+BOOST_AUTO_TEST_CASE(LookupTestCase) {
+  LookupTest();
+}
+
+BOOST_AUTO_TEST_CASE(PrefetchTestCase) {
+  PrefetchTest();
+}
@@ -19,8 +19,10 @@
 #include <cmath>
 #include <tuple>
 #include <array>
-#include <stdexcept> // std::range_error
+#include <stdexcept> // std::range_error, std::invalid_argument
 #include <iterator> // std::ostream_iterator
+#include <vector>
+#include <random>
 #include <iostream>
 
 // Boost libraries
@@ -391,6 +393,47 @@ void LinearFitTest() {
 } // LinearFitTest()
 
 
+/**
+ * Linear fit of points off a line, with a non-zero intercept and sum of x,
+ * whose chi^2 is compared with the sum of the squared residuals.
+ */
+template <typename T>
+void LinearFitChiSquareTest() {
+
+  using Data_t = T;
+
+  std::vector<std::tuple<Data_t, Data_t, Data_t>> const data {
+    { Data_t(1), Data_t(3.5), Data_t(0.5) },
+    { Data_t(2), Data_t(4.5), Data_t(1.0) },
+    { Data_t(3), Data_t(8.0), Data_t(1.0) },
+    { Data_t(5), Data_t(10.5), Data_t(2.0) },
+    { Data_t(6), Data_t(14.0), Data_t(1.0) }
+    };
+
+  lar::util::LinearFit<Data_t> fitter;
+  BOOST_CHECK_THROW(fitter.AverageUncertainty(), std::range_error);
+  for (auto const& [ x, y, sy ]: data) fitter.add(x, y, sy);
+  BOOST_REQUIRE(fitter.isValid());
+
+  Data_t const b = fitter.Intercept();
+  Data_t const a = fitter.Slope();
+  Data_t expected_chisq = Data_t(0);
+  for (auto const& [ x, y, sy ]: data) {
+    Data_t const residual = (y - (b + a * x)) / sy;
+    expected_chisq += residual * residual;
+  } // for
+
+  BOOST_CHECK_GT(double(expected_chisq), 0.5);
+  BOOST_CHECK_CLOSE(double(fitter.ChiSquare()), double(expected_chisq), 1e-6);
+
+  lar::util::LinearFitBatch<Data_t> batch(1U);
+  for (auto const& [ x, y, sy ]: data) batch.add(0U, x, y, sy);
+  batch.Fit();
+  BOOST_CHECK_CLOSE(double(batch.ChiSquare(0U)), double(expected_chisq), 1e-6);
+
+} // LinearFitChiSquareTest()
+
+
 /** ****************************************************************************
  * @brief Tests QuadraticFit object with a known input
  */
@@ -664,6 +707,230 @@ void GaussianFitTest() {
 } // QuadraticFitTest()
 
 
+/** ****************************************************************************
+ * @brief Tests the batch interfaces against the single fitters
+ *
+ * Many fits with random data are performed with the single fitters and with
+ * the batch fitters. The results of the batch fitters filled point by point
+ * must be exactly the same; the single fitters filled by `add_batch()` only
+ * need to agree within rounding.
+ */
+template <typename Fitter, typename BatchFitter>
+void CheckBatchFits(
+  BatchFitter const& batch,
+  std::vector<std::size_t> const& offsets,
+  std::vector<typename Fitter::Data_t> const& x,
+  std::vector<typename Fitter::Data_t> const& y,
+  std::vector<typename Fitter::Data_t> const& sy
+) {
+  using Data_t = typename Fitter::Data_t;
+  constexpr Data_t tol = Data_t(1e-6); // percent
+
+  BOOST_CHECK_EQUAL(batch.size(), offsets.size() - 1);
+  for (std::size_t iFit = 0; iFit < batch.size(); ++iFit) {
+    std::size_t const begin = offsets[iFit], end = offsets[iFit + 1];
+
+    // single fitter, point by point: exactly the same results
+    Fitter fitter;
+    for (std::size_t i = begin; i < end; ++i) fitter.add(x[i], y[i], sy[i]);
+    BOOST_CHECK_EQUAL(batch.N(iFit), fitter.N());
+    BOOST_CHECK_EQUAL(batch.isValid(iFit), fitter.isValid());
+    if (!fitter.isValid()) continue;
+
+    auto const params = fitter.FitParameters();
+    auto const errors = fitter.FitParameterErrors();
+    auto const batchParams = batch.FitParameters(iFit);
+    auto const batchErrors = batch.FitParameterErrors(iFit);
+    for (unsigned int i = 0; i < Fitter::NParams; ++i) {
+      BOOST_CHECK_EQUAL(batchParams[i], params[i]);
+      BOOST_CHECK_EQUAL(batchErrors[i], errors[i]);
+    } // for
+    BOOST_CHECK_EQUAL(batch.ChiSquare(iFit), fitter.ChiSquare());
+
+    // single fitter, filled by arrays: same results within rounding
+    Fitter arrayFitter;
+    arrayFitter.add_batch(x.data() + begin, y.data() + begin, sy.data() + begin,
+      end - begin);
+    BOOST_CHECK_EQUAL(arrayFitter.N(), fitter.N());
+    auto const arrayParams = arrayFitter.FitParameters();
+    for (unsigned int i = 0; i < Fitter::NParams; ++i)
+      BOOST_CHECK_CLOSE(arrayParams[i], params[i], tol);
+
+  } // for fits
+} // CheckBatchFits()
+
+
+template <typename T>
+void BatchFitTest() {
+
+  using Data_t = T;
+
+  constexpr unsigned int NFits = 50;
+  std::default_random_engine engine(12345);
+  std::uniform_int_distribution<unsigned int> nPointsDist(1, 23);
+  std::uniform_real_distribution<Data_t> uniform(-1.0, 1.0);
+
+  // the Gaussian fit needs positive values: each fit has its own Gaussian
+  std::vector<std::size_t> offsets { 0U };
+  std::vector<Data_t> x, y, sy;
+  for (unsigned int iFit = 0; iFit < NFits; ++iFit) {
+    unsigned int const nPoints = nPointsDist(engine);
+    Data_t const amplitude = Data_t(10) + Data_t(5) * uniform(engine);
+    Data_t const mean = Data_t(3) * uniform(engine);
+    Data_t const sigma = Data_t(2) + uniform(engine);
+    for (unsigned int i = 0; i < nPoints; ++i) {
+      Data_t const xv = Data_t(-5) + Data_t(10) * i / nPoints;
+      x.push_back(xv);
+      y.push_back(gaus(xv, amplitude, mean, sigma)
+        * (Data_t(1) + Data_t(0.05) * uniform(engine)));
+      // a few points will be ignored because of their null uncertainty
+      sy.push_back((i % 7 == 3)
+        ? Data_t(0): Data_t(1) + Data_t(0.5) * uniform(engine));
+    } // for points
+    offsets.push_back(x.size());
+  } // for fits
+
+  lar::util::LinearFitBatch<Data_t> linearFits(NFits);
+  linearFits.add_groups(offsets.data(), x.data(), y.data(), sy.data());
+  linearFits.Fit();
+  CheckBatchFits<lar::util::LinearFit<Data_t>>
+    (linearFits, offsets, x, y, sy);
+
+  lar::util::QuadraticFitBatch<Data_t> quadraticFits(NFits);
+  quadraticFits.add_groups(offsets.data(), x.data(), y.data(), sy.data());
+  quadraticFits.Fit();
+  CheckBatchFits<lar::util::QuadraticFit<Data_t>>
+    (quadraticFits, offsets, x, y, sy);
+
+  lar::util::GaussianFitBatch<Data_t> gaussianFits(NFits);
+  gaussianFits.add_groups(offsets.data(), x.data(), y.data(), sy.data());
+  gaussianFits.Fit();
+  CheckBatchFits<lar::util::GaussianFit<Data_t>>
+    (gaussianFits, offsets, x, y, sy);
+
+  // clearing keeps the number of fits
+  linearFits.clear();
+  BOOST_CHECK_EQUAL(linearFits.size(), NFits);
+  BOOST_CHECK_EQUAL(linearFits.N(0), 0);
+  BOOST_CHECK(!linearFits.isValid(0));
+
+} // BatchFitTest()
+
+
+/** ****************************************************************************
+ * @brief Tests the removal of points and the sliding window fit
+ *
+ * The result of the fit for each window position is compared with the one
+ * of a fitter filled from scratch with the points in the window (with the
+ * same x origin).
+ */
+template <typename Fitter>
+void CheckSlidingWindowFit(
+  std::vector<typename Fitter::Data_t> const& x,
+  std::vector<typename Fitter::Data_t> const& y,
+  std::vector<typename Fitter::Data_t> const& sy,
+  std::size_t windowSize, std::size_t refreshPeriod,
+  typename Fitter::Data_t tol // relative to the parameter errors
+) {
+  using Data_t = typename Fitter::Data_t;
+
+  lar::util::SlidingWindowFit<Fitter> scanner(windowSize, refreshPeriod);
+  BOOST_CHECK_EQUAL(scanner.windowSize(), windowSize);
+  BOOST_CHECK_EQUAL(scanner.refreshPeriod(), refreshPeriod);
+
+  auto const results = scanner.fit(x.data(), y.data(), sy.data(), x.size());
+  BOOST_CHECK_EQUAL(results.size(), x.size() - windowSize + 1);
+
+  for (auto const& result: results) {
+    Fitter fitter;
+    for (std::size_t i = result.first; i < result.first + windowSize; ++i)
+      fitter.add(x[i] - result.origin, y[i], sy[i]);
+    BOOST_CHECK_EQUAL(result.valid, fitter.isValid());
+    BOOST_CHECK_EQUAL(result.NDF, fitter.NDF());
+    if (!fitter.isValid()) continue;
+    // the difference must be negligible compared to the fit uncertainty
+    auto const params = fitter.FitParameters();
+    auto const errors = fitter.FitParameterErrors();
+    for (unsigned int i = 0; i < Fitter::NParams; ++i)
+      BOOST_CHECK_SMALL(result.params[i] - params[i], tol * errors[i]);
+    BOOST_CHECK_SMALL
+      (result.chi2 - fitter.ChiSquare(), tol * (Data_t(1) + fitter.ChiSquare()));
+  } // for
+
+} // CheckSlidingWindowFit()
+
+
+template <typename T>
+void SlidingWindowFitTest() {
+
+  using Data_t = T;
+
+  //
+  // remove()
+  //
+  lar::util::LinearFit<Data_t> fitter;
+  fitter.add(Data_t(0), Data_t(1));
+  fitter.add(Data_t(1), Data_t(3), Data_t(0.5));
+  fitter.add(Data_t(2), Data_t(-7), Data_t(2));
+  fitter.add(Data_t(3), Data_t(7));
+  BOOST_CHECK(fitter.remove(Data_t(2), Data_t(-7), Data_t(2)));
+  BOOST_CHECK(!fitter.remove(Data_t(5), Data_t(5), Data_t(0))); // ignored
+  BOOST_CHECK_EQUAL(fitter.N(), 3);
+  auto const params = fitter.FitParameters();
+  BOOST_CHECK_CLOSE(params[0], Data_t(1), 1e-6);
+  BOOST_CHECK_CLOSE(params[1], Data_t(2), 1e-6);
+  BOOST_CHECK_SMALL(fitter.ChiSquare(), Data_t(1e-8));
+
+  // removing all the points leaves empty statistics
+  fitter.remove(Data_t(0), Data_t(1));
+  fitter.remove(Data_t(1), Data_t(3), Data_t(0.5));
+  fitter.remove(Data_t(3), Data_t(7));
+  BOOST_CHECK_EQUAL(fitter.N(), 0);
+  BOOST_CHECK(!fitter.isValid());
+  lar::util::LinearFit<Data_t> freshFitter;
+  for (Data_t x: { Data_t(4), Data_t(5), Data_t(7) }) {
+    fitter.add(x, Data_t(2) * x);
+    freshFitter.add(x, Data_t(2) * x);
+  } // for
+  BOOST_CHECK_EQUAL(fitter.FitParameters()[0], freshFitter.FitParameters()[0]);
+  BOOST_CHECK_EQUAL(fitter.FitParameters()[1], freshFitter.FitParameters()[1]);
+
+  //
+  // sliding window
+  //
+  std::default_random_engine engine(54321);
+  std::uniform_real_distribution<Data_t> uniform(-1.0, 1.0);
+  constexpr unsigned int NPoints = 500;
+  std::vector<Data_t> x, y, sy;
+  for (unsigned int i = 0; i < NPoints; ++i) {
+    Data_t const xv = Data_t(0.1) * i;
+    x.push_back(xv);
+    y.push_back(gaus(xv, Data_t(20), Data_t(25), Data_t(8))
+      * (Data_t(1) + Data_t(0.05) * uniform(engine)));
+    sy.push_back((i % 11 == 5)
+      ? Data_t(0): Data_t(1) + Data_t(0.5) * uniform(engine));
+  } // for
+
+  using LinearFit_t = lar::util::LinearFit<Data_t>;
+  using QuadraticFit_t = lar::util::QuadraticFit<Data_t>;
+  using GaussianFit_t = lar::util::GaussianFit<Data_t>;
+  CheckSlidingWindowFit<LinearFit_t>(x, y, sy, 10, 64, 1e-6);
+  CheckSlidingWindowFit<LinearFit_t>(x, y, sy, 3, 0, 1e-4); // no refresh
+  CheckSlidingWindowFit<QuadraticFit_t>(x, y, sy, 12, 100, 1e-6);
+  CheckSlidingWindowFit<GaussianFit_t>(x, y, sy, 100, 50, 1e-4);
+
+  // too few points for a single window
+  lar::util::SlidingWindowFit<lar::util::LinearFit<Data_t>> scanner(20);
+  BOOST_CHECK(scanner.fit(x.data(), y.data(), 10).empty());
+
+  BOOST_CHECK_THROW(
+    lar::util::SlidingWindowFit<lar::util::LinearFit<Data_t>>(0),
+    std::invalid_argument
+    );
+
+} // SlidingWindowFitTest()
+
+
 //------------------------------------------------------------------------------
 //--- registration of tests
 //
@@ -680,6 +947,10 @@ BOOST_AUTO_TEST_CASE(LinearFitRealTest) {
   LinearFitTest<double>();
 }
 
+BOOST_AUTO_TEST_CASE(LinearFitChiSquareRealTest) {
+  LinearFitChiSquareTest<double>();
+}
+
 //
 // QuadraticFit tests
 //
@@ -694,3 +965,16 @@ BOOST_AUTO_TEST_CASE(GaussianFitRealTest) {
   GaussianFitTest<double>();
 }
 
+//
+// batch fit tests
+//
+BOOST_AUTO_TEST_CASE(BatchFitRealTest) {
+  BatchFitTest<double>();
+}
+
+//
+// sliding window tests
+//
+BOOST_AUTO_TEST_CASE(SlidingWindowFitRealTest) {
+  SlidingWindowFitTest<double>();
+}
@@ -0,0 +1,275 @@
+/**
+ * @file    ThreadBulkAllocator_test.cc
+ * @brief   Tests the thread-aware bulk allocator
+ * @date    October 19, 2026
+ * @see     lardata/Utilities/ThreadBulkAllocator.h
+ *
+ * See http://www.boost.org/libs/test for the Boost test library home page.
+ */
+
+// C/C++ standard libraries
+#include <map>
+#include <list>
+#include <vector>
+#include <thread>
+#include <random>
+#include <numeric> // std::accumulate()
+#include <cstddef> // std::max_align_t
+#include <cstdint> // std::uintptr_t
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( ThreadBulkAllocator_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK()
+
+// LArSoft libraries
+#include "lardata/Utilities/ThreadBulkAllocator.h"
+
+
+/// The seed for the default random engine
+constexpr unsigned int RandomSeed = 12345;
+
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+
+template <template <typename> class Alloc>
+using IntMap_t
+  = std::map<int, int, std::less<int>, Alloc<std::pair<const int, int>>>;
+
+template <template <typename> class Alloc>
+using IntList_t = std::list<int, Alloc<int>>;
+
+
+/// Fills a map and a list with pseudo-random content; returns the list sum.
+template <typename Map, typename List>
+long long fillContainers
+  (Map& map, List& list, unsigned int n, unsigned int seed)
+{
+  std::default_random_engine random_engine(seed);
+  std::uniform_int_distribution<int> uniform(-1000, 1000);
+  long long sum = 0;
+  for (unsigned int i = 0; i < n; ++i) {
+    int const value = uniform(random_engine);
+    ++map[value];
+    list.push_back(value);
+    sum += value;
+  } // for
+  return sum;
+} // fillContainers()
+
+
+//------------------------------------------------------------------------------
+void BasicAllocatorTest() {
+
+  constexpr unsigned int N = 50000;
+
+  lar::ThreadBulkResource resource
+    ({ lar::BulkArenaScope::Explicit, 4096, true });
+
+  IntMap_t<std::allocator> stl_map;
+  IntList_t<std::allocator> stl_list;
+  fillContainers(stl_map, stl_list, N, RandomSeed);
+
+  {
+    lar::ThreadBulkAllocator<int> allocator(resource);
+    IntMap_t<lar::ThreadBulkAllocator> bulk_map
+      (std::less<int>(), allocator);
+    IntList_t<lar::ThreadBulkAllocator> bulk_list(allocator);
+    fillContainers(bulk_map, bulk_list, N, RandomSeed);
+
+    BOOST_CHECK(bulk_map.get_allocator() == allocator);
+    BOOST_CHECK(std::equal(
+      bulk_map.begin(), bulk_map.end(), stl_map.begin(), stl_map.end()
+      ));
+    BOOST_CHECK(std::equal(
+      bulk_list.begin(), bulk_list.end(), stl_list.begin(), stl_list.end()
+      ));
+
+    BOOST_CHECK_EQUAL(resource.nArenas(), 1U);
+    BOOST_CHECK_GT(resource.nChunks(), 1U);
+
+    // freed memory is reused: removing and adding back costs no new chunk
+    std::size_t const allocated = resource.allocatedBytes();
+    for (unsigned int i = 0; i < N / 2; ++i) bulk_list.pop_front();
+    for (unsigned int i = 0; i < N / 2; ++i) bulk_list.push_back(i);
+    BOOST_CHECK_EQUAL(resource.allocatedBytes(), allocated);
+  }
+
+  // scope is "explicit": end of job and end of event leave memory alone
+  BOOST_CHECK(!resource.endOf(lar::BulkArenaScope::Job));
+  BOOST_CHECK(!resource.endOf(lar::BulkArenaScope::Event));
+  BOOST_CHECK_GT(resource.allocatedBytes(), 0U);
+
+  BOOST_CHECK(resource.endOf(lar::BulkArenaScope::Explicit));
+  BOOST_CHECK_EQUAL(resource.allocatedBytes(), 0U);
+  BOOST_CHECK_EQUAL(resource.nChunks(), 0U);
+
+  // the resource is still usable after release
+  {
+    IntList_t<lar::ThreadBulkAllocator> bulk_list
+      { lar::ThreadBulkAllocator<int>(resource) };
+    bulk_list.assign(100U, 5);
+    BOOST_CHECK_EQUAL
+      (std::accumulate(bulk_list.begin(), bulk_list.end(), 0), 500);
+  }
+  resource.release();
+
+} // BasicAllocatorTest()
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Checks the alignment of blocks reused from the free lists.
+ *
+ * A block recycled with a small alignment is in the same size class as larger
+ * requests with a larger alignment, which must still be honoured.
+ */
+void RecycledAlignmentTest() {
+
+  constexpr std::size_t MaxAlign = alignof(std::max_align_t);
+
+  auto const isAligned = [](void const* p, std::size_t align)
+    { return reinterpret_cast<std::uintptr_t>(p) % align == 0; };
+
+  lar::ThreadBulkResource resource
+    ({ lar::BulkArenaScope::Explicit, 4096, true });
+
+  // leaves the current chunk at an odd address
+  resource.allocate(993, 1);
+
+  void* small = resource.allocate(8, 8);
+  BOOST_CHECK(isAligned(small, 8));
+  resource.deallocate(small, 8, 8);
+
+  void* large = resource.allocate(MaxAlign, MaxAlign);
+  BOOST_CHECK(isAligned(large, MaxAlign));
+
+  // the same with all the size classes, starting from odd addresses
+  for (std::size_t bytes = 1; bytes <= 8 * MaxAlign; bytes += 3) {
+    BOOST_TEST_CONTEXT("block of " << bytes << " bytes") {
+      resource.allocate(1, 1);
+      void* p = resource.allocate(bytes, 1);
+      resource.deallocate(p, bytes, 1);
+      void* q = resource.allocate(bytes, MaxAlign);
+      BOOST_CHECK(isAligned(q, MaxAlign));
+      resource.deallocate(q, bytes, MaxAlign);
+    }
+  } // for
+
+  resource.release();
+
+} // RecycledAlignmentTest()
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Many threads filling containers from the same resource.
+ *
+ * Each thread fills its own map and list, and the result is compared with
+ * the one from the standard allocator. Half of the lists are then destroyed
+ * by a different thread than the one which filled them.
+ * The test is repeated for a few "events", releasing the memory after each.
+ */
+void MultithreadStressTest() {
+
+  constexpr unsigned int NThreads = 8;
+  constexpr unsigned int N = 100000;
+  constexpr unsigned int NEvents = 3;
+
+  lar::ThreadBulkResource resource
+    ({ lar::BulkArenaScope::Event, 64 * 1024, true });
+
+  using Map_t = IntMap_t<lar::ThreadBulkAllocator>;
+  using List_t = IntList_t<lar::ThreadBulkAllocator>;
+
+  // expected results
+  std::vector<long long> expectedSums(NThreads);
+  std::vector<std::size_t> expectedMapSizes(NThreads);
+  for (unsigned int iThread = 0; iThread < NThreads; ++iThread) {
+    IntMap_t<std::allocator> map;
+    IntList_t<std::allocator> list;
+    expectedSums[iThread]
+      = fillContainers(map, list, N, RandomSeed + iThread);
+    expectedMapSizes[iThread] = map.size();
+  } // for
+
+  for (unsigned int iEvent = 0; iEvent < NEvents; ++iEvent) {
+    BOOST_TEST_CHECKPOINT("Event #" << iEvent);
+
+    std::vector<std::unique_ptr<Map_t>> maps(NThreads);
+    std::vector<std::unique_ptr<List_t>> lists(NThreads);
+    std::vector<long long> sums(NThreads, 0);
+
+    std::vector<std::thread> threads;
+    for (unsigned int iThread = 0; iThread < NThreads; ++iThread) {
+      threads.emplace_back([&, iThread](){
+        lar::ThreadBulkAllocator<int> allocator(resource);
+        maps[iThread] = std::make_unique<Map_t>(std::less<int>(), allocator);
+        lists[iThread] = std::make_unique<List_t>(allocator);
+        sums[iThread] = fillContainers
+          (*maps[iThread], *lists[iThread], N, RandomSeed + iThread);
+      });
+    } // for
+    for (auto& thread: threads) thread.join();
+    threads.clear();
+
+    BOOST_CHECK_GE(resource.nArenas(), 1U);
+    BOOST_CHECK_LE(resource.nArenas(), NThreads * (iEvent + 1));
+
+    for (unsigned int iThread = 0; iThread < NThreads; ++iThread) {
+      BOOST_CHECK_EQUAL(sums[iThread], expectedSums[iThread]);
+      BOOST_CHECK_EQUAL(
+        std::accumulate(lists[iThread]->begin(), lists[iThread]->end(), 0LL),
+        expectedSums[iThread]
+        );
+      BOOST_CHECK_EQUAL(maps[iThread]->size(), expectedMapSizes[iThread]);
+    } // for
+
+    // cross-thread deallocation and reuse: each thread destroys the list of
+    // another one and fills a new one
+    for (unsigned int iThread = 0; iThread < NThreads; ++iThread) {
+      threads.emplace_back([&, iThread](){
+        unsigned int const iOther = (iThread + 1) % NThreads;
+        lists[iOther]->clear();
+        List_t list { lar::ThreadBulkAllocator<int>(resource) };
+        list.assign(N, 1);
+        sums[iOther]
+          = std::accumulate(list.begin(), list.end(), 0LL);
+      });
+    } // for
+    for (auto& thread: threads) thread.join();
+    threads.clear();
+
+    for (unsigned int iThread = 0; iThread < NThreads; ++iThread)
+      BOOST_CHECK_EQUAL(sums[iThread], N);
+
+    // end of the event: all containers must be gone before memory is released
+    maps.clear();
+    lists.clear();
+    BOOST_CHECK(!resource.endOf(lar::BulkArenaScope::Job));
+    BOOST_CHECK_GT(resource.allocatedBytes(), 0U);
+    BOOST_CHECK(resource.endOf(lar::BulkArenaScope::Event));
+    BOOST_CHECK_EQUAL(resource.allocatedBytes(), 0U);
+
+  } // for events
+
+} // MultithreadStressTest()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(BasicAllocator) {
+  BasicAllocatorTest();
+}
+
+BOOST_AUTO_TEST_CASE(RecycledAlignment) {
+  RecycledAlignmentTest();
+}
+
+BOOST_AUTO_TEST_CASE(MultithreadStress) {
+  MultithreadStressTest();
+}
@@ -0,0 +1,243 @@
+/**
+ * @file    UBChannelTable_test.cc
+ * @brief   Test of the direct-indexed channel map against the std::map one
+ * @date    October 19, 2026
+ * @see     lardata/Utilities/UBChannelTable.h
+ *
+ * See http://www.boost.org/libs/test for the Boost test library home page.
+ *
+ * The reference is the construction of `util::UBChannelMap_t` and
+ * `util::UBChannelReverseMap_t` from the database tuples which
+ * `util::DatabaseUtil` used before the table was introduced.
+ */
+
+// C/C++ standard libraries
+#include <algorithm> // std::shuffle()
+#include <cstdint> // std::int32_t
+#include <cstdio> // std::remove()
+#include <cstdlib> // atoi()
+#include <fstream>
+#include <iterator> // std::istreambuf_iterator
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( UBChannelTable_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK()
+
+// LArSoft libraries
+#include "lardata/Utilities/UBChannelTable.h"
+
+
+/// The seed for the default random engine
+constexpr unsigned int RandomSeed = 12345;
+
+
+//------------------------------------------------------------------------------
+//--- Legacy construction (reference)
+//
+void legacyMaps(std::vector<std::string> const& tuples,
+                util::UBChannelMap_t& fChannelMap,
+                util::UBChannelReverseMap_t& fChannelReverseMap)
+{
+  for (std::string tup: tuples) {
+    tup = tup.substr(1,tup.length()-2);      // Strip initial & final parentheses.
+    std::vector<std::string> fields;
+    std::stringstream ss(tup);
+    std::string item;
+    while (std::getline(ss, item, ',')) fields.push_back(item);
+
+    int crate_id     = atoi( fields[0].c_str() );
+    int slot         = atoi( fields[1].c_str() );
+    int boardChan    = atoi( fields[2].c_str() );
+    int larsoft_chan = atoi( fields[3].c_str() );
+
+    util::UBDaqID daq_id(crate_id,slot,boardChan);
+    std::pair<util::UBDaqID, util::UBLArSoftCh_t> p(daq_id,larsoft_chan);
+    fChannelMap.insert( p );
+    fChannelReverseMap.insert( std::pair< util::UBLArSoftCh_t, util::UBDaqID >( larsoft_chan, daq_id ) );
+  }
+} // legacyMaps()
+
+
+/// Tuples for 10 crates of 16 cards of 64 channels, shuffled, with duplicates.
+std::vector<std::string> makeTuples() {
+  std::vector<std::string> tuples;
+  int larsoft_chan = 0;
+  for (int crate = 1; crate <= 10; ++crate)
+    for (int card = 4; card < 20; ++card)
+      for (int channel = 0; channel < 64; ++channel)
+        tuples.push_back("(" + std::to_string(crate) + "," + std::to_string(card) + ","
+          + std::to_string(channel) + "," + std::to_string(larsoft_chan++) + ")");
+  std::default_random_engine random_engine(RandomSeed);
+  std::shuffle(tuples.begin(), tuples.end(), random_engine);
+  tuples.push_back("(3,7,12,99999)"); // duplicate DAQ ID
+  tuples.push_back("(11,0,0,42)");    // duplicate LArSoft channel
+  return tuples;
+} // makeTuples()
+
+
+util::UBChannelTable makeTable(std::vector<std::string> const& tuples) {
+  std::vector<util::UBChannelTable::Entry> entries;
+  for (std::string const& tup: tuples) {
+    auto const entry = util::UBChannelTable::parseDBTuple(tup.c_str());
+    BOOST_REQUIRE(entry);
+    entries.push_back(*entry);
+  }
+  return util::UBChannelTable(std::move(entries));
+} // makeTable()
+
+
+void checkTable(util::UBChannelTable const& table,
+                util::UBChannelMap_t const& expectedMap,
+                util::UBChannelReverseMap_t const& expectedReverseMap)
+{
+  BOOST_CHECK_EQUAL(table.size(), expectedMap.size());
+  for (auto const& [daqID, channel]: expectedMap)
+    BOOST_CHECK_EQUAL(table.LArSoftChannel(daqID), channel);
+  for (auto const& [channel, daqID]: expectedReverseMap) {
+    util::UBDaqID const* tableID = table.DaqID(channel);
+    BOOST_REQUIRE(tableID);
+    BOOST_CHECK_EQUAL(tableID->crate, daqID.crate);
+    BOOST_CHECK_EQUAL(tableID->card, daqID.card);
+    BOOST_CHECK_EQUAL(tableID->channel, daqID.channel);
+  }
+
+  // the map views
+  util::UBChannelMap_t const map = table.map();
+  BOOST_CHECK(map.size() == expectedMap.size());
+  for (auto const& [daqID, channel]: expectedMap) {
+    auto const iMap = map.find(daqID);
+    BOOST_REQUIRE(iMap != map.end());
+    BOOST_CHECK_EQUAL(iMap->second, channel);
+  }
+  BOOST_CHECK_EQUAL(table.reverseMap().size(), expectedReverseMap.size());
+} // checkTable()
+
+
+//------------------------------------------------------------------------------
+//--- Test code
+//
+void LookupTest() {
+  std::vector<std::string> const tuples = makeTuples();
+  util::UBChannelMap_t expectedMap;
+  util::UBChannelReverseMap_t expectedReverseMap;
+  legacyMaps(tuples, expectedMap, expectedReverseMap);
+
+  util::UBChannelTable const table = makeTable(tuples);
+  checkTable(table, expectedMap, expectedReverseMap);
+
+  // first entry wins
+  BOOST_CHECK_NE(table.LArSoftChannel(3, 7, 12), 99999);
+  BOOST_CHECK_EQUAL(table.LArSoftChannel(11, 0, 0), 42);
+  BOOST_CHECK_NE(table.DaqID(42)->crate, 11);
+
+  // unknown identifiers
+  BOOST_CHECK_EQUAL(table.LArSoftChannel(0, 4, 0), util::UBChannelTable::InvalidChannel);
+  BOOST_CHECK_EQUAL(table.LArSoftChannel(1, 2, 0), util::UBChannelTable::InvalidChannel);
+  BOOST_CHECK_EQUAL(table.LArSoftChannel(20, 4, 0), util::UBChannelTable::InvalidChannel);
+  BOOST_CHECK_EQUAL(table.LArSoftChannel(-1, 4, 0), util::UBChannelTable::InvalidChannel);
+  BOOST_CHECK(table.DaqID(-1) == nullptr);
+  BOOST_CHECK(table.DaqID(20000) == nullptr);
+  BOOST_CHECK(table.DaqID(99998) == nullptr);
+
+  // full lookup of all the channels
+  long long sumMap = 0, sumTable = 0;
+  for (int crate = 1; crate <= 10; ++crate) {
+    for (int card = 4; card < 20; ++card) {
+      for (int channel = 0; channel < 64; ++channel) {
+        sumMap += expectedMap.find(util::UBDaqID(crate, card, channel))->second;
+        sumTable += table.LArSoftChannel(crate, card, channel);
+      }
+    }
+  }
+  BOOST_CHECK_EQUAL(sumTable, sumMap);
+} // LookupTest()
+
+
+void CacheTest() {
+  std::string const path = "UBChannelTable_test_cache.bin";
+  std::vector<std::string> const tuples = makeTuples();
+  util::UBChannelMap_t expectedMap;
+  util::UBChannelReverseMap_t expectedReverseMap;
+  legacyMaps(tuples, expectedMap, expectedReverseMap);
+
+  makeTable(tuples).writeCache(path);
+  util::UBChannelTable const table = util::UBChannelTable::readCache(path);
+  checkTable(table, expectedMap, expectedReverseMap);
+
+  // a truncated file is rejected
+  {
+    std::ifstream in(path, std::ios::binary);
+    std::string const content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::ofstream out(path, std::ios::binary);
+    out.write(content.data(), content.size() - 4);
+  }
+  BOOST_CHECK_THROW(util::UBChannelTable::readCache(path), cet::exception);
+  BOOST_CHECK_THROW(util::UBChannelTable::readCache("UBChannelTable_test_missing.bin"), cet::exception);
+
+  // a corrupted entry count is rejected before any allocation
+  {
+    std::int32_t const nEntries = std::numeric_limits<std::int32_t>::max();
+    std::ofstream out(path, std::ios::binary);
+    out.write("UBCHMAP1", 8);
+    out.write(reinterpret_cast<char const*>(&nEntries), sizeof(nEntries));
+  }
+  BOOST_CHECK_THROW(util::UBChannelTable::readCache(path), cet::exception);
+
+  std::remove(path.c_str());
+} // CacheTest()
+
+
+void ParseTest() {
+  auto const entry = util::UBChannelTable::parseDBTuple("(1,5,31,2047)");
+  BOOST_REQUIRE(entry);
+  BOOST_CHECK_EQUAL(entry->daqID.crate, 1);
+  BOOST_CHECK_EQUAL(entry->daqID.card, 5);
+  BOOST_CHECK_EQUAL(entry->daqID.channel, 31);
+  BOOST_CHECK_EQUAL(entry->channel, 2047);
+  BOOST_CHECK(!util::UBChannelTable::parseDBTuple("1,5,31,2047"));
+  BOOST_CHECK(!util::UBChannelTable::parseDBTuple("(1,5,31)"));
+  BOOST_CHECK(!util::UBChannelTable::parseDBTuple("(1,5,x,2047)"));
+
+  // negative identifiers are not in the tables, but are still entries
+  util::UBChannelTable const table({
+    { util::UBDaqID(-1, 0, 0), 0 },
+    { util::UBDaqID(0, 1, 2), -5 },
+    { util::UBDaqID(0, 1, 3), 7 }
+    });
+  BOOST_CHECK_EQUAL(table.size(), 1U);
+  BOOST_CHECK_EQUAL(table.LArSoftChannel(0, 1, 3), 7);
+  BOOST_CHECK_EQUAL(table.LArSoftChannel(0, 1, 2), util::UBChannelTable::InvalidChannel);
+  BOOST_CHECK_EQUAL(table.LArSoftChannel(0, 0, 0), util::UBChannelTable::InvalidChannel);
+  BOOST_CHECK(table.DaqID(0) == nullptr);
+  BOOST_REQUIRE(table.DaqID(7));
+  BOOST_CHECK_EQUAL(table.DaqID(7)->channel, 3);
+  BOOST_CHECK_EQUAL(table.entries().size(), 3U);
+  util::UBChannelMap_t const channelMap = table.map();
+  BOOST_CHECK_EQUAL(channelMap.size(), 3U);
+  BOOST_CHECK_EQUAL(channelMap.at(util::UBDaqID(-1, 0, 0)), 0);
+  BOOST_CHECK_EQUAL(channelMap.at(util::UBDaqID(0, 1, 2)), -5);
+  BOOST_CHECK_EQUAL(table.reverseMap().size(), 3U);
+} // ParseTest()
+
+
+//------------------------------------------------------------------------------
+//--- registration of tests
+//
+
+BOOST_AUTO_TEST_CASE(LookupTestCase) {
+  LookupTest();
+}
+
+BOOST_AUTO_TEST_CASE(CacheTestCase) {
+  CacheTest();
+}
+
+BOOST_AUTO_TEST_CASE(ParseTestCase) {
+  ParseTest();
+}
@@ -10,6 +10,7 @@
 
 // LArSoft libraries
 #include "lardata/Utilities/FindManyInChainP.h"
+#include "lardata/Utilities/FindManyInChainIndex.h"
 #include "lardataobj/RecoBase/Shower.h"
 #include "lardataobj/RecoBase/PFParticle.h"
 #include "lardataobj/RecoBase/Cluster.h"
@@ -34,6 +35,7 @@
 
 // C/C++ standard libraries
 #include <set>
+#include <algorithm> // std::equal()
 #include <cassert>
 
 
@@ -190,6 +192,38 @@ void lar::test::AssnsChainTest::printAssociatedHits
     showerHits(showers, event, showerTag);
   assert(showerHits.size() == showers->size());
 
+  //
+  // the flat index must deliver the same hits, in the same order;
+  // the second request must be served by the cache
+  //
+  auto const showerHitIndex = lar::FindManyInChainCache::global()
+    .get<recob::Hit, recob::Cluster, recob::PFParticle>
+    (showers, event, showerTag);
+  if (showerHitIndex != lar::FindManyInChainCache::global()
+    .get<recob::Hit, recob::Cluster, recob::PFParticle>
+    (showers, event, showerTag)
+    )
+  {
+    throw cet::exception("AssnsChainTest")
+      << "Test failed: FindManyInChainCache rebuilt an index.\n";
+  }
+  if (showerHitIndex->size() != showers->size()) {
+    throw cet::exception("AssnsChainTest")
+      << "Test failed: FindManyInChainIndex has " << showerHitIndex->size()
+      << " entries for " << showers->size() << " showers.\n";
+  }
+  for (std::size_t iShower = 0; iShower < showers->size(); ++iShower) {
+    auto const& hits = showerHits.at(iShower);
+    auto const& indexedHits = showerHitIndex->at(iShower);
+    if (!std::equal(hits.begin(), hits.end(),
+      indexedHits.begin(), indexedHits.end()))
+    {
+      throw cet::exception("AssnsChainTest")
+        << "Test failed: FindManyInChainIndex hits of shower #" << iShower
+        << " differ from FindManyInChainP ones.\n";
+    }
+  } // for iShower
+
   //
   // print the associated hits (just the art pointer so far)
   //
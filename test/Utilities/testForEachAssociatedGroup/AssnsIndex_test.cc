@@ -0,0 +1,202 @@
+/**
+ * @file   AssnsIndex_test.cc
+ * @brief  Unit test for `util::AssnsIndex`.
+ * @date   October 19, 2026
+ *
+ */
+
+// LArSoft libraries
+#include "lardata/Utilities/AssnsIndex.h"
+
+// framework libraries
+#include "canvas/Persistency/Provenance/ProductID.h"
+#include "canvas/Persistency/Common/Ptr.h"
+#include "canvas/Persistency/Common/Assns.h"
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( AssnsIndex_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// C/C++ standard libraries
+#include <array>
+#include <vector>
+#include <random>
+
+
+//------------------------------------------------------------------------------
+// ROOT libraries
+#include "TROOT.h" // gROOT
+#include "TInterpreter.h"
+#include "TClassEdit.h"
+
+// C/C++ standard libraries
+#include <string>
+#include <typeinfo>
+
+template <typename T>
+TClass* QuickGenerateTClass() {
+
+  // magic! this interpreter call is needed before GetNormalizedName() is called
+  TInterpreter* interpreter = gROOT->GetInterpreter();
+
+  // demangle name of type T
+  int err; // we'll ignore errors
+  char* classNameC = TClassEdit::DemangleTypeIdName(typeid(T), err);
+
+  // "normalise" it
+  std::string normalizedClassName;
+  TClassEdit::GetNormalizedName(normalizedClassName, classNameC);
+
+  // clean up
+  std::free(classNameC);
+
+  // generate and register the TClass; load it and be silent.
+  return interpreter->GenerateTClass(normalizedClassName.c_str(), kTRUE, kTRUE);
+
+} // QuickGenerateTClass()
+
+
+//------------------------------------------------------------------------------
+// types used in the association (they actually do not matter)
+struct TypeA {};
+struct TypeB {};
+
+using MyAssns_t = art::Assns<TypeA, TypeB>;
+using Index_t = art::Ptr<TypeA>::key_type;
+
+
+//------------------------------------------------------------------------------
+/// Checks `index` against `assns` (whatever its order).
+void CheckIndex(
+  MyAssns_t const& assns, util::AssnsIndex<MyAssns_t> const& index,
+  std::size_t nA
+) {
+
+  BOOST_CHECK_EQUAL(index.size(), nA);
+  BOOST_CHECK_EQUAL(index.nAssns(), assns.size());
+
+  // expected groups, in association order
+  std::vector<std::vector<std::size_t>> expected(nA);
+  for (std::size_t i = 0; i < assns.size(); ++i)
+    expected[assns[i].first.key()].push_back(i);
+
+  for (std::size_t aKey = 0; aKey < nA; ++aKey) {
+    BOOST_TEST_MESSAGE("  A=" << aKey);
+    auto const& expectedPos = expected[aKey];
+    auto const& positions = index.positions(aKey);
+    auto const& Bs = index.group(aKey);
+    auto const& BKeys = index.rightKeys(aKey);
+    BOOST_CHECK_EQUAL(index.groupSize(aKey), expectedPos.size());
+    BOOST_CHECK_EQUAL(positions.size(), expectedPos.size());
+    BOOST_CHECK_EQUAL(Bs.size(), expectedPos.size());
+    BOOST_CHECK_EQUAL(BKeys.size(), expectedPos.size());
+    for (std::size_t j = 0; j < expectedPos.size(); ++j) {
+      BOOST_CHECK_EQUAL(positions[j], expectedPos[j]);
+      BOOST_CHECK_EQUAL(Bs[j], assns[expectedPos[j]].second);
+      BOOST_CHECK_EQUAL(BKeys[j], assns[expectedPos[j]].second.key());
+    } // for j
+  } // for A
+
+  // inverse index
+  auto const& inverse = index.inverse();
+  std::size_t nInverse = 0U;
+  for (std::size_t i = 0; i < assns.size(); ++i) {
+    art::Ptr<TypeB> const& B = assns[i].second;
+    auto const& As = inverse.group(B);
+    auto const& positions = inverse.positions(B);
+    BOOST_CHECK_EQUAL(As.size(), positions.size());
+    std::size_t n = 0U;
+    for (std::size_t j = 0; j < As.size(); ++j) {
+      BOOST_CHECK_EQUAL(assns[positions[j]].first, As[j]);
+      BOOST_CHECK_EQUAL(assns[positions[j]].second, B);
+      if (j > 0) BOOST_CHECK_LT(positions[j - 1], positions[j]);
+      if (positions[j] == i) ++n;
+    } // for
+    BOOST_CHECK_EQUAL(n, 1U); // this association must be there exactly once
+    ++nInverse;
+  } // for
+  BOOST_CHECK_EQUAL(nInverse, assns.size());
+
+} // CheckIndex()
+
+
+//------------------------------------------------------------------------------
+void SortedAssnsIndexTest() {
+
+  // association description: B's for each A (A=2 has none)
+  std::array<std::pair<Index_t, std::vector<Index_t>>, 3U> expected;
+  expected[0] = { 0, { 0, 3, 6 } };
+  expected[1] = { 1, { 2, 4, 6 } };
+  expected[2] = { 3, { 8, 10, 12, 13 } };
+  art::ProductID aPID{ 5 }, bPID{ 12 };
+  std::vector<TypeA> const As(4U);
+
+  // fill the association; left pointers point to actual objects
+  MyAssns_t assns;
+  for (auto const& pair: expected) {
+    auto const& aIndex = pair.first;
+    for (auto const& bIndex: pair.second) {
+      assns.addSingle
+        ({ aPID, &As[aIndex], aIndex }, { bPID, bIndex, nullptr });
+    } // for bIndex
+  } // for pair
+
+  util::AssnsIndex<MyAssns_t> const index(assns, 5U);
+  BOOST_CHECK_EQUAL(index.leftID(), aPID);
+  BOOST_CHECK(index.group(2U).empty());
+  BOOST_CHECK(index.group(art::Ptr<TypeA>{ aPID, 7U, nullptr }).empty());
+  BOOST_CHECK_THROW(index.group(art::Ptr<TypeA>{ bPID, 0U, nullptr }),
+    cet::exception);
+  CheckIndex(assns, index, 5U);
+
+  // left pointers are the ones from the association, also in the inverse
+  BOOST_CHECK(index.left(2U).isNull());
+  BOOST_CHECK_EQUAL(index.left(3U).get(), &As[3U]);
+  for (auto const& pair: assns) {
+    for (art::Ptr<TypeA> const& A: index.inverse().group(pair.second))
+      BOOST_CHECK_EQUAL(A.get(), &As[A.key()]);
+  } // for
+
+  // the number of groups is taken from the association if not specified
+  CheckIndex(assns, util::makeAssnsIndex(assns), 4U);
+
+} // SortedAssnsIndexTest()
+
+
+//------------------------------------------------------------------------------
+void UnsortedAssnsIndexTest(unsigned int nThreads) {
+
+  constexpr std::size_t nA = 500U;
+  constexpr std::size_t nAssns = 100000U;
+  art::ProductID aPID{ 5 }, bPID{ 12 }, b2PID{ 13 };
+
+  std::mt19937 rand(12345);
+  std::uniform_int_distribution<std::size_t> pickA(0, nA - 1), pickB(0, 999);
+  MyAssns_t assns;
+  for (std::size_t i = 0; i < nAssns; ++i) {
+    assns.addSingle(
+      { aPID, pickA(rand), nullptr },
+      { ((i % 3 == 0)? b2PID: bPID), pickB(rand), nullptr }
+      );
+  } // for
+
+  CheckIndex(assns, util::AssnsIndex<MyAssns_t>(assns, nA, nThreads), nA);
+
+} // UnsortedAssnsIndexTest()
+
+
+//------------------------------------------------------------------------------
+//--- tests
+//
+BOOST_AUTO_TEST_CASE(AssnsIndexTestCase) {
+
+  // art::Assns constructor tries to have ROOT initialise its streamer, which
+  // requires a TClass instance which is not present at this time.
+  // This trick creates that TClass.
+  QuickGenerateTClass<MyAssns_t>();
+
+  SortedAssnsIndexTest();
+  UnsortedAssnsIndexTest(1U);
+  UnsortedAssnsIndexTest(4U);
+} // AssnsIndexTestCase
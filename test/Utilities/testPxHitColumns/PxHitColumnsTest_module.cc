@@ -0,0 +1,321 @@
+/**
+ * @file   PxHitColumnsTest_module.cc
+ * @brief  Tests the PxHit column interfaces against the PxHit ones
+ * @date   October 19, 2026
+ * @see    PxHitColumns.h PxHitConverter.h GeometryUtilities.h
+ */
+
+// LArSoft libraries
+#include "larcore/CoreUtils/ServiceUtil.h" // lar::providerFrom<>()
+#include "larcore/Geometry/Geometry.h"
+#include "larcorealg/Geometry/GeometryCore.h"
+#include "lardata/DetectorInfoServices/DetectorClocksService.h"
+#include "lardata/DetectorInfoServices/DetectorPropertiesService.h"
+#include "lardata/Utilities/GeometryUtilities.h"
+#include "lardata/Utilities/PxHitColumns.h"
+#include "lardata/Utilities/PxHitConverter.h"
+#include "lardata/Utilities/UtilException.h"
+#include "lardataobj/RecoBase/Hit.h"
+
+// framework libraries
+#include "art/Framework/Core/EDAnalyzer.h"
+#include "art/Framework/Core/ModuleMacros.h"
+#include "art/Framework/Services/Registry/ServiceHandle.h"
+#include "canvas/Persistency/Common/Ptr.h"
+#include "canvas/Persistency/Provenance/ProductID.h"
+#include "canvas/Utilities/Exception.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max()
+#include <cmath> // std::abs()
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fhicl {
+  class ParameterSet;
+} // namespace fhicl
+
+namespace util {
+
+  /**
+   * @brief Test module comparing the `PxHitColumns` interfaces with the
+   *        `PxHit` ones
+   *
+   * Currently exercises:
+   * - `PxHitConverter::ToPxHitColumns()` and `GeneratePxHitColumns()` against
+   *   `ToPxHitVector()` and `GeneratePxHit()`
+   * - the `GeometryUtilities` functions on hit columns (`Get2DDistances()`,
+   *   `Get2Dangles()`, `Get2Dslope()`, `Get2Dangle()`, `Get2DDistance()` and
+   *   `SelectPolygonHitList()`) against their `PxHit` versions
+   *
+   * The geometry functions are given the same hits in both forms (the `PxHit`
+   * ones are read from the columns), and they are expected to agree up to
+   * single precision rounding; the polygon must be exactly the same.
+   *
+   * Throws an exception on failure.
+   *
+   * Service requirements
+   * =====================
+   *
+   * This module requires the following services to be configured:
+   * - Geometry
+   * - LArPropertiesService
+   * - DetectorClocksService
+   * - DetectorPropertiesService
+   *
+   * Configuration parameters
+   * =========================
+   *
+   * Currently none.
+   *
+   */
+  class PxHitColumnsTest : public art::EDAnalyzer {
+  public:
+    explicit PxHitColumnsTest(fhicl::ParameterSet const&);
+
+  private:
+    /// Run event-independent tests
+    void beginJob() override;
+
+    /// Run event-dependent tests (none so far)
+    void
+    analyze(const art::Event& /* evt */) override
+    {}
+
+    /// Throws if errors have been accumulated
+    void endJob() override;
+
+    /// @{
+    /// @name Test functions
+
+    /// Tests the conversion from `recob::Hit`
+    void converter_test(GeometryUtilities const& gser);
+
+    /// Tests the `GeometryUtilities` functions on hit columns
+    void geometry_test(GeometryUtilities const& gser);
+
+    /// @}
+
+    /// Records an error if `value` and `expected` differ beyond `tolerance`.
+    void checkClose(std::string const& what, double value, double expected,
+                    double tolerance = 1e-5);
+
+    std::vector<std::string> errors; ///< list of collected errors
+
+  }; // PxHitColumnsTest
+
+  DEFINE_ART_MODULE(PxHitColumnsTest)
+
+} // namespace util
+
+//------------------------------------------------------------------------------
+//--- implementation
+//---
+namespace {
+
+  /// Returns `n` hits on plane `plane`, with random position and charge.
+  std::vector<recob::Hit>
+  makeHits(unsigned int n, unsigned int plane)
+  {
+    std::default_random_engine engine(12345);
+    std::uniform_int_distribution<unsigned int> wireDist(0U, 239U);
+    std::uniform_real_distribution<float> timeDist(100.f, 3000.f);
+    std::uniform_real_distribution<float> chargeDist(10.f, 500.f);
+
+    std::vector<recob::Hit> hits;
+    hits.reserve(n);
+    for (unsigned int i = 0; i < n; ++i) {
+      float const peakTime = timeDist(engine);
+      float const charge = chargeDist(engine);
+      geo::WireID const wireID{0U, 0U, plane, wireDist(engine)};
+      hits.emplace_back(raw::ChannelID_t(i),            // channel
+                        raw::TDCtick_t(peakTime - 10.f), // start tick
+                        raw::TDCtick_t(peakTime + 10.f), // end tick
+                        peakTime,                        // peak time
+                        1.f,                             // sigma peak time
+                        3.f,                             // RMS
+                        charge / 5.f,                    // peak amplitude
+                        1.f,                             // sigma peak amplitude
+                        charge * 1.1f,                   // summed ADC
+                        charge,                          // integral
+                        1.f,                             // sigma integral
+                        1,                               // multiplicity
+                        0,                               // local index
+                        1.f,                             // goodness of fit
+                        5,                               // DoF
+                        geo::kUnknown,                   // view
+                        geo::kCollection,                // signal type
+                        wireID);
+    } // for
+    return hits;
+  } // makeHits()
+
+} // local namespace
+
+namespace util {
+
+  //----------------------------------------------------------------------------
+  PxHitColumnsTest::PxHitColumnsTest(const fhicl::ParameterSet& pset) : EDAnalyzer(pset) {}
+
+  //----------------------------------------------------------------------------
+  void
+  PxHitColumnsTest::beginJob()
+  {
+    auto const clockData =
+      art::ServiceHandle<detinfo::DetectorClocksService const>()->DataForJob();
+    auto const detProp =
+      art::ServiceHandle<detinfo::DetectorPropertiesService const>()->DataForJob(clockData);
+    GeometryUtilities const gser{*lar::providerFrom<geo::Geometry>(), clockData, detProp};
+
+    converter_test(gser);
+    geometry_test(gser);
+  } // PxHitColumnsTest::beginJob()
+
+  //----------------------------------------------------------------------------
+  void
+  PxHitColumnsTest::endJob()
+  {
+    if (errors.empty()) {
+      mf::LogInfo("PxHitColumnsTest") << "All tests were successful.";
+      return;
+    }
+
+    mf::LogError log("PxHitColumnsTest");
+    log << errors.size() << " errors detected:";
+
+    for (std::string const& error : errors)
+      log << "\n - " << error;
+
+    throw art::Exception(art::errors::LogicError) << errors.size() << " errors detected";
+  }
+
+  //----------------------------------------------------------------------------
+  void
+  PxHitColumnsTest::checkClose(std::string const& what,
+                               double value,
+                               double expected,
+                               double tolerance /* = 1e-5 */)
+  {
+    double const scale = std::max(1.0, std::abs(expected));
+    if (std::abs(value - expected) <= tolerance * scale) return;
+    errors.push_back(what + ": got " + std::to_string(value) + ", expected " +
+                     std::to_string(expected));
+  }
+
+  //----------------------------------------------------------------------------
+  void
+  PxHitColumnsTest::converter_test(GeometryUtilities const& gser)
+  {
+    std::vector<recob::Hit> const hits = makeHits(500U, 2U);
+    art::ProductID const hitID{5};
+    std::vector<art::Ptr<recob::Hit>> hitPtrs;
+    for (std::size_t i = 0; i < hits.size(); ++i)
+      hitPtrs.emplace_back(hitID, &hits[i], i);
+
+    PxHitConverter const converter{gser};
+
+    std::vector<PxHit> expected;
+    converter.GeneratePxHit(hitPtrs, expected);
+    std::vector<PxHit> const fromVector = converter.ToPxHitVector(hits);
+
+    PxHitColumns generated;
+    converter.GeneratePxHitColumns(hits, generated);
+    PxHitColumns const fromHits = converter.ToPxHitColumns(hits);
+    PxHitColumns const fromPtrs = converter.ToPxHitColumns(hitPtrs);
+
+    auto checkColumns = [this, &expected, &fromVector](std::string const& name,
+                                                       PxHitColumns const& columns) {
+      if (columns.size() != expected.size()) {
+        errors.push_back(name + ": " + std::to_string(columns.size()) + " hit columns, " +
+                         std::to_string(expected.size()) + " PxHit");
+        return;
+      }
+      for (std::size_t i = 0; i < expected.size(); ++i) {
+        std::string const hitName = name + " hit #" + std::to_string(i);
+        PxHit const hit = columns.hit(i);
+        if (hit.plane != expected[i].plane) errors.push_back(hitName + ": wrong plane");
+        checkClose(hitName + " wire", hit.w, expected[i].w);
+        checkClose(hitName + " time", hit.t, expected[i].t);
+        checkClose(hitName + " charge", hit.charge, expected[i].charge);
+        checkClose(hitName + " summed ADC", hit.sumADC, expected[i].sumADC);
+        checkClose(hitName + " peak", hit.peak, expected[i].peak);
+        checkClose(hitName + " wire (ToPxHitVector())", fromVector[i].w, expected[i].w, 0.0);
+        checkClose(hitName + " time (ToPxHitVector())", fromVector[i].t, expected[i].t, 0.0);
+      } // for
+    };
+    checkColumns("GeneratePxHitColumns()", generated);
+    checkColumns("ToPxHitColumns(hits)", fromHits);
+    checkColumns("ToPxHitColumns(pointers)", fromPtrs);
+
+    // like GeneratePxHit(), GeneratePxHitColumns() rejects empty hit lists
+    try {
+      PxHitColumns none;
+      converter.GeneratePxHitColumns(std::vector<recob::Hit>{}, none);
+      errors.push_back("GeneratePxHitColumns() accepted an empty hit list");
+    }
+    catch (UtilException const&) {
+    }
+  } // PxHitColumnsTest::converter_test()
+
+  //----------------------------------------------------------------------------
+  void
+  PxHitColumnsTest::geometry_test(GeometryUtilities const& gser)
+  {
+    PxHitConverter const converter{gser};
+    PxHitColumns const columns = converter.ToPxHitColumns(makeHits(300U, 1U));
+    std::vector<PxHit> const pxhits = columns.toPxHits();
+    std::size_t const n = pxhits.size();
+
+    // a reference point away from all the hits, to keep angles well defined
+    PxPoint const start{1U, -10.0, -10.0};
+
+    std::vector<float> distances, angles;
+    gser.Get2DDistances(columns, start, distances);
+    gser.Get2Dangles(columns, start, angles);
+    if ((distances.size() != n) || (angles.size() != n)) {
+      errors.push_back("Get2DDistances()/Get2Dangles(): wrong number of results");
+      return;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      std::string const hitName = "hit #" + std::to_string(i);
+      checkClose("Get2DDistances() " + hitName,
+                 distances[i],
+                 gser.Get2DDistance(&pxhits[i], &start));
+      checkClose("Get2Dangles() " + hitName, angles[i], gser.Get2Dangle(&pxhits[i], &start));
+
+      std::size_t const j = (i * 7 + 3) % n;
+      if ((pxhits[i].w == pxhits[j].w) || (pxhits[i].t == pxhits[j].t)) continue;
+      checkClose("Get2Dslope() " + hitName,
+                 gser.Get2Dslope(columns, i, j),
+                 gser.Get2Dslope(&pxhits[i], &pxhits[j]));
+      checkClose("Get2Dangle() " + hitName,
+                 gser.Get2Dangle(columns, i, j),
+                 gser.Get2Dangle(&pxhits[i], &pxhits[j]));
+      checkClose("Get2DDistance() " + hitName,
+                 gser.Get2DDistance(columns, i, j),
+                 gser.Get2DDistance(&pxhits[i], &pxhits[j]));
+    } // for
+
+    // the polygon: the same hits, as indices into the columns
+    std::vector<unsigned int> polygon;
+    gser.SelectPolygonHitList(columns, polygon);
+    std::vector<PxHit const*> expected;
+    gser.SelectPolygonHitList(pxhits, expected);
+    if (polygon.size() != expected.size()) {
+      errors.push_back("SelectPolygonHitList(): " + std::to_string(polygon.size()) +
+                       " polygon hits from columns, " + std::to_string(expected.size()) +
+                       " from PxHit");
+      return;
+    }
+    for (std::size_t i = 0; i < polygon.size(); ++i) {
+      std::size_t const expectedIndex = expected[i] - pxhits.data();
+      if (polygon[i] == expectedIndex) continue;
+      errors.push_back("SelectPolygonHitList(): polygon hit #" + std::to_string(i) + " is #" +
+                       std::to_string(polygon[i]) + ", expected #" +
+                       std::to_string(expectedIndex));
+    } // for
+  } // PxHitColumnsTest::geometry_test()
+
+} // namespace util